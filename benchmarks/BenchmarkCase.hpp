@@ -0,0 +1,12 @@
+#ifndef BENCHMARKS_BENCHMARK_CASE_HPP
+#define BENCHMARKS_BENCHMARK_CASE_HPP
+
+#ifndef CATCH_CONFIG_ENABLE_BENCHMARKING
+	#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#endif
+
+#include <catch2/catch.hpp>
+
+#include "System/SuppressIntellisense.hpp"
+
+#endif // BENCHMARKS_BENCHMARK_CASE_HPP
@@ -0,0 +1,84 @@
+#include "BenchmarkCase.hpp"
+
+#include "Core/Arguments/CommandLine.hpp"
+#include "Core/CommandLineInputs.hpp"
+#include "Json/JsonFile.hpp"
+#include "State/BuildPaths.hpp"
+#include "State/BuildState.hpp"
+#include "State/CentralState.hpp"
+#include "State/SourceOutputs.hpp"
+#include "State/Target/SourceTarget.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr i32 kSourcesPerFolder = 100;
+constexpr std::array<i32, 3> kTargetSizes = { 1000, 10000, 100000 };
+}
+
+TEST_CASE("chalet::BuildPathsBenchmark", "[benchmark][outputs]")
+{
+	auto previousCwd = Files::getWorkingDirectory();
+	auto cwd = fmt::format("{}/chalet_build_paths_benchmark", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(cwd);
+
+	// Generate a static library for each size, from 1,000 to 100,000 sources, 100 per folder
+	//
+	Json jRoot = Json::object();
+	jRoot["name"] = "build-paths-benchmark";
+	jRoot["version"] = "1.0.0";
+	jRoot["targets"] = Json::object();
+
+	for (auto size : kTargetSizes)
+	{
+		for (i32 i = 0; i < size; ++i)
+		{
+			REQUIRE(Files::createFileWithContents(fmt::format("{}/src/{}/module_{}/unit_{}.cpp", cwd, size, i / kSourcesPerFolder, i), std::string(), true));
+		}
+
+		auto name = fmt::format("sources_{}", size);
+		jRoot["targets"][name] = Json::object();
+		jRoot["targets"][name]["kind"] = "staticLibrary";
+		jRoot["targets"][name]["language"] = "C++";
+		jRoot["targets"][name]["files"] = fmt::format("src/{}/**.cpp", size);
+	}
+	REQUIRE(JsonFile::saveToFile(jRoot, fmt::format("{}/chalet.json", cwd)));
+
+	const char* argv[] = { "chalet", "configure", "--root-dir", cwd.c_str() };
+	bool result = false;
+	auto inputs = CommandLine::read(static_cast<i32>(std::size(argv)), argv, result);
+	REQUIRE(result);
+
+	CentralState centralState(*inputs);
+	REQUIRE(centralState.initialize());
+
+	BuildState state(centralState.inputs(), centralState);
+	REQUIRE(state.initialize());
+
+	// Every target gets its own file cache, so nothing is skipped as already built
+	//
+	for (auto& target : state.targets)
+	{
+		REQUIRE(target->isSources());
+
+		const auto& project = static_cast<const SourceTarget&>(*target);
+		const auto count = project.files().size();
+
+		StringList fileCache;
+		auto outputs = state.paths.getOutputs(project, fileCache);
+		REQUIRE(outputs->groups.size() == count);
+		REQUIRE(outputs->objectListLinker.size() == count);
+
+		BENCHMARK(fmt::format("outputs for {} sources", count))
+		{
+			StringList cache;
+			return state.paths.getOutputs(project, cache)->groups.size();
+		};
+	}
+
+	Files::changeWorkingDirectory(previousCwd);
+	Files::removeRecursively(cwd);
+}
+}
@@ -0,0 +1,124 @@
+#include "BenchmarkCase.hpp"
+
+#include "BuildEnvironment/IBuildEnvironment.hpp"
+#include "Compile/CompileToolchain.hpp"
+#include "Core/Arguments/CommandLine.hpp"
+#include "Core/CommandLineInputs.hpp"
+#include "Json/JsonFile.hpp"
+#include "State/BuildPaths.hpp"
+#include "State/BuildState.hpp"
+#include "State/CentralState.hpp"
+#include "State/Target/SourceTarget.hpp"
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr i32 kSourceCount = 10000;
+constexpr i32 kIncludeDirCount = 200;
+constexpr i32 kDefineCount = 50;
+}
+
+TEST_CASE("chalet::CompileCommandBenchmark", "[benchmark][compile]")
+{
+	auto previousCwd = Files::getWorkingDirectory();
+	auto cwd = fmt::format("{}/chalet_compile_command_benchmark", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(cwd);
+
+	// Generate a synthetic static library with 10,000 sources, 200 include dirs & 50 defines
+	//
+	StringList includeDirs;
+	for (i32 i = 0; i < kIncludeDirCount; ++i)
+	{
+		auto dir = fmt::format("include/dir_{}", i);
+		REQUIRE(Files::makeDirectory(fmt::format("{}/{}", cwd, dir)));
+		includeDirs.emplace_back(std::move(dir));
+	}
+
+	StringList defines;
+	for (i32 i = 0; i < kDefineCount; ++i)
+		defines.emplace_back(fmt::format("SYNTHETIC_DEFINE_{}=1", i));
+
+	for (i32 i = 0; i < kSourceCount; ++i)
+	{
+		REQUIRE(Files::createFileWithContents(fmt::format("{}/src/unit_{}.cpp", cwd, i), fmt::format("int unit_{}() {{ return {}; }}", i, i), true));
+	}
+
+	Json jRoot = Json::object();
+	jRoot["name"] = "compile-command-benchmark";
+	jRoot["version"] = "1.0.0";
+	jRoot["targets"] = Json::object();
+	jRoot["targets"]["synthetic"] = Json::object();
+
+	auto& jTarget = jRoot["targets"]["synthetic"];
+	jTarget["kind"] = "staticLibrary";
+	jTarget["language"] = "C++";
+	jTarget["files"] = "src/**.cpp";
+	jTarget["settings:Cxx"] = Json::object();
+	jTarget["settings:Cxx"]["includeDirs"] = includeDirs;
+	jTarget["settings:Cxx"]["defines"] = defines;
+	REQUIRE(JsonFile::saveToFile(jRoot, fmt::format("{}/chalet.json", cwd)));
+
+	const char* argv[] = { "chalet", "configure", "--root-dir", cwd.c_str() };
+	bool result = false;
+	auto inputs = CommandLine::read(static_cast<i32>(std::size(argv)), argv, result);
+	REQUIRE(result);
+
+	CentralState centralState(*inputs);
+	REQUIRE(centralState.initialize());
+
+	BuildState state(centralState.inputs(), centralState);
+	REQUIRE(state.initialize());
+
+	const SourceTarget* project = nullptr;
+	for (auto& target : state.targets)
+	{
+		if (target->isSources())
+			project = static_cast<const SourceTarget*>(target.get());
+	}
+	REQUIRE(project != nullptr);
+
+	const auto& sources = project->files();
+	REQUIRE(sources.size() == static_cast<size_t>(kSourceCount));
+
+	state.paths.setBuildDirectoriesBasedOnProjectKind(*project);
+
+	CompileToolchain toolchain(*project);
+	REQUIRE(toolchain.initialize(state));
+	REQUIRE(toolchain.compilerCxx != nullptr);
+
+	StringList objects;
+	StringList dependencies;
+	for (auto& source : sources)
+	{
+		objects.emplace_back(state.environment->getObjectFile(source));
+		dependencies.emplace_back(state.environment->getDependencyFile(source));
+	}
+
+	auto& compiler = *toolchain.compilerCxx;
+	REQUIRE(compiler.getCommand(sources[0], objects[0], dependencies[0], SourceType::CPlusPlus) == compiler.getCachedCommand(sources[0], objects[0], dependencies[0], SourceType::CPlusPlus));
+
+	BENCHMARK(fmt::format("generate {} compile commands", sources.size()))
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < sources.size(); ++i)
+			count += compiler.getCommand(sources[i], objects[i], dependencies[i], SourceType::CPlusPlus).size();
+
+		return count;
+	};
+
+	BENCHMARK(fmt::format("generate {} compile commands from a cached template", sources.size()))
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < sources.size(); ++i)
+			count += compiler.getCachedCommand(sources[i], objects[i], dependencies[i], SourceType::CPlusPlus).size();
+
+		return count;
+	};
+
+	Files::changeWorkingDirectory(previousCwd);
+	Files::removeRecursively(cwd);
+}
+}
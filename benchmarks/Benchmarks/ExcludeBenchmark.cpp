@@ -0,0 +1,108 @@
+#include "BenchmarkCase.hpp"
+
+#include "System/ExcludeMatcher.hpp"
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr i32 kModuleCount = 400;
+constexpr i32 kSourcesPerModule = 100;
+
+/*****************************************************************************/
+// How SourceTarget::removeExcludedFiles worked before - each exclude was expanded on its own,
+//   and every file was compared against every exclude
+//
+size_t substringExcludes(const std::string& inPattern, const StringList& inExcludes)
+{
+	StringList files;
+	Files::addPathToListWithGlob(inPattern, files, GlobMatch::Files);
+
+	StringList fileExcludes;
+	for (auto& exclude : inExcludes)
+		Files::addPathToListWithGlob(exclude, fileExcludes, GlobMatch::FilesAndFolders);
+
+	std::string excludes = String::join(fileExcludes);
+	auto itr = files.begin();
+	while (itr != files.end())
+	{
+		auto& path = *itr;
+		bool excluded = String::contains(path, excludes);
+		if (!excluded)
+		{
+			for (auto& exclude : fileExcludes)
+			{
+				if (String::contains(exclude, path))
+				{
+					excluded = true;
+					break;
+				}
+			}
+		}
+
+		if (excluded)
+			itr = files.erase(itr);
+		else
+			++itr;
+	}
+
+	return files.size();
+}
+
+/*****************************************************************************/
+size_t compiledExcludes(const std::string& inPattern, const StringList& inExcludes)
+{
+	ExcludeMatcher excludes(inExcludes);
+
+	StringList files;
+	Files::addPathToListWithGlob(inPattern, files, GlobMatch::Files, nullptr, &excludes);
+	return files.size();
+}
+}
+
+TEST_CASE("chalet::ExcludeBenchmark", "[benchmark][excludes]")
+{
+	auto previousCwd = Files::getWorkingDirectory();
+	auto cwd = fmt::format("{}/chalet_exclude_benchmark", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(cwd);
+
+	// 40,000 sources, with 150 excludes - 50 folders, 50 files and 50 globs
+	//
+	for (i32 i = 0; i < kModuleCount; ++i)
+	{
+		for (i32 j = 0; j < kSourcesPerModule; ++j)
+		{
+			REQUIRE(Files::createFileWithContents(fmt::format("{}/src/module_{}/unit_{}.cpp", cwd, i, j), std::string(), true));
+		}
+	}
+
+	StringList excludes;
+	for (i32 i = 0; i < 50; ++i)
+	{
+		excludes.emplace_back(fmt::format("src/module_{}/", i * 8));
+		excludes.emplace_back(fmt::format("src/module_{}/unit_{}.cpp", i * 8 + 1, i));
+		excludes.emplace_back(fmt::format("src/module_{}/unit_9*.cpp", i * 8 + 2));
+	}
+
+	REQUIRE(Files::changeWorkingDirectory(cwd));
+
+	const auto expected = static_cast<size_t>((kModuleCount - 50) * kSourcesPerModule - 50 - (50 * 11));
+	REQUIRE(substringExcludes("src/**/*.cpp", excludes) == expected);
+	REQUIRE(compiledExcludes("src/**/*.cpp", excludes) == expected);
+
+	BENCHMARK("substring excludes: 40k files, 150 excludes")
+	{
+		return substringExcludes("src/**/*.cpp", excludes);
+	};
+
+	BENCHMARK("compiled excludes: 40k files, 150 excludes")
+	{
+		return compiledExcludes("src/**/*.cpp", excludes);
+	};
+
+	Files::changeWorkingDirectory(previousCwd);
+	Files::removeRecursively(cwd);
+}
+}
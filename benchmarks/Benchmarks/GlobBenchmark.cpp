@@ -0,0 +1,178 @@
+#include "BenchmarkCase.hpp"
+
+#include <regex>
+
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr i32 kSourceFolderCount = 400;
+constexpr i32 kSourcesPerFolder = 25;
+constexpr i32 kIgnoredFolderCount = 400;
+constexpr i32 kIgnoredPerFolder = 50;
+
+/*****************************************************************************/
+// The regex based implementation Files::forEachGlobMatch used before, kept for comparison
+//
+size_t regexGlob(const std::string& inPattern)
+{
+	std::string basePath;
+	auto pos = inPattern.find_first_of("*{");
+	if (pos != std::string::npos)
+	{
+		auto tmp = inPattern.substr(0, pos);
+		basePath = String::getPathFolder(tmp);
+		if (basePath.empty())
+			basePath = std::move(tmp);
+	}
+
+	size_t start = 0;
+	std::string pattern;
+	for (size_t i = 0; i < inPattern.size(); ++i)
+	{
+		switch (inPattern[i])
+		{
+			case '(':
+			case ')':
+				pattern += '\\';
+				break;
+			case '{': {
+				if (start == 0)
+					start = pattern.size();
+				break;
+			}
+			default: break;
+		}
+
+		pattern += inPattern[i];
+	}
+
+	while (start != std::string::npos)
+	{
+		auto prefix = pattern.substr(0, start);
+		start += 1;
+		auto end = pattern.find('}', start);
+		if (end != std::string::npos)
+		{
+			auto suffix = pattern.substr(end + 1);
+			auto arr = pattern.substr(start, end - start);
+
+			String::replaceAll(arr, ',', '|');
+			pattern = fmt::format("{}({}){}", prefix, arr, suffix);
+		}
+		start = pattern.find('{', start);
+	}
+
+	std::string patternSwap = std::move(pattern);
+	pattern.clear();
+	for (size_t i = 0; i < patternSwap.size(); ++i)
+	{
+		switch (patternSwap[i])
+		{
+			case '{':
+			case '}':
+			case '[':
+			case ']':
+			case '.':
+			case '+':
+				pattern += '\\';
+				break;
+			case '?':
+				pattern += '.';
+				continue;
+			default: break;
+		}
+
+		pattern += patternSwap[i];
+	}
+	String::replaceAll(pattern, "**/*", "(.+)");
+	String::replaceAll(pattern, "**", "(.+)");
+	String::replaceAll(pattern, '*', R"regex((((?!\/).)*))regex");
+	String::replaceAll(pattern, "(.+)", "(.*)");
+	pattern.push_back('$');
+
+	std::regex re(pattern);
+
+	size_t ret = 0;
+	for (auto it = fs::recursive_directory_iterator(basePath); it != fs::recursive_directory_iterator(); ++it)
+	{
+		if (!it->is_regular_file())
+			continue;
+
+		auto p = it->path().string();
+		if (std::regex_search(p.begin(), p.end(), re))
+			++ret;
+	}
+
+	return ret;
+}
+}
+
+TEST_CASE("chalet::GlobBenchmark", "[benchmark][glob]")
+{
+	auto previousCwd = Files::getWorkingDirectory();
+	auto cwd = fmt::format("{}/chalet_glob_benchmark", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(cwd);
+
+	// Generate a workspace with 10,000 sources, next to 20,000 files in build & node_modules
+	//
+	for (i32 i = 0; i < kSourceFolderCount; ++i)
+	{
+		for (i32 j = 0; j < kSourcesPerFolder; ++j)
+		{
+			REQUIRE(Files::createFileWithContents(fmt::format("{}/src/module_{}/unit_{}.cpp", cwd, i, j), std::string(), true));
+		}
+		REQUIRE(Files::createFileWithContents(fmt::format("{}/src/module_{}/unit.hpp", cwd, i), std::string(), true));
+	}
+	for (i32 i = 0; i < kIgnoredFolderCount; ++i)
+	{
+		for (i32 j = 0; j < kIgnoredPerFolder / 2; ++j)
+		{
+			REQUIRE(Files::createFileWithContents(fmt::format("{}/build/obj_{}/unit_{}.cpp.o", cwd, i, j), std::string(), true));
+			REQUIRE(Files::createFileWithContents(fmt::format("{}/node_modules/package_{}/file_{}.cpp", cwd, i, j), std::string(), true));
+		}
+	}
+
+	REQUIRE(Files::changeWorkingDirectory(cwd));
+
+	const auto expected = static_cast<size_t>(kSourceFolderCount * kSourcesPerFolder);
+
+	auto globCount = [](const std::string& inPattern) {
+		size_t count = 0;
+		Files::forEachGlobMatch(inPattern, GlobMatch::Files, [&count](const std::string&) {
+			++count;
+		});
+		return count;
+	};
+
+	REQUIRE(regexGlob("src/**/*.cpp") == expected);
+	REQUIRE(globCount("src/**/*.cpp") == expected);
+
+	BENCHMARK("regex glob: src/**/*.cpp")
+	{
+		return regexGlob("src/**/*.cpp");
+	};
+
+	BENCHMARK("glob: src/**/*.cpp")
+	{
+		return globCount("src/**/*.cpp");
+	};
+
+	// From the workspace root - only the regex walks node_modules
+	BENCHMARK("regex glob: **/unit_1?.cpp")
+	{
+		return regexGlob(fmt::format("{}/**/unit_1?.cpp", cwd));
+	};
+
+	BENCHMARK("glob: **/unit_1?.cpp")
+	{
+		return globCount(fmt::format("{}/**/unit_1?.cpp", cwd));
+	};
+
+	Files::changeWorkingDirectory(previousCwd);
+	Files::removeRecursively(cwd);
+}
+}
@@ -0,0 +1,84 @@
+#include "BenchmarkCase.hpp"
+
+#include "Process/Process.hpp"
+#include "State/CompilerTools.hpp"
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr i32 kObjectCount = 2000;
+
+std::string getBenchmarkCompiler()
+{
+	for (auto& compiler : StringList{ "cc", "gcc", "clang" })
+	{
+		auto path = Files::which(compiler, false);
+		if (!path.empty())
+			return path;
+	}
+	return std::string();
+}
+}
+
+TEST_CASE("chalet::LinkerBenchmark", "[benchmark][linker]")
+{
+	auto compiler = getBenchmarkCompiler();
+	if (compiler.empty())
+	{
+		WARN("No C compiler was found - skipping");
+		return;
+	}
+
+	auto cwd = fmt::format("{}/chalet_linker_benchmark", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(cwd);
+
+	// Generate a synthetic executable split across 2,000 translation units
+	//
+	StringList compileCmd{ compiler, "-c" };
+	StringList objects;
+	std::string declarations;
+	std::string calls;
+	for (i32 i = 0; i < kObjectCount; ++i)
+	{
+		auto source = fmt::format("unit_{}.c", i);
+		REQUIRE(Files::createFileWithContents(fmt::format("{}/{}", cwd, source), fmt::format("int unit_{}(int x) {{ return x + {}; }}", i, i), true));
+
+		declarations += fmt::format("int unit_{}(int x);\n", i);
+		calls += fmt::format("\tx = unit_{}(x);\n", i);
+
+		compileCmd.emplace_back(std::move(source));
+		objects.emplace_back(fmt::format("unit_{}.o", i));
+	}
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/main.c", cwd), fmt::format("{}int main(void)\n{{\n\tint x = 0;\n{}\treturn x == 0;\n}}", declarations, calls), true));
+	compileCmd.emplace_back("main.c");
+	objects.emplace_back("main.o");
+
+	REQUIRE(Process::run(compileCmd, cwd));
+
+	auto linkers = CompilerTools::getFastLinkerCandidates();
+	linkers.emplace_back("bfd");
+
+	for (auto& linker : linkers)
+	{
+		StringList linkCmd{ compiler, fmt::format("-fuse-ld={}", linker), "-o", "out" };
+		for (auto& object : objects)
+			linkCmd.push_back(object);
+
+		if (!Process::run(linkCmd, cwd, PipeOption::Close, PipeOption::Close))
+		{
+			WARN(fmt::format("Linker not available: {}", linker));
+			continue;
+		}
+
+		BENCHMARK(fmt::format("link {} objects with {}", objects.size(), linker))
+		{
+			return Process::run(linkCmd, cwd, PipeOption::Close, PipeOption::Close);
+		};
+	}
+
+	Files::removeRecursively(cwd);
+}
+}
@@ -0,0 +1,7 @@
+#define CATCH_CONFIG_RUNNER
+#include "BenchmarkCase.hpp"
+
+int main(const int argc, const char* argv[])
+{
+	return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,225 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Builder/BuildHistoryReport.hpp"
+
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+// Anything that changed by less than this is treated as noise, whatever the percentage
+constexpr i64 kMinimumChange = 50;
+
+/*****************************************************************************/
+std::string getSeconds(const i64 inMilliseconds)
+{
+	return fmt::format("{:.2f}s", static_cast<double>(inMilliseconds) / 1000.0);
+}
+
+/*****************************************************************************/
+i64 getMedian(std::vector<i64>& inValues)
+{
+	if (inValues.empty())
+		return 0;
+
+	auto middle = inValues.begin() + (inValues.size() / 2);
+	std::nth_element(inValues.begin(), middle, inValues.end());
+	return *middle;
+}
+
+/*****************************************************************************/
+bool isComparable(const BuildHistory::Record& inRecord, const BuildHistory::Record& inLatest)
+{
+	return inRecord.success
+		&& inRecord.compiled == inLatest.compiled
+		&& String::equals(inLatest.route, inRecord.route)
+		&& String::equals(inLatest.configuration, inRecord.configuration)
+		&& String::equals(inLatest.toolchain, inRecord.toolchain)
+		&& String::equals(inLatest.architecture, inRecord.architecture);
+}
+
+/*****************************************************************************/
+const BuildHistory::Target* findTarget(const BuildHistory::Record& inRecord, const std::string& inName)
+{
+	for (auto& target : inRecord.targets)
+	{
+		if (String::equals(inName, target.name))
+			return &target;
+	}
+	return nullptr;
+}
+}
+
+/*****************************************************************************/
+BuildHistoryReport::BuildHistoryReport(const u32 inThreshold, const u32 inBaselineBuilds) :
+	m_threshold(inThreshold),
+	m_maxBaselineBuilds(std::max(inBaselineBuilds, 1u))
+{
+}
+
+/*****************************************************************************/
+// inRecords must outlive the report
+//
+bool BuildHistoryReport::compare(const std::vector<BuildHistory::Record>& inRecords, const std::string& inConfiguration, const std::string& inToolchain)
+{
+	m_phases.clear();
+	m_targets.clear();
+	m_latest = nullptr;
+	m_baselineBuilds = 0;
+	m_regressions = 0;
+
+	auto it = inRecords.rbegin();
+	for (; it != inRecords.rend(); ++it)
+	{
+		bool matchesConfiguration = inConfiguration.empty() || String::equals(inConfiguration, it->configuration);
+		bool matchesToolchain = inToolchain.empty() || String::equals(inToolchain, it->toolchain);
+		if (matchesConfiguration && matchesToolchain)
+			break;
+	}
+
+	if (it == inRecords.rend())
+		return false;
+
+	m_latest = &(*it);
+
+	// A failed build stops early, so it says nothing about performance
+	if (!m_latest->success)
+		return true;
+
+	std::vector<const BuildHistory::Record*> baseline;
+	for (++it; it != inRecords.rend() && baseline.size() < m_maxBaselineBuilds; ++it)
+	{
+		if (isComparable(*it, *m_latest))
+			baseline.push_back(&(*it));
+	}
+
+	m_baselineBuilds = baseline.size();
+	if (baseline.empty())
+		return true;
+
+	auto addPhase = [this, &baseline](const char* inName, i64 BuildHistory::Record::*inPhase) {
+		std::vector<i64> values;
+		for (auto& record : baseline)
+			values.push_back(record->*inPhase);
+
+		m_phases.emplace_back(getChange(inName, m_latest->*inPhase, values));
+	};
+
+	addPhase("initialize", &BuildHistory::Record::initialize);
+	addPhase("prepare", &BuildHistory::Record::prepare);
+	addPhase("build", &BuildHistory::Record::build);
+	addPhase("post-build", &BuildHistory::Record::postBuild);
+	addPhase("total", &BuildHistory::Record::total);
+
+	for (auto& target : m_latest->targets)
+	{
+		// Only compare against builds where the target had the same amount of work to do
+		std::vector<i64> values;
+		for (auto& record : baseline)
+		{
+			auto previous = findTarget(*record, target.name);
+			if (previous != nullptr && previous->compiled == target.compiled)
+				values.push_back(previous->duration);
+		}
+
+		if (!values.empty())
+			m_targets.emplace_back(getChange(target.name, target.duration, values));
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+BuildHistoryReport::Change BuildHistoryReport::getChange(std::string inName, const i64 inLatest, std::vector<i64>& inBaseline)
+{
+	Change ret;
+	ret.name = std::move(inName);
+	ret.latest = inLatest;
+	ret.samples = inBaseline.size();
+	ret.baseline = getMedian(inBaseline);
+
+	auto allowed = ret.baseline + (ret.baseline * static_cast<i64>(m_threshold)) / 100;
+	ret.regressed = ret.latest > allowed && (ret.latest - ret.baseline) >= kMinimumChange;
+
+	if (ret.regressed)
+		m_regressions++;
+
+	return ret;
+}
+
+/*****************************************************************************/
+const BuildHistory::Record* BuildHistoryReport::latest() const noexcept
+{
+	return m_latest;
+}
+
+/*****************************************************************************/
+const std::vector<BuildHistoryReport::Change>& BuildHistoryReport::phases() const noexcept
+{
+	return m_phases;
+}
+
+/*****************************************************************************/
+const std::vector<BuildHistoryReport::Change>& BuildHistoryReport::targets() const noexcept
+{
+	return m_targets;
+}
+
+/*****************************************************************************/
+size_t BuildHistoryReport::baselineBuilds() const noexcept
+{
+	return m_baselineBuilds;
+}
+
+/*****************************************************************************/
+u32 BuildHistoryReport::regressions() const noexcept
+{
+	return m_regressions;
+}
+
+/*****************************************************************************/
+std::string BuildHistoryReport::getText() const
+{
+	std::string ret;
+	if (m_latest == nullptr)
+		return ret;
+
+	const auto& latest = *m_latest;
+	ret += fmt::format("**** Latest build: {} {} ({}, {}){}\n", latest.route, latest.configuration, latest.toolchain, latest.architecture, latest.success ? "" : " - failed");
+	ret += fmt::format("   Time: {}, compiled: {}, up to date: {}, peak memory: {:.1f} MB\n", getSeconds(latest.total), latest.compiled, latest.upToDate, static_cast<double>(latest.peakMemory) / 1024.0);
+
+	if (!latest.success)
+		return ret;
+
+	if (m_baselineBuilds == 0)
+	{
+		ret += "   No earlier successful build compiled the same number of files to compare with.\n";
+		return ret;
+	}
+
+	ret += fmt::format("   Compared with the median of {} earlier build(s) that compiled the same number of files\n", m_baselineBuilds);
+	ret += '\n';
+
+	auto addSection = [this, &ret](const char* inTitle, const std::vector<Change>& inChanges) {
+		if (inChanges.empty())
+			return;
+
+		ret += fmt::format("**** {} ({}):\n", inTitle, inChanges.size());
+		for (auto& change : inChanges)
+		{
+			auto percent = change.baseline > 0 ? std::llround((static_cast<double>(change.latest - change.baseline) / static_cast<double>(change.baseline)) * 100.0) : 0;
+			ret += fmt::format("{:>9}: {} (baseline {}, {:+}%){}\n", getSeconds(change.latest), change.name, getSeconds(change.baseline), percent, change.regressed ? fmt::format(" - regressed beyond {}%", m_threshold) : std::string());
+		}
+		ret += '\n';
+	};
+
+	addSection("Phases", m_phases);
+	addSection("Targets", m_targets);
+
+	return ret;
+}
+}
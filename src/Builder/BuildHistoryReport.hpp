@@ -0,0 +1,53 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "Cache/BuildHistory.hpp"
+
+namespace chalet
+{
+// Compares the latest build in the history with the median of the comparable builds before it
+//   (same route, configuration, toolchain & architecture, and the same number of files compiled)
+//
+class BuildHistoryReport
+{
+public:
+	struct Change
+	{
+		std::string name;
+		i64 baseline = 0; // milliseconds, the median
+		i64 latest = 0;
+		size_t samples = 0;
+		bool regressed = false;
+	};
+
+	BuildHistoryReport(const u32 inThreshold, const u32 inBaselineBuilds);
+
+	bool compare(const std::vector<BuildHistory::Record>& inRecords, const std::string& inConfiguration, const std::string& inToolchain);
+
+	const BuildHistory::Record* latest() const noexcept;
+	const std::vector<Change>& phases() const noexcept;
+	const std::vector<Change>& targets() const noexcept;
+	size_t baselineBuilds() const noexcept;
+	u32 regressions() const noexcept;
+
+	std::string getText() const;
+
+private:
+	Change getChange(std::string inName, const i64 inLatest, std::vector<i64>& inBaseline);
+
+	std::vector<Change> m_phases;
+	std::vector<Change> m_targets;
+
+	const BuildHistory::Record* m_latest = nullptr;
+
+	size_t m_baselineBuilds = 0;
+
+	u32 m_threshold = 0;
+	u32 m_maxBaselineBuilds = 0;
+	u32 m_regressions = 0;
+};
+}
@@ -14,7 +14,9 @@
 #include "Builder/ProfilerRunner.hpp"
 #include "Builder/ScriptRunner.hpp"
 #include "Builder/SubChaletBuilder.hpp"
+#include "Builder/TimeTraceReport.hpp"
 #include "Bundler/BinaryDependency/BinaryDependencyMap.hpp"
+#include "Cache/GlobCache.hpp"
 #include "Cache/SourceCache.hpp"
 #include "Cache/WorkspaceCache.hpp"
 #include "Compile/AssemblyDumper.hpp"
@@ -40,14 +42,18 @@
 #include "State/Target/ValidationBuildTarget.hpp"
 #include "State/TargetMetadata.hpp"
 #include "State/WorkspaceEnvironment.hpp"
+#include "System/FileCopier.hpp"
 #include "System/Files.hpp"
+#include "System/Trash.hpp"
 #include "Terminal/Output.hpp"
 #include "Terminal/Unicode.hpp"
 #include "Terminal/WindowsTerminal.hpp"
+#include "Utility/EventStream.hpp"
 #include "Utility/List.hpp"
 #include "Utility/Path.hpp"
 #include "Utility/String.hpp"
 #include "Utility/Timer.hpp"
+#include "Utility/Trace.hpp"
 #include "Json/JsonKeys.hpp"
 #include "Json/JsonValues.hpp"
 
@@ -55,6 +61,24 @@
 
 namespace chalet
 {
+namespace
+{
+/*****************************************************************************/
+const char* getRouteName(const CommandRoute& inRoute)
+{
+	if (inRoute.isRebuild())
+		return "rebuild";
+	else if (inRoute.isRun())
+		return "run";
+	else if (inRoute.isBuildRun())
+		return "buildrun";
+	else if (inRoute.isBundle())
+		return "bundle";
+
+	return "build";
+}
+}
+
 /*****************************************************************************/
 BuildManager::BuildManager(BuildState& inState) :
 	m_state(inState),
@@ -124,11 +148,25 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 {
 	m_timer.restart();
 
+	m_history = BuildHistory::Record();
+	m_historyPhaseStart = 0;
+	endHistoryPhase(m_history.initialize);
+
 	m_strategy = ICompileStrategy::make(m_state.toolchain.strategy(), m_state);
 
+	// Anything an interrupted run didn't get to is deleted while this one builds
+	Trash::reap(m_state.paths.trashDir());
+
 	if (m_state.cache.file().canWipeBuildFolder())
 	{
-		Files::removeRecursively(m_state.paths.buildOutputDir());
+		if (m_state.info.explain())
+			m_strategy->explanation().add(RebuildExplanation::Reason::BuildFolderRemoved, m_state.workspace.metadata().name(), m_state.paths.buildOutputDir(), m_state.cache.file().getWipeBuildFolderReason());
+
+		Trash::remove(m_state.paths.buildOutputDir(), m_state.paths.trashDir());
+		m_state.cache.fingerprint().invalidate();
+
+		if (m_state.paths.usesScratchDir() && Files::pathExists(m_state.paths.scratchDir()))
+			Files::removeRecursively(m_state.paths.scratchDir());
 	}
 
 	populateBuildTargets(inRoute);
@@ -136,6 +174,7 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 
 	if (inRoute.isClean())
 	{
+		m_state.cache.fingerprint().invalidate();
 		Output::lineBreak();
 
 		if (!cmdClean())
@@ -147,10 +186,23 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 	}
 	else if (inRoute.isRebuild())
 	{
+		if (m_state.info.explain())
+			m_strategy->explanation().add(RebuildExplanation::Reason::BuildFolderRemoved, m_state.workspace.metadata().name(), m_state.paths.buildOutputDir(), "The rebuild command was used");
+
 		// Don't produce any output from this
 		doFullBuildFolderClean(true);
+		m_state.cache.fingerprint().invalidate();
 	}
 
+	restoreScratchDir();
+
+	EventStream::emit("build_start", {
+										 { "route", getRouteName(inRoute) },
+										 { "configuration", m_state.configuration.name() },
+										 { "toolchain", m_state.inputs.toolchainPreferenceName() },
+										 { "architecture", m_state.info.targetArchitectureString() },
+									 });
+
 	if (!checkIntermediateFiles())
 	{
 		Output::lineBreak();
@@ -166,6 +218,13 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 	}
 
 	const bool runRoute = inRoute.isRun();
+	if (!runRoute)
+	{
+		// The targets whose files haven't changed since the last build don't need to be checked
+		auto& fingerprint = m_state.cache.fingerprint();
+		fingerprint.check();
+		fingerprint.begin();
+	}
 	const bool routeWillRun = inRoute.willRun();
 
 	std::string runTargetName;
@@ -228,7 +287,12 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 		Output::lineBreak();
 	}
 
-	m_strategy->doPreBuild();
+	endHistoryPhase(m_history.prepare);
+
+	{
+		TraceScope traceScope("pre-build");
+		m_strategy->doPreBuild();
+	}
 	m_fileCache.clear();
 	m_state.makeLibraryPathVariables();
 
@@ -255,6 +319,11 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 			break;
 
 		// At this point, we build
+		TraceScope traceScope("build target", target->name());
+		EventStream::emit("target_start", { { "target", target->name() } });
+
+		auto targetStart = Trace::now();
+		Timer targetTimer;
 		bool result = false;
 		if (target->isSubChalet())
 		{
@@ -292,6 +361,26 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 			}
 		}
 
+		auto duration = targetTimer.stop();
+		auto eventDuration = Trace::now() - targetStart;
+
+		// Ninja builds consecutive targets in one run, so each one's time comes from its log instead
+		if (target->isSources() && m_strategy != nullptr)
+		{
+			auto targetDuration = m_strategy->getTargetDuration(target->name());
+			if (targetDuration.has_value())
+			{
+				duration = *targetDuration;
+				eventDuration = *targetDuration * 1000;
+			}
+		}
+
+		auto& historyTarget = m_history.targets.emplace_back();
+		historyTarget.name = target->name();
+		historyTarget.duration = duration;
+
+		EventStream::emit("target_end", { { "target", target->name() }, { "result", result ? "success" : "failure" } }, { { "duration", eventDuration } });
+
 		if (!result)
 		{
 			error = true;
@@ -310,6 +399,8 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 		Output::lineBreak();
 	}
 
+	endHistoryPhase(m_history.build);
+
 	for (auto& target : m_state.targets)
 	{
 		if (target->isSources())
@@ -330,6 +421,9 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 
 	if (error)
 	{
+		addToHistory(inRoute, false);
+		EventStream::emit("build_end", { { "result", "failure" } });
+
 		if (!runRoute && !m_state.isSubChaletTarget())
 		{
 			Output::msgBuildFail();
@@ -337,7 +431,10 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 		}
 		return false;
 	}
-	else if (!runRoute && inShowSuccess)
+
+	persistScratchDir();
+
+	if (!runRoute && inShowSuccess)
 	{
 		if (m_state.info.generateCompileCommands())
 		{
@@ -348,6 +445,27 @@ bool BuildManager::run(const CommandRoute& inRoute, const bool inShowSuccess)
 			}
 		}
 
+		if (m_state.info.timeTrace() && m_state.environment->isClang())
+		{
+			TimeTraceReport timeTraceReport(m_state);
+			if (!timeTraceReport.generate())
+			{
+				Diagnostic::error("The time trace report could not be generated.");
+				return false;
+			}
+		}
+
+		if (m_state.info.resourceUsage())
+			printResourceUsage();
+
+		if (m_state.info.explain())
+			printExplanation();
+
+		recordFingerprint();
+
+		addToHistory(inRoute, true);
+		EventStream::emit("build_end", { { "result", "success" } });
+
 		Output::msgBuildSuccess();
 
 		auto res = m_timer.stop();
@@ -470,9 +588,15 @@ void BuildManager::printBuildInformation() const
 /*****************************************************************************/
 bool BuildManager::addProjectToBuild(const SourceTarget& inProject)
 {
+	TraceScope traceScope("prepare target", inProject.name());
+
 	auto buildToolchain = std::make_unique<CompileToolchain>(inProject);
 	auto& fileCache = m_fileCache[inProject.buildSuffix()];
-	auto outputs = m_state.paths.getOutputs(inProject, fileCache);
+	Unique<SourceOutputs> outputs;
+	{
+		TraceScope outputsScope("BuildPaths::getOutputs");
+		outputs = m_state.paths.getOutputs(inProject, fileCache);
+	}
 
 	if (inProject.willBuild())
 	{
@@ -496,11 +620,14 @@ bool BuildManager::addProjectToBuild(const SourceTarget& inProject)
 		return false;
 	}
 
+	addToFingerprint(inProject, *outputs);
+
 	m_strategy->setSourceOutputs(inProject, std::move(outputs));
 	m_strategy->setToolchainController(inProject, std::move(buildToolchain));
 
 	if (!inProject.cppModules())
 	{
+		TraceScope strategyScope("add project to strategy");
 		if (!m_strategy->addProject(inProject))
 			return false;
 	}
@@ -594,6 +721,9 @@ bool BuildManager::doFullBuildFolderClean(const bool inForRebuild)
 
 	addBuildPathIfExists(m_state.paths.currentCompileCommands());
 
+	if (m_state.paths.usesScratchDir())
+		addBuildPathIfExists(std::string(m_state.paths.scratchDir()));
+
 	// Note: does not require distribution targets to be initialized
 	//
 	for (const auto& target : m_state.distribution)
@@ -617,24 +747,35 @@ bool BuildManager::doFullBuildFolderClean(const bool inForRebuild)
 	bool nothingToClean = !dirExists && !didClean;
 	UNUSED(nothingToClean);
 
+	// Only the outermost paths are collected - a folder is moved to the trash as a whole, unless
+	//   there's an external build folder inside of it that's being kept
+	auto trashDir = m_state.paths.trashDir();
 	if (dirExists)
 	{
-		fs::recursive_directory_iterator it(dirToClean);
-		fs::recursive_directory_iterator itEnd;
-
-		while (it != itEnd)
+		StringList folders{ dirToClean };
+		while (!folders.empty())
 		{
-			auto path = it->path().string();
-			Path::toUnix(path);
+			auto folder = std::move(folders.back());
+			folders.pop_back();
 
-			if (!String::contains(externalLocations, path))
-			{
-				buildPaths.emplace_back(std::move(path));
-				++it;
-			}
-			else
+			std::error_code error;
+			for (fs::directory_iterator it(folder, error); !error && it != fs::directory_iterator(); it.increment(error))
 			{
-				++it;
+				auto path = it->path().string();
+				Path::toUnix(path);
+
+				if (path == trashDir || String::contains(externalLocations, path))
+					continue;
+
+				auto prefix = fmt::format("{}/", path);
+				bool hasExternalLocation = std::any_of(externalLocations.begin(), externalLocations.end(), [&prefix](const std::string& inLocation) {
+					return String::startsWith(prefix, inLocation);
+				});
+
+				if (hasExternalLocation)
+					folders.emplace_back(std::move(path));
+				else
+					buildPaths.emplace_back(std::move(path));
 			}
 		}
 	}
@@ -654,10 +795,16 @@ bool BuildManager::doFullBuildFolderClean(const bool inForRebuild)
 			Output::print(theme.reset, fmt::format("   [{}/{}] {}Removing {}{}", i + 1, total, color, path, reset));
 		}
 
-		if (Files::pathExists(path))
+		if (Files::pathIsDirectory(path))
+			Trash::remove(path, trashDir);
+		else if (Files::pathExists(path))
 			Files::remove(path, false);
 	}
 
+	// A rebuild doesn't wait for the trash, but a clean is only done once it's empty
+	if (!inForRebuild && !Trash::wait())
+		return false;
+
 	if (Files::pathIsEmpty(dirToClean))
 		Files::removeIfExists(dirToClean);
 
@@ -670,6 +817,155 @@ bool BuildManager::doFullBuildFolderClean(const bool inForRebuild)
 	return true;
 }
 
+/*****************************************************************************/
+// With persistScratch, if the scratch directory was cleared (ex: after a reboot), it's copied back from
+//   the snapshot in the build folder - but only if the snapshot was synced after the last build that
+//   changed it
+//
+void BuildManager::restoreScratchDir() const
+{
+	if (!m_state.paths.usesScratchDir())
+		return;
+
+	const auto& scratchDir = m_state.paths.scratchDir();
+	auto snapshotDir = m_state.paths.scratchSnapshotDir();
+	auto snapshotStamp = m_state.paths.scratchSnapshotStamp();
+	if (m_state.info.persistScratch() && !Files::pathExists(scratchDir) && Files::pathExists(snapshotStamp) && Files::pathExists(snapshotDir))
+	{
+		if (Output::showCommands())
+			Output::printCommand(fmt::format("restore: {} -> {}", snapshotDir, scratchDir));
+
+		FileCopier copier;
+		if (!copier.copy(snapshotDir, scratchDir))
+		{
+			Diagnostic::warn("The scratch directory could not be restored from: {}", snapshotDir);
+			Files::removeRecursively(scratchDir);
+		}
+	}
+
+	// The snapshot is out of date as soon as this build changes anything (even if it won't be synced)
+	Files::removeIfExists(snapshotStamp);
+}
+
+/*****************************************************************************/
+// With persistScratch, a successful build syncs the scratch directory to the build folder. Only what
+//   changed since the last sync is copied (by size & last write time), and anything that's no longer in
+//   the scratch directory is removed
+//
+void BuildManager::persistScratchDir() const
+{
+	if (!m_state.paths.usesScratchDir() || !m_state.info.persistScratch())
+		return;
+
+	const auto& scratchDir = m_state.paths.scratchDir();
+	if (!Files::pathExists(scratchDir))
+		return;
+
+	auto snapshotDir = m_state.paths.scratchSnapshotDir();
+	if (Output::showCommands())
+		Output::printCommand(fmt::format("sync: {} -> {}", scratchDir, snapshotDir));
+
+	FileCopier copier;
+	if (!copier.mirror(scratchDir, snapshotDir))
+	{
+		Diagnostic::warn("The scratch directory could not be synced to: {}", snapshotDir);
+		return;
+	}
+
+	Files::createFileWithContents(m_state.paths.scratchSnapshotStamp(), std::string());
+}
+
+/*****************************************************************************/
+// Everything the build read (the build files, the toolchain, the folders the globs walked, and each
+//   target's sources & headers from addToFingerprint) and wrote, so the next build can tell right away
+//   what's still up to date. It's only kept for builds made entirely of source targets, since nothing
+//   else's files are known here
+//
+void BuildManager::recordFingerprint() const
+{
+	if (m_state.toolchain.strategy() != StrategyType::Native || m_state.info.dumpAssembly())
+		return;
+
+	if (!m_state.getCentralState().externalDependencies.empty())
+		return;
+
+	for (auto& target : m_state.targets)
+	{
+		if (!target->isSources() || static_cast<const SourceTarget&>(*target).cppModules())
+			return;
+	}
+
+	auto& fingerprint = m_state.cache.fingerprint();
+
+	auto addIfNotEmpty = [](StringList& outList, const std::string& inFile) {
+		if (!inFile.empty())
+			List::addIfDoesNotExist(outList, inFile);
+	};
+
+	{
+		StringList inputs;
+		addIfNotEmpty(inputs, m_state.inputs.inputFile());
+		addIfNotEmpty(inputs, m_state.cache.getSettings(SettingsType::Local).filename());
+		addIfNotEmpty(inputs, m_state.cache.getSettings(SettingsType::Global).filename());
+		addIfNotEmpty(inputs, m_state.inputs.envFile());
+
+		auto appPath = m_state.inputs.appPath();
+		if (!Files::pathExists(appPath))
+			appPath = Files::which(appPath);
+
+		addIfNotEmpty(inputs, appPath);
+		fingerprint.addGroup("build", std::move(inputs), StringList());
+	}
+	{
+		StringList inputs;
+		addIfNotEmpty(inputs, m_state.toolchain.compilerCpp().path);
+		addIfNotEmpty(inputs, m_state.toolchain.compilerC().path);
+		addIfNotEmpty(inputs, m_state.toolchain.compilerWindowsResource());
+		addIfNotEmpty(inputs, m_state.toolchain.linker());
+		addIfNotEmpty(inputs, m_state.toolchain.archiver());
+		fingerprint.addGroup("toolchain", std::move(inputs), StringList());
+	}
+
+	fingerprint.addGroup("folders", m_state.globs.getFolders(), StringList());
+
+	fingerprint.commit();
+}
+
+/*****************************************************************************/
+void BuildManager::addToFingerprint(const SourceTarget& inProject, const SourceOutputs& inOutputs) const
+{
+	auto& fingerprint = m_state.cache.fingerprint();
+	if (!inProject.willBuild() || fingerprint.keepTarget(inProject.name()))
+		return;
+
+	StringList inputs = inProject.configureFiles();
+	StringList outputs;
+	StringList dependencies;
+
+	if (inProject.usesPrecompiledHeader())
+	{
+		const auto& source = inProject.precompiledHeader();
+		inputs.emplace_back(source);
+		outputs.emplace_back(m_state.paths.getPrecompiledHeaderTarget(inProject));
+		dependencies.emplace_back(m_state.environment->getDependencyFile(source));
+	}
+
+	for (auto& group : inOutputs.groups)
+	{
+		if (!group->sourceFile.empty())
+			inputs.emplace_back(group->sourceFile);
+
+		if (!group->objectFile.empty())
+			outputs.emplace_back(group->objectFile);
+
+		if (!group->dependencyFile.empty())
+			dependencies.emplace_back(group->dependencyFile);
+	}
+
+	outputs.emplace_back(inOutputs.target);
+	fingerprint.addTarget(inProject.name(), std::move(inputs), std::move(outputs), std::move(dependencies));
+}
+
 /*****************************************************************************/
 bool BuildManager::checkIntermediateFiles() const
 {
@@ -694,8 +990,7 @@ bool BuildManager::checkIntermediateFiles() const
 
 		if (!isPlatformProjectBuild && project.unityBuild())
 		{
-			std::string unityBuildFilename;
-			if (!project.generateUnityBuildFile(unityBuildFilename))
+			if (!project.generateUnityBuildFiles())
 				return false;
 		}
 	}
@@ -720,7 +1015,8 @@ bool BuildManager::doSubChaletClean(const SubChaletTarget& inTarget)
 
 	if ((clean || rebuild) && Files::pathExists(targetFolder))
 	{
-		if (!Files::removeRecursively(targetFolder))
+		// A clean waits for the folder to be deleted, so an error is reported with the target
+		if (!Trash::remove(targetFolder, m_state.paths.trashDir()) || (clean && !Trash::wait()))
 		{
 			Diagnostic::error("There was an error rebuilding the '{}' Chalet project.", inTarget.name());
 			return false;
@@ -741,7 +1037,7 @@ bool BuildManager::doCMakeClean(const CMakeTarget& inTarget)
 
 	if ((clean || rebuild) && Files::pathExists(targetFolder))
 	{
-		if (!Files::removeRecursively(targetFolder))
+		if (!Trash::remove(targetFolder, m_state.paths.trashDir()) || (clean && !Trash::wait()))
 		{
 			Diagnostic::error("There was an error cleaning the '{}' CMake project.", inTarget.name());
 			return false;
@@ -762,7 +1058,7 @@ bool BuildManager::doMesonClean(const MesonTarget& inTarget)
 
 	if ((clean || rebuild) && Files::pathExists(targetFolder))
 	{
-		if (!Files::removeRecursively(targetFolder))
+		if (!Trash::remove(targetFolder, m_state.paths.trashDir()) || (clean && !Trash::wait()))
 		{
 			Diagnostic::error("There was an error cleaning the '{}' Meson project.", inTarget.name());
 			return false;
@@ -805,6 +1101,10 @@ bool BuildManager::runScriptTarget(const ScriptBuildTarget& inTarget, const bool
 			Diagnostic::printErrors(true);
 			result = false;
 		}
+		else if (!inRunCommand)
+		{
+			addResourceUsage(inTarget, buildTimer);
+		}
 
 		sourceCache.addDataCache(hash, result);
 
@@ -854,6 +1154,9 @@ bool BuildManager::runProcessTarget(const ProcessBuildTarget& inTarget, const bo
 		result = runProcess(cmd, path, cwd, inRunCommand);
 		sourceCache.addDataCache(hash, result);
 
+		if (!inRunCommand && result)
+			addResourceUsage(inTarget, buildTimer);
+
 		if (!inRunCommand && result)
 			Output::msgTargetUpToDate(inTarget.name(), &buildTimer);
 	}
@@ -1176,7 +1479,10 @@ bool BuildManager::canProcessRun(SourceCache& inSourceCache, const std::string&
 	bool ret = inDepends.empty();
 	for (auto& depends : inDepends)
 	{
-		ret |= inSourceCache.fileChangedOrDoesNotExist(depends);
+		if (inHash.empty())
+			ret |= inSourceCache.fileChangedOrDoesNotExist(depends);
+		else
+			ret |= inSourceCache.fileContentsChangedOrDoesNotExist(depends, inHash);
 	}
 
 	return ret;
@@ -1335,4 +1641,120 @@ bool BuildManager::runFullBuild()
 
 	return true;
 }
-}
\ No newline at end of file
+
+/*****************************************************************************/
+void BuildManager::addResourceUsage(const IBuildTarget& inTarget, Timer& inTimer)
+{
+	if (!m_state.info.resourceUsage())
+		return;
+
+	ResourceUsageReport::Job job;
+	job.name = inTarget.name();
+	job.duration = inTimer.stop();
+	job.usage = SubProcessController::getLastResourceUsage();
+	m_resourceUsage.addJob(std::move(job));
+}
+
+/*****************************************************************************/
+void BuildManager::printResourceUsage()
+{
+	if (m_strategy != nullptr)
+		m_resourceUsage.addTimings(m_strategy->timingCache());
+
+	if (m_resourceUsage.jobs().empty())
+		return;
+
+	constexpr size_t kReportCount = 10;
+	auto text = m_resourceUsage.getText(m_timer.stop(), m_state.info.maxJobs(), kReportCount);
+
+	Output::lineBreak();
+	std::cout.write(text.data(), text.size());
+}
+
+/*****************************************************************************/
+void BuildManager::printExplanation()
+{
+	if (m_strategy == nullptr)
+		return;
+
+	// Ninja explains its decisions as it goes (-d explain)
+	auto& explanation = m_strategy->explanation();
+	if (explanation.empty())
+		return;
+
+	constexpr size_t kExplainCount = 10;
+	auto text = explanation.getText(kExplainCount);
+
+	Output::lineBreak();
+	std::cout.write(text.data(), text.size());
+}
+
+/*****************************************************************************/
+void BuildManager::endHistoryPhase(i64& outDuration)
+{
+	auto now = Trace::now() / 1000;
+	outDuration = now - m_historyPhaseStart;
+	m_historyPhaseStart = now;
+}
+
+/*****************************************************************************/
+void BuildManager::addToHistory(const CommandRoute& inRoute, const bool inSuccess)
+{
+	if (inRoute.isRun() || m_state.isSubChaletTarget())
+		return;
+
+	endHistoryPhase(m_history.postBuild);
+	m_history.total = m_historyPhaseStart;
+	m_history.time = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	m_history.route = inRoute.isRebuild() ? "rebuild" : "build";
+	m_history.configuration = m_state.configuration.name();
+	m_history.toolchain = m_state.inputs.toolchainPreferenceName();
+	m_history.architecture = m_state.info.targetArchitectureString();
+	m_history.success = inSuccess;
+
+	// Object files are the outputs in each target's object folder - the ones updated this build were compiled
+	std::vector<std::pair<std::string, BuildHistory::Target*>> objectDirs;
+	for (auto& target : m_state.targets)
+	{
+		if (!target->isSources())
+			continue;
+
+		for (auto& historyTarget : m_history.targets)
+		{
+			if (String::equals(target->name(), historyTarget.name))
+				objectDirs.emplace_back(m_state.paths.objectDir(static_cast<const SourceTarget&>(*target)) + '/', &historyTarget);
+		}
+	}
+
+	const auto& timingCache = m_strategy->timingCache();
+	const auto& updated = timingCache.updated();
+	for (auto& [outputFile, entry] : timingCache.entries())
+	{
+		bool wasUpdated = updated.find(outputFile) != updated.end();
+		if (wasUpdated)
+			m_history.peakMemory = std::max(m_history.peakMemory, entry.usage.maxResidentSize);
+
+		for (auto& [objectDir, historyTarget] : objectDirs)
+		{
+			if (!String::startsWith(objectDir, outputFile))
+				continue;
+
+			if (wasUpdated)
+				historyTarget->compiled++;
+			else
+				historyTarget->upToDate++;
+			break;
+		}
+	}
+
+	for (auto& target : m_history.targets)
+	{
+		m_history.compiled += target.compiled;
+		m_history.upToDate += target.upToDate;
+	}
+
+	BuildHistory history(m_state.inputs.outputDirectory());
+	if (!history.add(m_history))
+		Diagnostic::warn("The build history could not be saved: {}", history.filename());
+}
+}
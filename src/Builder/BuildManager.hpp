@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Builder/ResourceUsageReport.hpp"
+#include "Cache/BuildHistory.hpp"
 #include "Compile/Strategy/ICompileStrategy.hpp"
 #include "Core/Router/CommandRoute.hpp"
 #include "Terminal/Color.hpp"
@@ -49,6 +51,10 @@ private:
 	bool doCMakeClean(const CMakeTarget& inTarget);
 	bool doMesonClean(const MesonTarget& inTarget);
 	bool doFullBuildFolderClean(const bool inForRebuild);
+	void restoreScratchDir() const;
+	void persistScratchDir() const;
+	void addToFingerprint(const SourceTarget& inProject, const SourceOutputs& inOutputs) const;
+	void recordFingerprint() const;
 
 	bool addProjectToBuild(const SourceTarget& inProject);
 
@@ -74,6 +80,13 @@ private:
 	bool buildMesonTarget(const MesonTarget& inTarget);
 	bool runFullBuild();
 
+	void addResourceUsage(const IBuildTarget& inTarget, Timer& inTimer);
+	void printResourceUsage();
+	void printExplanation();
+
+	void endHistoryPhase(i64& outDuration);
+	void addToHistory(const CommandRoute& inRoute, const bool inSuccess);
+
 	void displayHeader(const char* inLabel, const IBuildTarget& inTarget, const Color inColor, const std::string& inName = std::string()) const;
 
 	BuildState& m_state;
@@ -87,6 +100,11 @@ private:
 	Unique<ICompileStrategy> m_strategy;
 	Unique<AssemblyDumper> m_asmDumper;
 
+	ResourceUsageReport m_resourceUsage;
+	BuildHistory::Record m_history;
+
+	i64 m_historyPhaseStart = 0;
+
 	Timer m_timer;
 
 	// SourceTarget* m_project = nullptr;
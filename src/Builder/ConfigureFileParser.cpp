@@ -125,19 +125,18 @@ bool ConfigureFileParser::run(const std::string& inOutputFolder)
 		bool dependentChanged = embeddedFileCache.find(configureFile) != embeddedFileCache.end();
 		if (configFileChanged || metadataChanged || !pathExists || dependentChanged)
 		{
-			if (configFileChanged || pathExists)
-				Files::removeIfExists(outPath);
+			auto fileContents = Files::getFileContents(configureFile);
+			onReplaceContents(fileContents);
+			if (!fileContents.empty() && fileContents.back() == '\n')
+				fileContents.pop_back(); // last '\n'
 
-			if (!Files::copyRename(configureFile, outPath, true))
-			{
-				Diagnostic::error("There was a problem copying the file: {}", configureFile);
-				result = false;
-				continue;
-			}
+			if (!fileContents.empty() && fileContents.back() == '\r')
+				fileContents.pop_back(); // last '\r'
 
-			if (!Files::readAndReplace(outPath, onReplaceContents))
+			// Only touched if the result is different, so dependent sources don't rebuild needlessly
+			if (!Files::createFileWithContentsIfChanged(outPath, fileContents))
 			{
-				Diagnostic::error("There was a problem parsing the file: {}", configureFile);
+				Diagnostic::error("There was a problem creating the file: {}", outPath);
 				result = false;
 				continue;
 			}
@@ -431,7 +431,7 @@ endian = '{targetEndianness}'
 	// 				String::replaceAll(contents, "/", "\\\\");
 	// #endif
 
-	if (!Files::createFileWithContents(nativeFile, contents))
+	if (!Files::createFileWithContentsIfChanged(nativeFile, contents))
 	{
 		Diagnostic::error("Error creating toolchain file for Meson: {}", nativeFile);
 		return false;
@@ -0,0 +1,167 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Builder/ResourceUsageReport.hpp"
+
+#include "Cache/BuildTimingCache.hpp"
+
+namespace chalet
+{
+namespace
+{
+/*****************************************************************************/
+i64 getCpuTime(const ProcessResourceUsage& inUsage)
+{
+	return inUsage.userTime + inUsage.systemTime;
+}
+
+/*****************************************************************************/
+std::string getSeconds(const i64 inMicroseconds)
+{
+	return fmt::format("{:.2f}s", static_cast<double>(inMicroseconds) / 1000000.0);
+}
+
+/*****************************************************************************/
+std::string getMegabytes(const i64 inKilobytes)
+{
+	return fmt::format("{:.1f} MB", static_cast<double>(inKilobytes) / 1024.0);
+}
+
+/*****************************************************************************/
+std::string getChange(const i64 inValue, const i64 inPrevious)
+{
+	if (inPrevious <= 0)
+		return std::string();
+
+	auto percent = std::llround((static_cast<double>(inValue - inPrevious) / static_cast<double>(inPrevious)) * 100.0);
+	return fmt::format(", {:+}% vs. last build", percent);
+}
+
+/*****************************************************************************/
+template <typename GetValue>
+std::vector<const ResourceUsageReport::Job*> getHighest(const std::vector<ResourceUsageReport::Job>& inJobs, const size_t inCount, const GetValue& getValue)
+{
+	std::vector<const ResourceUsageReport::Job*> ret;
+	for (auto& job : inJobs)
+	{
+		if (getValue(job) > 0)
+			ret.push_back(&job);
+	}
+
+	auto count = std::min(inCount, ret.size());
+	std::partial_sort(ret.begin(), ret.begin() + count, ret.end(), [&getValue](const auto* inA, const auto* inB) {
+		auto a = getValue(*inA);
+		auto b = getValue(*inB);
+		if (a == b)
+			return inA->name < inB->name;
+
+		return a > b;
+	});
+	ret.resize(count);
+
+	return ret;
+}
+}
+
+/*****************************************************************************/
+void ResourceUsageReport::addJob(Job&& inJob)
+{
+	m_jobs.emplace_back(std::move(inJob));
+}
+
+/*****************************************************************************/
+// Only the outputs that were built this time are included
+//
+void ResourceUsageReport::addTimings(const BuildTimingCache& inTimingCache)
+{
+	for (auto& [outputFile, previous] : inTimingCache.updated())
+	{
+		auto& entry = inTimingCache.get(outputFile);
+
+		Job job;
+		job.name = outputFile;
+		job.duration = entry.duration();
+		job.usage = entry.usage;
+		if (previous.has_value() && getCpuTime(previous->usage) > 0)
+			job.previousUsage = previous->usage;
+
+		m_jobs.emplace_back(std::move(job));
+	}
+}
+
+/*****************************************************************************/
+const std::vector<ResourceUsageReport::Job>& ResourceUsageReport::jobs() const noexcept
+{
+	return m_jobs;
+}
+
+/*****************************************************************************/
+std::string ResourceUsageReport::getText(const i64 inBuildDuration, const u32 inMaxJobs, const size_t inCount) const
+{
+	std::string ret;
+
+	i64 wallTime = 0;
+	i64 userTime = 0;
+	i64 systemTime = 0;
+	i64 majorFaults = 0;
+	i64 contextSwitches = 0;
+	i64 comparedCpuTime = 0;
+	i64 previousCpuTime = 0;
+	size_t compared = 0;
+	for (auto& job : m_jobs)
+	{
+		wallTime += job.duration * 1000;
+		userTime += job.usage.userTime;
+		systemTime += job.usage.systemTime;
+		majorFaults += job.usage.majorFaults;
+		contextSwitches += job.usage.contextSwitches;
+
+		if (job.previousUsage.has_value())
+		{
+			comparedCpuTime += getCpuTime(job.usage);
+			previousCpuTime += getCpuTime(*job.previousUsage);
+			++compared;
+		}
+	}
+
+	const i64 buildTime = std::max<i64>(inBuildDuration, 1) * 1000;
+	const auto parallelism = static_cast<double>(wallTime) / static_cast<double>(buildTime);
+	const auto cpuParallelism = static_cast<double>(userTime + systemTime) / static_cast<double>(buildTime);
+
+	ret += fmt::format("**** Resource usage of {} commands:\n", m_jobs.size());
+	ret += fmt::format("   Build time: {}, command time: {} ({:.1f}x parallelism of {} jobs)\n", getSeconds(buildTime), getSeconds(wallTime), parallelism, inMaxJobs);
+	ret += fmt::format("   CPU time: {} (user {}, system {}, {:.1f} cores busy)\n", getSeconds(userTime + systemTime), getSeconds(userTime), getSeconds(systemTime), cpuParallelism);
+	ret += fmt::format("   Major page faults: {}, context switches: {}\n", majorFaults, contextSwitches);
+	if (compared > 0)
+		ret += fmt::format("   CPU time of the {} commands built before: {}{}\n", compared, getSeconds(comparedCpuTime), getChange(comparedCpuTime, previousCpuTime));
+
+	ret += '\n';
+
+	auto addSection = [&ret](const char* inTitle, const std::vector<const Job*>& inJobs, const auto& getText) {
+		ret += fmt::format("**** {} ({}):\n", inTitle, inJobs.size());
+		for (auto job : inJobs)
+		{
+			ret += getText(*job);
+			ret += '\n';
+		}
+		ret += '\n';
+	};
+
+	addSection("Commands that took longest", getHighest(m_jobs, inCount, [](const Job& inJob) { return inJob.duration; }), [](const Job& inJob) {
+		return fmt::format("{:>9}: {} (cpu {})", getSeconds(inJob.duration * 1000), inJob.name, getSeconds(getCpuTime(inJob.usage)));
+	});
+	addSection("Commands that used the most CPU", getHighest(m_jobs, inCount, [](const Job& inJob) { return getCpuTime(inJob.usage); }), [](const Job& inJob) {
+		auto cpuTime = getCpuTime(inJob.usage);
+		auto change = inJob.previousUsage.has_value() ? getChange(cpuTime, getCpuTime(*inJob.previousUsage)) : std::string();
+		return fmt::format("{:>9}: {} (user {}, system {}{})", getSeconds(cpuTime), inJob.name, getSeconds(inJob.usage.userTime), getSeconds(inJob.usage.systemTime), change);
+	});
+	addSection("Commands that used the most memory", getHighest(m_jobs, inCount, [](const Job& inJob) { return inJob.usage.maxResidentSize; }), [](const Job& inJob) {
+		auto change = inJob.previousUsage.has_value() ? getChange(inJob.usage.maxResidentSize, inJob.previousUsage->maxResidentSize) : std::string();
+		return fmt::format("{:>9}: {} ({} major faults{})", getMegabytes(inJob.usage.maxResidentSize), inJob.name, inJob.usage.majorFaults, change);
+	});
+
+	return ret;
+}
+}
@@ -0,0 +1,39 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "Process/ProcessResourceUsage.hpp"
+
+namespace chalet
+{
+class BuildTimingCache;
+
+// Summarizes what each command of a build used, compared to the last time the same command ran
+//   (for sizing machines & choosing maxJobs)
+//
+struct ResourceUsageReport
+{
+	struct Job
+	{
+		std::string name;
+		i64 duration = 0; // milliseconds
+		ProcessResourceUsage usage;
+		std::optional<ProcessResourceUsage> previousUsage;
+	};
+
+	ResourceUsageReport() = default;
+
+	void addJob(Job&& inJob);
+	void addTimings(const BuildTimingCache& inTimingCache);
+
+	const std::vector<Job>& jobs() const noexcept;
+
+	std::string getText(const i64 inBuildDuration, const u32 inMaxJobs, const size_t inCount) const;
+
+private:
+	std::vector<Job> m_jobs;
+};
+}
@@ -102,7 +102,10 @@ bool ScriptRunner::shouldRun(SourceCache& inSourceCache, const std::string& inHa
 	bool ret = inDepends.empty();
 	for (auto& depends : inDepends)
 	{
-		ret |= inSourceCache.fileChangedOrDoesNotExist(depends);
+		if (inHash.empty())
+			ret |= inSourceCache.fileChangedOrDoesNotExist(depends);
+		else
+			ret |= inSourceCache.fileContentsChangedOrDoesNotExist(depends, inHash);
 	}
 
 	return ret;
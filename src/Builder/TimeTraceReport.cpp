@@ -0,0 +1,295 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Builder/TimeTraceReport.hpp"
+
+#include "Libraries/ThreadPool.hpp"
+#include "State/BuildInfo.hpp"
+#include "State/BuildPaths.hpp"
+#include "State/BuildState.hpp"
+#include "State/Target/SourceTarget.hpp"
+#include "System/Files.hpp"
+#include "Terminal/Output.hpp"
+#include "Utility/List.hpp"
+#include "Utility/String.hpp"
+#include "Json/JsonFile.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr size_t kReportCount = 10;
+
+/*****************************************************************************/
+void addToEntry(Dictionary<TimeTraceReport::Entry>& outEntries, const std::string& inName, const i64 inDuration)
+{
+	auto& entry = outEntries[inName];
+	entry.duration += inDuration;
+	entry.count++;
+}
+
+/*****************************************************************************/
+std::vector<std::pair<std::string, TimeTraceReport::Entry>> getSlowest(const Dictionary<TimeTraceReport::Entry>& inEntries, const size_t inCount)
+{
+	std::vector<std::pair<std::string, TimeTraceReport::Entry>> ret(inEntries.begin(), inEntries.end());
+
+	auto count = std::min(inCount, ret.size());
+	std::partial_sort(ret.begin(), ret.begin() + count, ret.end(), [](const auto& inA, const auto& inB) {
+		if (inA.second.duration == inB.second.duration)
+			return inA.first < inB.first;
+
+		return inA.second.duration > inB.second.duration;
+	});
+	ret.resize(count);
+
+	return ret;
+}
+
+/*****************************************************************************/
+void mergeEntries(const Dictionary<TimeTraceReport::Entry>& inEntries, Dictionary<TimeTraceReport::Entry>& outEntries)
+{
+	for (auto& [name, entry] : inEntries)
+	{
+		auto& outEntry = outEntries[name];
+		outEntry.duration += entry.duration;
+		outEntry.count += entry.count;
+	}
+}
+}
+
+/*****************************************************************************/
+TimeTraceReport::TimeTraceReport(const BuildState& inState) :
+	m_state(inState)
+{
+}
+
+/*****************************************************************************/
+bool TimeTraceReport::generate()
+{
+	auto traceFiles = getTraceFiles();
+	if (traceFiles.empty())
+	{
+		Diagnostic::warn("No -ftime-trace output was found in: {}", m_state.paths.buildOutputDir());
+		return true;
+	}
+
+	Totals totals;
+	{
+		ThreadPool threadPool(m_state.info.maxJobs());
+
+		std::vector<std::future<Totals>> results;
+		for (auto& file : traceFiles)
+		{
+			results.emplace_back(threadPool.enqueue([](const std::string& inFilename) {
+				Totals fileTotals;
+				readTraceFile(inFilename, fileTotals);
+				return fileTotals;
+			},
+				file));
+		}
+
+		for (auto& result : results)
+		{
+			merge(result.get(), totals);
+		}
+	}
+
+	const auto& buildOutputDir = m_state.paths.buildOutputDir();
+	auto textFile = fmt::format("{}/time-trace-report.txt", buildOutputDir);
+	auto jsonFile = fmt::format("{}/time-trace-report.json", buildOutputDir);
+
+	auto text = getText(totals, kReportCount);
+	if (!Files::createFileWithContents(textFile, text))
+		return false;
+
+	if (!JsonFile::saveToFile(getJson(totals, kReportCount), jsonFile, 1))
+		return false;
+
+	Output::lineBreak();
+	std::cout.write(text.data(), text.size());
+	Output::printInfo(fmt::format("   Time trace report ({} files): {}", traceFiles.size(), textFile));
+	Output::lineBreak();
+
+	return true;
+}
+
+/*****************************************************************************/
+// Clang writes the trace next to the object file, replacing its extension (file.cpp.o -> file.cpp.json),
+//   so only the object folders are searched - they may be in the scratch directory, and the snapshot of
+//   it in the build folder is never looked at
+//
+StringList TimeTraceReport::getTraceFiles() const
+{
+	StringList ret;
+
+	StringList objectDirs;
+	for (auto& target : m_state.targets)
+	{
+		if (target->isSources())
+			List::addIfDoesNotExist(objectDirs, m_state.paths.objectDir(static_cast<const SourceTarget&>(*target)));
+	}
+
+	for (auto& objectDir : objectDirs)
+	{
+		if (!Files::pathIsDirectory(objectDir))
+			continue;
+
+		std::error_code error;
+		for (auto it = fs::recursive_directory_iterator(objectDir, error); it != fs::recursive_directory_iterator(); it.increment(error))
+		{
+			if (error)
+				break;
+
+			if (!it->is_regular_file(error))
+				continue;
+
+			auto path = it->path().generic_string();
+			if (!String::endsWith(".json", path))
+				continue;
+
+			auto objectFile = fmt::format("{}.o", path.substr(0, path.size() - 5));
+			if (Files::pathExists(objectFile))
+				ret.emplace_back(std::move(path));
+		}
+	}
+
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+/*****************************************************************************/
+bool TimeTraceReport::readTraceFile(const std::string& inFilename, Totals& outTotals)
+{
+	auto stream = Files::ifstream(inFilename);
+	if (!stream.good())
+		return false;
+
+	Json json = Json::parse(stream, nullptr, false);
+	if (json.is_discarded() || !json.is_object())
+		return false;
+
+	auto traceEvents = json.find("traceEvents");
+	if (traceEvents == json.end() || !traceEvents->is_array())
+		return false;
+
+	auto sourceFile = inFilename.substr(0, inFilename.size() - 5);
+
+	for (auto& event : *traceEvents)
+	{
+		if (!event.is_object())
+			continue;
+
+		auto phase = event.find("ph");
+		auto name = event.find("name");
+		auto duration = event.find("dur");
+		if (phase == event.end() || name == event.end() || duration == event.end())
+			continue;
+
+		if (!phase->is_string() || !name->is_string() || !duration->is_number())
+			continue;
+
+		if (!String::equals("X", phase->get_ref<const std::string&>()))
+			continue;
+
+		const auto& eventName = name->get_ref<const std::string&>();
+		auto eventDuration = duration->get<i64>();
+
+		if (String::equals("ExecuteCompiler", eventName))
+		{
+			addToEntry(outTotals.files, sourceFile, eventDuration);
+			continue;
+		}
+
+		auto args = event.find("args");
+		if (args == event.end() || !args->is_object())
+			continue;
+
+		auto detailNode = args->find("detail");
+		if (detailNode == args->end() || !detailNode->is_string())
+			continue;
+
+		const auto& detail = detailNode->get_ref<const std::string&>();
+		if (String::equals("Source", eventName))
+		{
+			addToEntry(outTotals.headers, detail, eventDuration);
+		}
+		else if (String::equals({ "InstantiateClass", "InstantiateFunction" }, eventName))
+		{
+			addToEntry(outTotals.instantiations, detail, eventDuration);
+			addToEntry(outTotals.templateSets, detail.substr(0, detail.find('<')), eventDuration);
+		}
+		else if (String::equals({ "OptFunction", "CodeGen Function" }, eventName))
+		{
+			addToEntry(outTotals.functions, detail, eventDuration);
+		}
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+void TimeTraceReport::merge(const Totals& inTotals, Totals& outTotals)
+{
+	mergeEntries(inTotals.files, outTotals.files);
+	mergeEntries(inTotals.headers, outTotals.headers);
+	mergeEntries(inTotals.instantiations, outTotals.instantiations);
+	mergeEntries(inTotals.templateSets, outTotals.templateSets);
+	mergeEntries(inTotals.functions, outTotals.functions);
+}
+
+/*****************************************************************************/
+std::string TimeTraceReport::getText(const Totals& inTotals, const size_t inCount)
+{
+	std::string ret;
+
+	auto addSection = [&ret, &inCount](const char* inTitle, const Dictionary<Entry>& inEntries, const bool inShowCount) {
+		auto slowest = getSlowest(inEntries, inCount);
+		ret += fmt::format("**** {} ({}):\n", inTitle, slowest.size());
+		for (auto& [name, entry] : slowest)
+		{
+			auto milliseconds = entry.duration / 1000;
+			if (inShowCount && entry.count > 1)
+				ret += fmt::format("{:>7} ms: {} ({} times, avg {} ms)\n", milliseconds, name, entry.count, milliseconds / entry.count);
+			else
+				ret += fmt::format("{:>7} ms: {}\n", milliseconds, name);
+		}
+		ret += '\n';
+	};
+
+	addSection("Files that took longest to compile", inTotals.files, false);
+	addSection("Headers that took longest to parse", inTotals.headers, true);
+	addSection("Templates that took longest to instantiate", inTotals.instantiations, true);
+	addSection("Template sets that took longest to instantiate", inTotals.templateSets, true);
+	addSection("Functions that took longest to compile", inTotals.functions, true);
+
+	return ret;
+}
+
+/*****************************************************************************/
+Json TimeTraceReport::getJson(const Totals& inTotals, const size_t inCount)
+{
+	auto getSection = [&inCount](const Dictionary<Entry>& inEntries) {
+		Json ret = Json::array();
+		for (auto& [name, entry] : getSlowest(inEntries, inCount))
+		{
+			Json node = Json::object();
+			node["name"] = name;
+			node["milliseconds"] = entry.duration / 1000;
+			node["count"] = entry.count;
+			ret.push_back(std::move(node));
+		}
+		return ret;
+	};
+
+	Json ret = Json::object();
+	ret["files"] = getSection(inTotals.files);
+	ret["headers"] = getSection(inTotals.headers);
+	ret["instantiations"] = getSection(inTotals.instantiations);
+	ret["templateSets"] = getSection(inTotals.templateSets);
+	ret["functions"] = getSection(inTotals.functions);
+
+	return ret;
+}
+}
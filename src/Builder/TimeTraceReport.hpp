@@ -0,0 +1,49 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "Libraries/Json.hpp"
+
+namespace chalet
+{
+class BuildState;
+
+// Merges the -ftime-trace output of every object file in the build into one summary
+//   of the slowest files, headers, template instantiations & functions (like ClangBuildAnalyzer)
+//
+struct TimeTraceReport
+{
+	struct Entry
+	{
+		i64 duration = 0; // microseconds
+		u32 count = 0;
+	};
+
+	struct Totals
+	{
+		Dictionary<Entry> files;
+		Dictionary<Entry> headers;
+		Dictionary<Entry> instantiations;
+		Dictionary<Entry> templateSets;
+		Dictionary<Entry> functions;
+	};
+
+	explicit TimeTraceReport(const BuildState& inState);
+
+	bool generate();
+
+	static bool readTraceFile(const std::string& inFilename, Totals& outTotals);
+	static void merge(const Totals& inTotals, Totals& outTotals);
+
+	static std::string getText(const Totals& inTotals, const size_t inCount);
+	static Json getJson(const Totals& inTotals, const size_t inCount);
+
+private:
+	StringList getTraceFiles() const;
+
+	const BuildState& m_state;
+};
+}
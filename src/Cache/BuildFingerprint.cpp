@@ -0,0 +1,457 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Cache/BuildFingerprint.hpp"
+
+#include <ctime>
+
+#include "Core/CommandLineInputs.hpp"
+#include "Process/Environment.hpp"
+#include "System/BatchStat.hpp"
+#include "System/DefinesVersion.hpp"
+#include "System/Files.hpp"
+#include "Utility/Hash.hpp"
+#include "Utility/List.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr const char kFingerprintHeader[] = "# chalet fingerprint v1";
+
+/*****************************************************************************/
+std::string getOptionString(const std::optional<bool>& inValue)
+{
+	if (!inValue.has_value())
+		return std::string();
+
+	return *inValue ? "1" : "0";
+}
+
+/*****************************************************************************/
+// The value of each ${env:NAME} the file references - the build file isn't read when the build is
+//   skipped, so a variable it uses has to be part of the key
+//
+void addEnvironmentReferences(StringList& outValues, const std::string& inFile)
+{
+	if (inFile.empty())
+		return;
+
+	constexpr std::string_view kEnvPrefix = "${env:";
+
+	auto contents = Files::getFileContents(inFile);
+	StringList names;
+
+	size_t start = contents.find(kEnvPrefix);
+	while (start != std::string::npos)
+	{
+		start += kEnvPrefix.size();
+
+		auto end = contents.find('}', start);
+		if (end == std::string::npos)
+			break;
+
+		auto name = contents.substr(start, end - start);
+		if (!name.empty() && List::addIfDoesNotExist(names, name))
+			outValues.emplace_back(fmt::format("{}={}", name, Environment::getString(name.c_str())));
+
+		start = contents.find(kEnvPrefix, end);
+	}
+}
+}
+
+/*****************************************************************************/
+BuildFingerprint::BuildFingerprint() :
+	m_startTime(static_cast<i64>(std::time(nullptr)))
+{
+}
+
+/*****************************************************************************/
+std::string BuildFingerprint::getKey(const CommandLineInputs& inInputs)
+{
+	StringList values{
+		std::string(CHALET_VERSION),
+		inInputs.inputFile(),
+		inInputs.settingsFile(),
+		inInputs.envFile(),
+		inInputs.outputDirectory(),
+		inInputs.scratchDirectory(),
+		inInputs.externalDirectory(),
+		inInputs.buildConfiguration(),
+		inInputs.toolchainPreferenceName(),
+		inInputs.architectureRaw(),
+		inInputs.buildStrategyPreference(),
+		inInputs.buildPathStylePreference(),
+		inInputs.osTargetName(),
+		inInputs.osTargetVersion(),
+		inInputs.lastTarget(),
+		getOptionString(inInputs.onlyRequired()),
+		getOptionString(inInputs.dumpAssembly()),
+		getOptionString(inInputs.generateCompileCommands()),
+		getOptionString(inInputs.compilerCache()),
+		getOptionString(inInputs.fastLinker()),
+		getOptionString(inInputs.persistScratch()),
+		getOptionString(inInputs.timeTrace()),
+		Environment::getPath(),
+	};
+	addEnvironmentReferences(values, inInputs.inputFile());
+	addEnvironmentReferences(values, inInputs.settingsFile());
+
+	return Hash::string(String::join(values, '\n'));
+}
+
+/*****************************************************************************/
+bool BuildFingerprint::loadFromPath(const std::string& inFilename)
+{
+	m_filename = inFilename;
+	m_lastKey.clear();
+	m_groups.clear();
+	m_targets.clear();
+	m_unchanged.clear();
+	m_root = 0;
+	m_upToDate = false;
+
+	if (!Files::pathExists(m_filename))
+		return true;
+
+	auto stream = Files::ifstream(m_filename);
+
+	std::string line;
+	if (!std::getline(stream, line) || !String::equals(kFingerprintHeader, line))
+		return true;
+
+	// k\t<key>
+	// r\t<root hash>
+	// g\t<hash>\t<name> for a group, t\t<hash>\t<name> for a target, followed by its files:
+	// i\t<path> for an input, o\t<path> for an output
+	Group* group = nullptr;
+	while (std::getline(stream, line))
+	{
+		if (line.size() < 2 || line[1] != '\t')
+			continue;
+
+		switch (line[0])
+		{
+			case 'k':
+				m_lastKey = line.substr(2);
+				break;
+			case 'r':
+				m_root = static_cast<size_t>(std::strtoull(line.c_str() + 2, nullptr, 10));
+				break;
+			case 'g':
+			case 't': {
+				auto end = line.find('\t', 2);
+				if (end == std::string::npos)
+				{
+					group = nullptr;
+					break;
+				}
+
+				group = &m_groups.emplace_back();
+				group->hash = static_cast<size_t>(std::strtoull(line.c_str() + 2, nullptr, 10));
+				group->name = line.substr(end + 1);
+				group->isTarget = line[0] == 't';
+
+				if (group->isTarget)
+					m_targets.emplace_back(group->name);
+				break;
+			}
+			case 'i':
+				if (group != nullptr)
+					group->inputs.emplace_back(line.substr(2));
+				break;
+			case 'o':
+				if (group != nullptr)
+					group->outputs.emplace_back(line.substr(2));
+				break;
+			default:
+				break;
+		}
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+bool BuildFingerprint::save()
+{
+	if (m_filename.empty() || m_state == State::None)
+		return false;
+
+	if (m_state != State::Committed)
+	{
+		Files::removeIfExists(m_filename);
+		m_state = State::None;
+		return true;
+	}
+
+	m_state = State::None;
+
+	for (auto& group : m_recorded)
+		addDependencies(group);
+
+	auto lastWrites = getLastWriteTimes(m_recorded);
+
+	// An input written after the build started may or may not have made it into the build, so the
+	//   build can't vouch for it (this also catches a write in the same second as the last one)
+	for (auto& group : m_recorded)
+	{
+		for (auto& input : group.inputs)
+		{
+			if (lastWrites.at(input) >= m_startTime)
+			{
+				Files::removeIfExists(m_filename);
+				return true;
+			}
+		}
+	}
+
+	std::string contents(kFingerprintHeader);
+	contents += '\n';
+
+	for (auto& group : m_recorded)
+		group.hash = getGroupHash(group, lastWrites);
+
+	m_root = getRootHash(m_key, m_recorded);
+	contents += fmt::format("k\t{}\nr\t{}\n", m_key, m_root);
+
+	for (auto& group : m_recorded)
+	{
+		contents += fmt::format("{}\t{}\t{}\n", group.isTarget ? 't' : 'g', group.hash, group.name);
+		for (auto& input : group.inputs)
+			contents += fmt::format("i\t{}\n", input);
+
+		for (auto& output : group.outputs)
+			contents += fmt::format("o\t{}\n", output);
+	}
+
+	Files::ofstream(m_filename, std::ios_base::binary | std::ios_base::out) << contents;
+
+	m_groups = std::move(m_recorded);
+	m_recorded.clear();
+	m_lastKey = m_key;
+
+	return true;
+}
+
+/*****************************************************************************/
+void BuildFingerprint::setKey(std::string&& inKey) noexcept
+{
+	m_key = std::move(inKey);
+}
+
+/*****************************************************************************/
+bool BuildFingerprint::check()
+{
+	m_unchanged.clear();
+	m_upToDate = false;
+
+	if (m_groups.empty() || m_key.empty() || !String::equals(m_lastKey, m_key))
+		return false;
+
+	auto lastWrites = getLastWriteTimes(m_groups);
+
+	std::vector<Group> current;
+	current.reserve(m_groups.size());
+
+	// A target is only as unchanged as everything before it (the build files, the toolchain, the
+	//   targets it could link with), so they stop counting at the first group that changed
+	bool unchanged = true;
+	for (auto& group : m_groups)
+	{
+		auto& next = current.emplace_back();
+		next.name = group.name;
+		next.hash = getGroupHash(group, lastWrites);
+
+		unchanged &= next.hash == group.hash;
+		if (unchanged && group.isTarget)
+			m_unchanged.emplace(group.name);
+	}
+
+	m_upToDate = getRootHash(m_key, current) == m_root;
+	return m_upToDate;
+}
+
+/*****************************************************************************/
+bool BuildFingerprint::upToDate() const noexcept
+{
+	return m_upToDate;
+}
+
+/*****************************************************************************/
+bool BuildFingerprint::isUnchanged(const std::string& inTarget) const
+{
+	return m_unchanged.find(inTarget) != m_unchanged.end();
+}
+
+/*****************************************************************************/
+const StringList& BuildFingerprint::targets() const noexcept
+{
+	return m_targets;
+}
+
+/*****************************************************************************/
+void BuildFingerprint::invalidate()
+{
+	m_groups.clear();
+	m_recorded.clear();
+	m_recordedTargets.clear();
+	m_unchanged.clear();
+	m_upToDate = false;
+	m_state = State::Invalid;
+}
+
+/*****************************************************************************/
+void BuildFingerprint::begin()
+{
+	m_recorded.clear();
+	m_recordedTargets.clear();
+	m_state = State::Recording;
+}
+
+/*****************************************************************************/
+void BuildFingerprint::addGroup(const std::string& inName, StringList&& inInputs, StringList&& inOutputs)
+{
+	auto& group = m_recorded.emplace_back();
+	group.name = inName;
+	group.inputs = std::move(inInputs);
+	group.outputs = std::move(inOutputs);
+}
+
+/*****************************************************************************/
+void BuildFingerprint::addTarget(const std::string& inName, StringList&& inInputs, StringList&& inOutputs, StringList&& inDependencies)
+{
+	if (m_state != State::Recording)
+		return;
+
+	auto& group = m_recordedTargets.emplace_back();
+	group.name = inName;
+	group.inputs = std::move(inInputs);
+	group.outputs = std::move(inOutputs);
+	group.dependencies = std::move(inDependencies);
+	group.isTarget = true;
+}
+
+/*****************************************************************************/
+// The target's files are the same as last time, so there's no need to look them up again
+//
+bool BuildFingerprint::keepTarget(const std::string& inName)
+{
+	if (m_state != State::Recording || !isUnchanged(inName))
+		return false;
+
+	for (auto& group : m_groups)
+	{
+		if (group.isTarget && String::equals(inName, group.name))
+		{
+			m_recordedTargets.emplace_back(group);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*****************************************************************************/
+void BuildFingerprint::commit()
+{
+	if (m_state != State::Recording || m_key.empty())
+		return;
+
+	// The targets always come after everything they depend on
+	for (auto& group : m_recordedTargets)
+		m_recorded.emplace_back(std::move(group));
+
+	m_recordedTargets.clear();
+	m_state = State::Committed;
+}
+
+/*****************************************************************************/
+size_t BuildFingerprint::getRootHash(const std::string& inKey, const std::vector<Group>& inGroups)
+{
+	std::string contents = inKey;
+	contents += '\n';
+
+	for (auto& group : inGroups)
+		contents += fmt::format("{}\t{}\n", group.hash, group.name);
+
+	return Hash::uint64(contents);
+}
+
+/*****************************************************************************/
+size_t BuildFingerprint::getGroupHash(const Group& inGroup, const Dictionary<i64>& inLastWrites)
+{
+	std::string contents;
+	for (auto& input : inGroup.inputs)
+		contents += fmt::format("i\t{}\t{}\n", inLastWrites.at(input), input);
+
+	for (auto& output : inGroup.outputs)
+		contents += fmt::format("o\t{}\t{}\n", inLastWrites.at(output), output);
+
+	return Hash::uint64(contents);
+}
+
+/*****************************************************************************/
+// The headers a dependency file lists, each on a line of its own ending with ':' - the dependency files
+//   themselves are outputs
+//
+void BuildFingerprint::addDependencies(Group& outGroup)
+{
+	if (outGroup.dependencies.empty())
+		return;
+
+	std::unordered_set<std::string> added(outGroup.inputs.begin(), outGroup.inputs.end());
+
+	std::string line;
+	for (auto& dependency : outGroup.dependencies)
+	{
+		auto input = Files::ifstream(dependency);
+		if (!input.is_open())
+			continue;
+
+		auto lineEnd = input.widen('\n');
+		while (std::getline(input, line, lineEnd))
+		{
+			if (line.empty() || line.back() != ':')
+				continue;
+
+			line.pop_back();
+			if (added.emplace(line).second)
+				outGroup.inputs.emplace_back(std::move(line));
+		}
+
+		outGroup.outputs.emplace_back(std::move(dependency));
+	}
+
+	outGroup.dependencies.clear();
+}
+
+/*****************************************************************************/
+Dictionary<i64> BuildFingerprint::getLastWriteTimes(const std::vector<Group>& inGroups)
+{
+	StringList files;
+	Dictionary<i64> ret;
+	auto addFile = [&files, &ret](const std::string& inFile) {
+		if (ret.emplace(inFile, -1).second)
+			files.emplace_back(inFile);
+	};
+
+	for (auto& group : inGroups)
+	{
+		for (auto& input : group.inputs)
+			addFile(input);
+
+		for (auto& output : group.outputs)
+			addFile(output);
+	}
+
+	auto lastWriteTimes = BatchStat::getLastWriteTimes(files);
+	for (size_t i = 0; i < files.size(); ++i)
+		ret[files[i]] = lastWriteTimes[i];
+
+	return ret;
+}
+}
@@ -0,0 +1,89 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+struct CommandLineInputs;
+
+// The last write times of everything the last build read & wrote, as a two-level Merkle tree - the build
+//   files & settings, the toolchain, the source folders and each target are a group with its own hash, and
+//   the root hash covers all of them. If the root matches, nothing needs to be checked any further, and if
+//   it doesn't, a target whose group (and every group before it) matches is still up to date
+//
+class BuildFingerprint
+{
+public:
+	BuildFingerprint();
+
+	// Everything from the command line & settings that changes what gets built, including the environment
+	//   variables the build file uses
+	static std::string getKey(const CommandLineInputs& inInputs);
+
+	bool loadFromPath(const std::string& inFilename);
+	bool save();
+
+	void setKey(std::string&& inKey) noexcept;
+
+	bool check();
+	bool upToDate() const noexcept;
+	bool isUnchanged(const std::string& inTarget) const;
+	const StringList& targets() const noexcept;
+
+	// The last build's files can't be compared anymore (ie. the build folder was removed)
+	void invalidate();
+
+	// Only a build that recorded everything it used gets saved - otherwise, the previous one is removed
+	void begin();
+	void addGroup(const std::string& inName, StringList&& inInputs, StringList&& inOutputs);
+	bool keepTarget(const std::string& inName);
+	void commit();
+
+	// The headers the dependency files list are only read once the target is built
+	void addTarget(const std::string& inName, StringList&& inInputs, StringList&& inOutputs, StringList&& inDependencies);
+
+private:
+	struct Group
+	{
+		std::string name;
+		StringList inputs;
+		StringList outputs;
+		StringList dependencies;
+		size_t hash = 0;
+		bool isTarget = false;
+	};
+
+	enum class State : u16
+	{
+		None,
+		Recording,
+		Committed,
+		Invalid,
+	};
+
+	static size_t getRootHash(const std::string& inKey, const std::vector<Group>& inGroups);
+	static size_t getGroupHash(const Group& inGroup, const Dictionary<i64>& inLastWrites);
+	static Dictionary<i64> getLastWriteTimes(const std::vector<Group>& inGroups);
+	static void addDependencies(Group& outGroup);
+
+	std::string m_filename;
+	std::string m_key;
+	std::string m_lastKey;
+
+	std::vector<Group> m_groups;
+	std::vector<Group> m_recorded;
+	std::vector<Group> m_recordedTargets;
+
+	StringList m_targets;
+	std::unordered_set<std::string> m_unchanged;
+
+	i64 m_startTime = 0;
+	size_t m_root = 0;
+
+	State m_state = State::None;
+	bool m_upToDate = false;
+};
+}
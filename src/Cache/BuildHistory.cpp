@@ -0,0 +1,242 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Cache/BuildHistory.hpp"
+
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+// Once there are this many builds, only the most recent half are kept
+constexpr size_t kMaxRecords = 1000;
+
+// Roughly the size of kMaxRecords builds, so the file isn't read on every build just to count them
+constexpr std::streamoff kMaxFileSize = kMaxRecords * 512;
+
+/*****************************************************************************/
+i64 getInt(const Json& inNode, const char* inKey)
+{
+	auto it = inNode.find(inKey);
+	if (it == inNode.end() || !it->is_number_integer())
+		return 0;
+
+	return it->get<i64>();
+}
+
+/*****************************************************************************/
+std::string getString(const Json& inNode, const char* inKey)
+{
+	auto it = inNode.find(inKey);
+	if (it == inNode.end() || !it->is_string())
+		return std::string();
+
+	return it->get<std::string>();
+}
+}
+
+/*****************************************************************************/
+BuildHistory::BuildHistory(const std::string& inPath) :
+	m_filename(fmt::format("{}/.chalethistory", inPath))
+{
+}
+
+/*****************************************************************************/
+bool BuildHistory::load()
+{
+	m_records.clear();
+
+	if (!Files::pathExists(m_filename))
+		return true;
+
+	auto stream = Files::ifstream(m_filename);
+
+	std::string line;
+	while (std::getline(stream, line))
+	{
+		if (line.empty())
+			continue;
+
+		// A line could be cut short if chalet was interrupted while writing it
+		Json json = Json::parse(line, nullptr, false);
+		if (json.is_discarded() || !json.is_object())
+			continue;
+
+		Record record;
+		if (fromJson(json, record))
+			m_records.emplace_back(std::move(record));
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+bool BuildHistory::add(const Record& inRecord)
+{
+	auto folder = String::getPathFolder(m_filename);
+	if (!folder.empty() && !Files::pathExists(folder))
+	{
+		if (!Files::makeDirectory(folder))
+			return false;
+	}
+
+	// If the last build was interrupted mid-write, start on a new line so only that record is lost
+	bool needsNewline = false;
+	{
+		auto stream = Files::ifstream(m_filename, std::ios_base::binary | std::ios_base::in | std::ios_base::ate);
+		if (stream.good() && stream.tellg() > 0)
+		{
+			stream.seekg(-1, std::ios_base::end);
+			needsNewline = stream.get() != '\n';
+		}
+	}
+
+	std::streamoff fileSize = 0;
+	{
+		auto stream = Files::ofstream(m_filename, std::ios_base::binary | std::ios_base::out | std::ios_base::app);
+		if (!stream.good())
+			return false;
+
+		if (needsNewline)
+			stream << '\n';
+
+		stream << toJson(inRecord).dump() << '\n';
+		fileSize = stream.tellp();
+	}
+
+	if (fileSize > kMaxFileSize)
+		return trim();
+
+	return true;
+}
+
+/*****************************************************************************/
+bool BuildHistory::trim()
+{
+	if (!load())
+		return false;
+
+	if (m_records.size() < kMaxRecords)
+		return true;
+
+	m_records.erase(m_records.begin(), m_records.end() - (kMaxRecords / 2));
+
+	std::string contents;
+	for (auto& record : m_records)
+	{
+		contents += toJson(record).dump();
+		contents += '\n';
+	}
+
+	Files::ofstream(m_filename, std::ios_base::binary | std::ios_base::out) << contents;
+
+	return true;
+}
+
+/*****************************************************************************/
+const std::string& BuildHistory::filename() const noexcept
+{
+	return m_filename;
+}
+
+/*****************************************************************************/
+const std::vector<BuildHistory::Record>& BuildHistory::records() const noexcept
+{
+	return m_records;
+}
+
+/*****************************************************************************/
+Json BuildHistory::toJson(const Record& inRecord)
+{
+	Json ret = Json::object();
+	ret["time"] = inRecord.time;
+	ret["route"] = inRecord.route;
+	ret["configuration"] = inRecord.configuration;
+	ret["toolchain"] = inRecord.toolchain;
+	ret["architecture"] = inRecord.architecture;
+	ret["success"] = inRecord.success;
+
+	Json phases = Json::object();
+	phases["initialize"] = inRecord.initialize;
+	phases["prepare"] = inRecord.prepare;
+	phases["build"] = inRecord.build;
+	phases["postBuild"] = inRecord.postBuild;
+	phases["total"] = inRecord.total;
+	ret["phases"] = std::move(phases);
+
+	ret["compiled"] = inRecord.compiled;
+	ret["upToDate"] = inRecord.upToDate;
+	ret["peakMemory"] = inRecord.peakMemory;
+
+	Json targets = Json::array();
+	for (auto& target : inRecord.targets)
+	{
+		Json node = Json::object();
+		node["name"] = target.name;
+		node["duration"] = target.duration;
+		node["compiled"] = target.compiled;
+		node["upToDate"] = target.upToDate;
+		targets.push_back(std::move(node));
+	}
+	ret["targets"] = std::move(targets);
+
+	return ret;
+}
+
+/*****************************************************************************/
+bool BuildHistory::fromJson(const Json& inJson, Record& outRecord)
+{
+	if (!inJson.is_object())
+		return false;
+
+	outRecord.time = getInt(inJson, "time");
+	outRecord.route = getString(inJson, "route");
+	outRecord.configuration = getString(inJson, "configuration");
+	outRecord.toolchain = getString(inJson, "toolchain");
+	outRecord.architecture = getString(inJson, "architecture");
+	if (outRecord.route.empty())
+		return false;
+
+	auto success = inJson.find("success");
+	outRecord.success = success != inJson.end() && success->is_boolean() && success->get<bool>();
+
+	auto phases = inJson.find("phases");
+	if (phases != inJson.end() && phases->is_object())
+	{
+		outRecord.initialize = getInt(*phases, "initialize");
+		outRecord.prepare = getInt(*phases, "prepare");
+		outRecord.build = getInt(*phases, "build");
+		outRecord.postBuild = getInt(*phases, "postBuild");
+		outRecord.total = getInt(*phases, "total");
+	}
+
+	outRecord.compiled = static_cast<u32>(getInt(inJson, "compiled"));
+	outRecord.upToDate = static_cast<u32>(getInt(inJson, "upToDate"));
+	outRecord.peakMemory = getInt(inJson, "peakMemory");
+
+	outRecord.targets.clear();
+	auto targets = inJson.find("targets");
+	if (targets != inJson.end() && targets->is_array())
+	{
+		for (auto& node : *targets)
+		{
+			if (!node.is_object())
+				continue;
+
+			Target target;
+			target.name = getString(node, "name");
+			target.duration = getInt(node, "duration");
+			target.compiled = static_cast<u32>(getInt(node, "compiled"));
+			target.upToDate = static_cast<u32>(getInt(node, "upToDate"));
+			if (!target.name.empty())
+				outRecord.targets.emplace_back(std::move(target));
+		}
+	}
+
+	return true;
+}
+}
@@ -0,0 +1,67 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "Libraries/Json.hpp"
+
+namespace chalet
+{
+// An append-only record of every build in the output directory (one JSON object per line)
+//   so the latest build can be compared against the ones before it (see 'chalet report')
+//
+class BuildHistory
+{
+public:
+	struct Target
+	{
+		std::string name;
+		i64 duration = 0; // milliseconds
+		u32 compiled = 0;
+		u32 upToDate = 0;
+	};
+
+	struct Record
+	{
+		std::string route;
+		std::string configuration;
+		std::string toolchain;
+		std::string architecture;
+		std::vector<Target> targets;
+
+		i64 time = 0; // seconds since epoch
+
+		// milliseconds
+		i64 initialize = 0;
+		i64 prepare = 0;
+		i64 build = 0;
+		i64 postBuild = 0;
+		i64 total = 0;
+
+		i64 peakMemory = 0; // kilobytes, of the largest command
+		u32 compiled = 0;
+		u32 upToDate = 0;
+
+		bool success = false;
+	};
+
+	explicit BuildHistory(const std::string& inPath);
+
+	bool load();
+	bool add(const Record& inRecord);
+
+	const std::string& filename() const noexcept;
+	const std::vector<Record>& records() const noexcept;
+
+	static Json toJson(const Record& inRecord);
+	static bool fromJson(const Json& inJson, Record& outRecord);
+
+private:
+	bool trim();
+
+	std::string m_filename;
+	std::vector<Record> m_records;
+};
+}
@@ -0,0 +1,284 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Cache/BuildTimingCache.hpp"
+
+#include "System/Files.hpp"
+#include "Utility/Hash.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr const char kTimingsHeaderV1[] = "# chalet timings v1";
+constexpr const char kTimingsHeader[] = "# chalet timings v2";
+constexpr const char kNinjaLogOffset[] = "# ninja log offset ";
+
+// How much of the log before the offset identifies it
+constexpr size_t kNinjaLogTailSize = 128;
+
+/*****************************************************************************/
+// Log lines are read often enough that String::split is too slow
+//
+std::vector<std::string_view> getFields(const std::string& inLine)
+{
+	std::vector<std::string_view> ret;
+
+	size_t start = 0;
+	size_t end = inLine.find('\t');
+	while (end != std::string::npos)
+	{
+		ret.emplace_back(inLine.data() + start, end - start);
+		start = end + 1;
+		end = inLine.find('\t', start);
+	}
+	ret.emplace_back(inLine.data() + start, inLine.size() - start);
+
+	return ret;
+}
+
+/*****************************************************************************/
+i64 parseTime(const std::string_view inValue)
+{
+	i64 ret = 0;
+	for (auto c : inValue)
+	{
+		if (c < '0' || c > '9')
+			break;
+
+		ret = (ret * 10) + static_cast<i64>(c - '0');
+	}
+	return ret;
+}
+
+/*****************************************************************************/
+// A hash of the bytes just before inOffset - if they're not what they were when the offset was recorded,
+//   the log was rewritten in the meantime (even if it's grown past the offset again)
+//
+size_t getNinjaLogTailHash(std::ifstream& inStream, const size_t inOffset)
+{
+	if (inOffset == 0)
+		return 0;
+
+	size_t size = std::min(inOffset, kNinjaLogTailSize);
+	std::string tail(size, '\0');
+
+	inStream.clear();
+	inStream.seekg(static_cast<std::streamoff>(inOffset - size), std::ios_base::beg);
+	if (!inStream.read(tail.data(), static_cast<std::streamsize>(size)))
+		return 0;
+
+	return Hash::uint64(tail);
+}
+}
+
+/*****************************************************************************/
+i64 BuildTimingCache::Entry::duration() const noexcept
+{
+	return end > start ? end - start : 0;
+}
+
+/*****************************************************************************/
+bool BuildTimingCache::loadFromPath(const std::string& inPath)
+{
+	m_filename = fmt::format("{}/.chalettimings", inPath);
+	m_cache.clear();
+	m_updated.clear();
+	m_ninjaLogOffset = 0;
+	m_ninjaLogTailHash = 0;
+	m_dirty = false;
+
+	if (!Files::pathExists(m_filename))
+		return true;
+
+	auto stream = Files::ifstream(m_filename);
+
+	std::string line;
+	if (!std::getline(stream, line))
+		return true;
+
+	// v1 didn't have the resource usage
+	const bool withUsage = String::equals(kTimingsHeader, line);
+	if (!withUsage && !String::equals(kTimingsHeaderV1, line))
+		return true;
+
+	// v1: <start>\t<end>\t<output>, the same as ninja's log
+	// v2: <start>\t<end>\t<user>\t<system>\t<max rss>\t<major faults>\t<context switches>\t<output>
+	const size_t fieldCount = withUsage ? 8 : 3;
+	while (std::getline(stream, line))
+	{
+		// <offset>\t<tail hash>
+		if (String::startsWith(kNinjaLogOffset, line))
+		{
+			line.erase(0, sizeof(kNinjaLogOffset) - 1);
+			auto fields = getFields(line);
+			m_ninjaLogOffset = static_cast<size_t>(parseTime(fields.front()));
+			if (fields.size() > 1)
+				m_ninjaLogTailHash = static_cast<size_t>(std::strtoull(std::string(fields[1]).c_str(), nullptr, 10));
+
+			continue;
+		}
+
+		auto fields = getFields(line);
+		if (fields.size() != fieldCount)
+			continue;
+
+		Entry entry;
+		entry.start = parseTime(fields[0]);
+		entry.end = parseTime(fields[1]);
+		if (withUsage)
+		{
+			entry.usage.userTime = parseTime(fields[2]);
+			entry.usage.systemTime = parseTime(fields[3]);
+			entry.usage.maxResidentSize = parseTime(fields[4]);
+			entry.usage.majorFaults = parseTime(fields[5]);
+			entry.usage.contextSwitches = parseTime(fields[6]);
+		}
+		m_cache[std::string(fields.back())] = std::move(entry);
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+bool BuildTimingCache::save() const
+{
+	if (!m_dirty || m_filename.empty())
+		return false;
+
+	std::string contents(kTimingsHeader);
+	contents += '\n';
+
+	if (m_ninjaLogOffset > 0)
+		contents += fmt::format("{}{}\t{}\n", kNinjaLogOffset, m_ninjaLogOffset, m_ninjaLogTailHash);
+
+	for (auto& [outputFile, entry] : m_cache)
+	{
+		auto& usage = entry.usage;
+		contents += fmt::format("{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\n", entry.start, entry.end, usage.userTime, usage.systemTime, usage.maxResidentSize, usage.majorFaults, usage.contextSwitches, outputFile);
+	}
+
+	Files::ofstream(m_filename, std::ios_base::binary | std::ios_base::out) << contents;
+
+	return true;
+}
+
+/*****************************************************************************/
+bool BuildTimingCache::contains(const std::string& inOutputFile) const
+{
+	return m_cache.find(inOutputFile) != m_cache.end();
+}
+
+/*****************************************************************************/
+const BuildTimingCache::Entry& BuildTimingCache::get(const std::string& inOutputFile) const
+{
+	return m_cache.at(inOutputFile);
+}
+
+/*****************************************************************************/
+const Dictionary<BuildTimingCache::Entry>& BuildTimingCache::entries() const noexcept
+{
+	return m_cache;
+}
+
+/*****************************************************************************/
+const Dictionary<std::optional<BuildTimingCache::Entry>>& BuildTimingCache::updated() const noexcept
+{
+	return m_updated;
+}
+
+/*****************************************************************************/
+void BuildTimingCache::set(const std::string& inOutputFile, const i64 inStart, const i64 inEnd, const ProcessResourceUsage& inUsage)
+{
+	if (inOutputFile.empty())
+		return;
+
+	auto& entry = m_cache[inOutputFile];
+	if (m_updated.find(inOutputFile) == m_updated.end())
+	{
+		auto& previous = m_updated[inOutputFile];
+		if (entry.end > 0)
+			previous = entry;
+	}
+
+	entry.start = inStart;
+	entry.end = inEnd;
+	entry.usage = inUsage;
+	m_dirty = true;
+}
+
+/*****************************************************************************/
+// Reads the entries ninja appended since the last time we looked. Ninja recompacts the log
+//   every so often (rewriting it before appending the run's entries), in which case it's read
+//   from the beginning again. onEntry is given each new entry (times are relative to when that
+//   ninja run started)
+//
+bool BuildTimingCache::readNinjaLog(const std::string& inFilename, const OnNinjaLogEntry& onEntry)
+{
+	auto stream = Files::ifstream(inFilename, std::ios_base::binary | std::ios_base::in);
+	if (!stream.good())
+		return false;
+
+	stream.seekg(0, std::ios_base::end);
+	auto size = static_cast<size_t>(stream.tellg());
+
+	// Entries from earlier runs can't be told apart from new ones, so onEntry is skipped
+	const bool recompacted = size < m_ninjaLogOffset || getNinjaLogTailHash(stream, m_ninjaLogOffset) != m_ninjaLogTailHash;
+	if (recompacted)
+		m_ninjaLogOffset = 0;
+	else if (size == m_ninjaLogOffset)
+		return true;
+
+	std::string line;
+	stream.clear();
+	stream.seekg(0, std::ios_base::beg);
+	if (!std::getline(stream, line) || !String::startsWith("# ninja log v", line))
+		return false;
+
+	// Versions before 5 didn't have tab separated entries
+	auto version = std::strtol(line.c_str() + 13, nullptr, 10);
+	if (version < 5)
+		return false;
+
+	size_t offset = m_ninjaLogOffset;
+	if (offset > 0)
+		stream.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+	else
+		offset = line.size() + 1;
+
+	// <start>\t<end>\t<mtime>\t<output>\t<command hash>
+	while (std::getline(stream, line))
+	{
+		// An incomplete line means ninja is still writing it
+		if (stream.eof())
+			break;
+
+		offset += line.size() + 1;
+
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		auto fields = getFields(line);
+		if (fields.size() < 4)
+			continue;
+
+		auto outputFile = std::string(fields[3]);
+		set(outputFile, parseTime(fields[0]), parseTime(fields[1]));
+
+		if (onEntry != nullptr && !recompacted)
+			onEntry(outputFile, m_cache.at(outputFile));
+	}
+
+	if (offset != m_ninjaLogOffset || recompacted)
+	{
+		m_ninjaLogOffset = offset;
+		m_ninjaLogTailHash = getNinjaLogTailHash(stream, offset);
+		m_dirty = true;
+	}
+
+	return true;
+}
+}
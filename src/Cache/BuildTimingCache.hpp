@@ -0,0 +1,55 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "Process/ProcessResourceUsage.hpp"
+
+namespace chalet
+{
+// The last known time each output file took to build (in milliseconds), regardless of the strategy that built it
+//   along with what the command used (only known for commands chalet ran itself)
+//
+class BuildTimingCache
+{
+public:
+	struct Entry
+	{
+		i64 start = 0;
+		i64 end = 0;
+		ProcessResourceUsage usage;
+
+		i64 duration() const noexcept;
+	};
+
+	using OnNinjaLogEntry = std::function<void(const std::string&, const Entry&)>;
+
+	BuildTimingCache() = default;
+
+	bool loadFromPath(const std::string& inPath);
+	bool save() const;
+
+	bool contains(const std::string& inOutputFile) const;
+	const Entry& get(const std::string& inOutputFile) const;
+	const Dictionary<Entry>& entries() const noexcept;
+
+	// The outputs that were set since the cache was loaded, and what they were before that (if anything)
+	const Dictionary<std::optional<Entry>>& updated() const noexcept;
+
+	void set(const std::string& inOutputFile, const i64 inStart, const i64 inEnd, const ProcessResourceUsage& inUsage = ProcessResourceUsage());
+
+	bool readNinjaLog(const std::string& inFilename, const OnNinjaLogEntry& onEntry = nullptr);
+
+private:
+	std::string m_filename;
+	Dictionary<Entry> m_cache;
+	Dictionary<std::optional<Entry>> m_updated;
+
+	size_t m_ninjaLogOffset = 0;
+	size_t m_ninjaLogTailHash = 0;
+
+	bool m_dirty = false;
+};
+}
@@ -0,0 +1,230 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Cache/ExecutableCache.hpp"
+
+#include <mutex>
+
+#include "Process/Environment.hpp"
+#include "System/Files.hpp"
+#include "System/GlobWalker.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr const char kExecutablesHeader[] = "# chalet executables v1";
+
+// Each PATH value gets its own list, but only the most recent ones are kept
+constexpr size_t kMaxPaths = 8;
+
+struct SearchPath
+{
+	std::vector<std::pair<std::string, i64>> folders;
+	Dictionary<std::string> executables;
+	bool validated = false;
+	bool used = false;
+};
+
+struct
+{
+	std::mutex mutex;
+	std::string filename;
+	std::vector<std::pair<std::string, SearchPath>> paths;
+	bool dirty = false;
+} state;
+
+/*****************************************************************************/
+StringList getFolders(const std::string& inPath)
+{
+#if defined(CHALET_WIN32)
+	constexpr char separator = ';';
+#else
+	constexpr char separator = ':';
+#endif
+	StringList ret;
+	for (auto& folder : String::split(inPath, separator))
+	{
+		if (folder.empty())
+			continue;
+
+		if (String::startsWith("~/", folder))
+			folder = fmt::format("{}/{}", Environment::getUserDirectory(), folder.substr(2));
+
+		ret.emplace_back(std::move(folder));
+	}
+	return ret;
+}
+
+/*****************************************************************************/
+SearchPath* getSearchPath(const std::string& inPath)
+{
+	for (auto& [path, searchPath] : state.paths)
+	{
+		if (path == inPath)
+			return &searchPath;
+	}
+
+	return nullptr;
+}
+
+/*****************************************************************************/
+// Adding, removing or renaming an executable changes its folder's last write time, so the results are
+//   valid for as long as none of the folders have changed. That's only checked once per process
+//
+void validate(SearchPath& outSearchPath, const std::string& inPath)
+{
+	if (outSearchPath.validated)
+		return;
+
+	outSearchPath.validated = true;
+
+	std::vector<std::pair<std::string, i64>> folders;
+	for (auto& folder : getFolders(inPath))
+	{
+		auto lastWrite = GlobWalker::getFolderLastWrite(folder);
+		folders.emplace_back(std::move(folder), lastWrite);
+	}
+
+	if (folders != outSearchPath.folders)
+	{
+		outSearchPath.folders = std::move(folders);
+		outSearchPath.executables.clear();
+		state.dirty = true;
+	}
+}
+}
+
+/*****************************************************************************/
+bool ExecutableCache::load(const std::string& inGlobalDirectory)
+{
+	std::lock_guard<std::mutex> lock(state.mutex);
+
+	state.filename = fmt::format("{}/.chaletexecutables", inGlobalDirectory);
+	state.paths.clear();
+	state.dirty = false;
+
+	if (!Files::pathExists(state.filename))
+		return true;
+
+	auto stream = Files::ifstream(state.filename);
+
+	std::string line;
+	if (!std::getline(stream, line) || !String::equals(kExecutablesHeader, line))
+		return true;
+
+	// p\t<PATH>, followed by:
+	// d\t<last write>\t<folder> for each of its folders, in order
+	// e\t<executable>\t<result> for each executable, with an empty result if it wasn't found
+	SearchPath* searchPath = nullptr;
+	while (std::getline(stream, line))
+	{
+		if (line.size() < 2 || line[1] != '\t')
+			continue;
+
+		auto value = line.substr(2);
+		if (line[0] == 'p')
+		{
+			state.paths.emplace_back(std::move(value), SearchPath{});
+			searchPath = &state.paths.back().second;
+			continue;
+		}
+
+		auto tab = value.find('\t');
+		if (searchPath == nullptr || tab == std::string::npos)
+			continue;
+
+		if (line[0] == 'd')
+		{
+			auto lastWrite = std::strtoll(value.c_str(), nullptr, 10);
+			searchPath->folders.emplace_back(value.substr(tab + 1), static_cast<i64>(lastWrite));
+		}
+		else if (line[0] == 'e')
+		{
+			searchPath->executables.emplace(value.substr(0, tab), value.substr(tab + 1));
+		}
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+bool ExecutableCache::save()
+{
+	std::lock_guard<std::mutex> lock(state.mutex);
+
+	if (!state.dirty || state.filename.empty())
+		return false;
+
+	// The PATH values used by this run go first, so they're the last to be dropped
+	std::stable_partition(state.paths.begin(), state.paths.end(), [](const auto& inPath) {
+		return inPath.second.used;
+	});
+
+	if (state.paths.size() > kMaxPaths)
+		state.paths.resize(kMaxPaths);
+
+	std::string contents(kExecutablesHeader);
+	contents += '\n';
+
+	for (auto& [path, searchPath] : state.paths)
+	{
+		contents += fmt::format("p\t{}\n", path);
+		for (auto& [folder, lastWrite] : searchPath.folders)
+			contents += fmt::format("d\t{}\t{}\n", lastWrite, folder);
+
+		for (auto& [executable, result] : searchPath.executables)
+			contents += fmt::format("e\t{}\t{}\n", executable, result);
+	}
+
+	auto folder = String::getPathFolder(state.filename);
+	if (!Files::pathExists(folder))
+		Files::makeDirectory(folder);
+
+	Files::ofstream(state.filename, std::ios_base::binary | std::ios_base::out) << contents;
+	state.dirty = false;
+
+	return true;
+}
+
+/*****************************************************************************/
+bool ExecutableCache::find(const std::string& inPath, const std::string& inExecutable, std::string& outResult)
+{
+	std::lock_guard<std::mutex> lock(state.mutex);
+
+	auto searchPath = getSearchPath(inPath);
+	if (searchPath == nullptr)
+		return false;
+
+	validate(*searchPath, inPath);
+	searchPath->used = true;
+
+	auto it = searchPath->executables.find(inExecutable);
+	if (it == searchPath->executables.end())
+		return false;
+
+	outResult = it->second;
+	return true;
+}
+
+/*****************************************************************************/
+void ExecutableCache::add(const std::string& inPath, const std::string& inExecutable, const std::string& inResult)
+{
+	std::lock_guard<std::mutex> lock(state.mutex);
+
+	auto searchPath = getSearchPath(inPath);
+	if (searchPath == nullptr)
+	{
+		state.paths.emplace_back(inPath, SearchPath{});
+		searchPath = &state.paths.back().second;
+	}
+
+	validate(*searchPath, inPath);
+	searchPath->used = true;
+	searchPath->executables[inExecutable] = inResult;
+	state.dirty = true;
+}
+}
@@ -0,0 +1,23 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// Where Files::which found each executable (or didn't), so the same tools aren't searched for on every
+//   call, or on every run. Results are kept per PATH value, and are thrown away as soon as one of its
+//   folders has a different last write time. On macOS, the active developer directory is added to the
+//   end of the PATH value, since it changes what's found. Shared by the whole process, and kept in ~/.chalet
+//
+namespace ExecutableCache
+{
+bool load(const std::string& inGlobalDirectory);
+bool save();
+
+bool find(const std::string& inPath, const std::string& inExecutable, std::string& outResult);
+void add(const std::string& inPath, const std::string& inExecutable, const std::string& inResult);
+}
+}
@@ -0,0 +1,197 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Cache/GlobCache.hpp"
+
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr const char kGlobsHeader[] = "# chalet globs v1";
+
+/*****************************************************************************/
+std::string_view getField(const std::string& inLine, size_t& outStart)
+{
+	size_t start = outStart;
+	size_t end = inLine.find('\t', start);
+	if (end == std::string::npos)
+		end = inLine.size();
+
+	outStart = end + 1;
+	return std::string_view(inLine.data() + start, end - start);
+}
+}
+
+/*****************************************************************************/
+bool GlobCache::loadFromPath(const std::string& inPath)
+{
+	m_filename = fmt::format("{}/.chaletglobs", inPath);
+	m_cache.clear();
+	m_used.clear();
+	m_dirty = false;
+
+	if (!Files::pathExists(m_filename))
+		return true;
+
+	auto stream = Files::ifstream(m_filename);
+
+	std::string line;
+	if (!std::getline(stream, line) || !String::equals(kGlobsHeader, line))
+		return true;
+
+	// g\t<settings>\t<pattern>
+	// d\t<last write>\t<folder>, followed by its entries:
+	// m\t<name> for a match, f\t<name> for a folder that was walked into
+	GlobWalker::Listings* listings = nullptr;
+	GlobWalker::Listing* listing = nullptr;
+	while (std::getline(stream, line))
+	{
+		if (line.size() < 2 || line[1] != '\t')
+			continue;
+
+		size_t start = 2;
+		switch (line[0])
+		{
+			case 'g': {
+				auto settings = getField(line, start);
+				std::string pattern = line.substr(std::min(start, line.size()));
+				listings = &m_cache[fmt::format("{}\t{}", settings, pattern)];
+				listing = nullptr;
+				break;
+			}
+			case 'd': {
+				if (listings == nullptr)
+					break;
+
+				auto lastWrite = std::strtoll(std::string(getField(line, start)).c_str(), nullptr, 10);
+				listing = &(*listings)[line.substr(std::min(start, line.size()))];
+				listing->lastWrite = static_cast<i64>(lastWrite);
+				break;
+			}
+			case 'm':
+				if (listing != nullptr)
+					listing->matches.emplace_back(line.substr(2));
+				break;
+			case 'f':
+				if (listing != nullptr)
+					listing->folders.emplace_back(line.substr(2));
+				break;
+			default:
+				break;
+		}
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+bool GlobCache::save()
+{
+	if (m_filename.empty())
+		return false;
+
+	// Patterns that weren't used this time (a target was removed, or changed its files)
+	for (auto it = m_cache.begin(); it != m_cache.end();)
+	{
+		if (m_used.find(it->first) == m_used.end())
+		{
+			it = m_cache.erase(it);
+			m_dirty = true;
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	if (!m_dirty)
+		return false;
+
+	if (m_cache.empty())
+	{
+		Files::remove(m_filename);
+		m_dirty = false;
+		return true;
+	}
+
+	std::string contents(kGlobsHeader);
+	contents += '\n';
+
+	for (auto& [key, listings] : m_cache)
+	{
+		contents += fmt::format("g\t{}\n", key);
+		for (auto& [folder, listing] : listings)
+		{
+			contents += fmt::format("d\t{}\t{}\n", listing.lastWrite, folder);
+			for (auto& name : listing.matches)
+				contents += fmt::format("m\t{}\n", name);
+
+			for (auto& name : listing.folders)
+				contents += fmt::format("f\t{}\n", name);
+		}
+	}
+
+	Files::ofstream(m_filename, std::ios_base::binary | std::ios_base::out) << contents;
+	m_dirty = false;
+
+	return true;
+}
+
+/*****************************************************************************/
+const GlobWalker::Listings* GlobCache::get(const std::string& inPattern, const GlobMatch inSettings) const
+{
+	auto it = m_cache.find(getKey(inPattern, inSettings));
+	if (it == m_cache.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+/*****************************************************************************/
+void GlobCache::set(const std::string& inPattern, const GlobMatch inSettings, GlobWalker::Listings&& inListings)
+{
+	auto key = getKey(inPattern, inSettings);
+	m_cache[key] = std::move(inListings);
+	m_used.emplace(std::move(key));
+	m_dirty = true;
+}
+
+/*****************************************************************************/
+void GlobCache::keep(const std::string& inPattern, const GlobMatch inSettings)
+{
+	m_used.emplace(getKey(inPattern, inSettings));
+}
+
+/*****************************************************************************/
+StringList GlobCache::getFolders() const
+{
+	StringList ret;
+	std::unordered_set<std::string> added;
+	for (auto& key : m_used)
+	{
+		auto it = m_cache.find(key);
+		if (it == m_cache.end())
+			continue;
+
+		for (auto& [folder, _] : it->second)
+		{
+			if (added.emplace(folder).second)
+				ret.emplace_back(folder);
+		}
+	}
+
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+/*****************************************************************************/
+std::string GlobCache::getKey(const std::string& inPattern, const GlobMatch inSettings)
+{
+	return fmt::format("{}\t{}", static_cast<i32>(inSettings), inPattern);
+}
+}
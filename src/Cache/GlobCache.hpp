@@ -0,0 +1,41 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "System/GlobWalker.hpp"
+
+namespace chalet
+{
+// What each glob pattern expanded to in the last run, along with the folders it walked
+//   Only the globs used since the cache was loaded are saved again
+//
+class GlobCache
+{
+public:
+	GlobCache() = default;
+
+	bool loadFromPath(const std::string& inPath);
+	bool save();
+
+	const GlobWalker::Listings* get(const std::string& inPattern, const GlobMatch inSettings) const;
+	void set(const std::string& inPattern, const GlobMatch inSettings, GlobWalker::Listings&& inListings);
+
+	// The listings haven't changed, but they're still used
+	void keep(const std::string& inPattern, const GlobMatch inSettings);
+
+	// Every folder walked by the globs used since the cache was loaded
+	StringList getFolders() const;
+
+private:
+	static std::string getKey(const std::string& inPattern, const GlobMatch inSettings);
+
+	std::string m_filename;
+	Dictionary<GlobWalker::Listings> m_cache;
+	std::unordered_set<std::string> m_used;
+
+	bool m_dirty = false;
+};
+}
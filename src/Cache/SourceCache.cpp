@@ -77,6 +77,12 @@ bool SourceCache::buildStrategyChanged() const noexcept
 	return m_buildStrategyChanged;
 }
 
+/*****************************************************************************/
+std::time_t SourceCache::lastBuildTime() const noexcept
+{
+	return m_lastBuildTime;
+}
+
 /*****************************************************************************/
 void SourceCache::addDataCache(const std::string& inKey, const std::string& inValue)
 {
@@ -120,13 +126,23 @@ bool SourceCache::dataCacheValueIsFalse(const std::string& inHash)
 	return result;
 }
 
+/*****************************************************************************/
+std::string SourceCache::dataCacheValue(const std::string& inHash) const
+{
+	auto it = m_dataCache.find(inHash);
+	if (it == m_dataCache.end())
+		return std::string();
+
+	return it->second;
+}
+
 /*****************************************************************************/
 bool SourceCache::fileChangedOrDoesNotExist(const std::string& inFile) const
 {
 	if (inFile.empty())
 		return false;
 
-	auto lastWrite = Files::getLastWriteTime(inFile);
+	auto lastWrite = getLastWriteTime(inFile);
 	if (lastWrite == 0)
 		return true;
 
@@ -136,7 +152,7 @@ bool SourceCache::fileChangedOrDoesNotExist(const std::string& inFile) const
 /*****************************************************************************/
 bool SourceCache::fileChangedOrDoesNotExist(const std::string& inFile, const std::string& inDependency) const
 {
-	bool depDoesNotExist = !inDependency.empty() && !Files::pathExists(inDependency);
+	bool depDoesNotExist = !inDependency.empty() && !pathExists(inDependency);
 	return depDoesNotExist || fileChangedOrDoesNotExist(inFile);
 }
 
@@ -154,6 +170,22 @@ bool SourceCache::fileChangedOrDoesNotExistWithCache(const std::string& inFile)
 	return result;
 }
 
+/*****************************************************************************/
+// Like ninja's restat: a file with a newer timestamp, but the same contents it had the last time
+//   inKey looked at it, isn't considered changed
+//
+bool SourceCache::fileContentsChangedOrDoesNotExist(const std::string& inFile, const std::string& inKey)
+{
+	if (!fileChangedOrDoesNotExist(inFile))
+		return false;
+
+	if (!Files::pathExists(inFile))
+		return true;
+
+	auto contentsHash = Hash::string(Files::getFileContents(inFile));
+	return dataCacheValueChanged(Hash::string(fmt::format("{}:{}", inKey, inFile)), contentsHash);
+}
+
 /*****************************************************************************/
 void SourceCache::addOrRemoveFileCache(const std::string& inFile, const bool inResult)
 {
@@ -168,6 +200,18 @@ void SourceCache::addOrRemoveFileCache(const std::string& inFile, const bool inR
 	}
 }
 
+/*****************************************************************************/
+void SourceCache::setLastWriteTimes(Dictionary<i64>&& inLastWriteTimes)
+{
+	m_lastWriteTimes = std::move(inLastWriteTimes);
+}
+
+/*****************************************************************************/
+void SourceCache::clearLastWriteTimes()
+{
+	m_lastWriteTimes.clear();
+}
+
 /*****************************************************************************/
 bool SourceCache::updateInitializedTime()
 {
@@ -220,4 +264,24 @@ void SourceCache::addToFileCache(size_t inValue)
 	m_fileCache.emplace_back(std::move(inValue));
 }
 
+/*****************************************************************************/
+i64 SourceCache::getLastWriteTime(const std::string& inFile) const
+{
+	auto it = m_lastWriteTimes.find(inFile);
+	if (it != m_lastWriteTimes.end())
+		return std::max<i64>(it->second, 0);
+
+	return Files::getLastWriteTime(inFile);
+}
+
+/*****************************************************************************/
+bool SourceCache::pathExists(const std::string& inFile) const
+{
+	auto it = m_lastWriteTimes.find(inFile);
+	if (it != m_lastWriteTimes.end())
+		return it->second >= 0;
+
+	return Files::pathExists(inFile);
+}
+
 }
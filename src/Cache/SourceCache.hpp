@@ -19,6 +19,7 @@ struct SourceCache
 	Json asJson() const;
 
 	bool buildStrategyChanged() const noexcept;
+	std::time_t lastBuildTime() const noexcept;
 
 	void addDataCache(const std::string& inKey, const std::string& inValue);
 	void addDataCache(const std::string& inKey, std::string&& inValue);
@@ -26,13 +27,19 @@ struct SourceCache
 
 	bool dataCacheValueChanged(const std::string& inHash, const std::string& inValue);
 	bool dataCacheValueIsFalse(const std::string& inHash);
+	std::string dataCacheValue(const std::string& inHash) const;
 
 	bool fileChangedOrDoesNotExist(const std::string& inFile) const;
 	bool fileChangedOrDoesNotExist(const std::string& inFile, const std::string& inDependency) const;
 	bool fileChangedOrDoesNotExistWithCache(const std::string& inFile);
+	bool fileContentsChangedOrDoesNotExist(const std::string& inFile, const std::string& inKey);
 
 	void addOrRemoveFileCache(const std::string& inFile, const bool inResult);
 
+	// Looked up ahead of time (-1 if the file doesn't exist), and used instead of checking the file until cleared
+	void setLastWriteTimes(Dictionary<i64>&& inLastWriteTimes);
+	void clearLastWriteTimes();
+
 private:
 	friend struct WorkspaceInternalCacheFile;
 
@@ -42,8 +49,11 @@ private:
 	bool canRemoveCachedFolder() const noexcept;
 	const std::string& getDataCacheValue(const std::string& inKey) noexcept;
 	void addToFileCache(size_t inValue);
+	i64 getLastWriteTime(const std::string& inFile) const;
+	bool pathExists(const std::string& inFile) const;
 
 	Dictionary<std::string> m_dataCache;
+	Dictionary<i64> m_lastWriteTimes;
 
 	std::vector<size_t> m_fileCache;
 
@@ -39,6 +39,9 @@ bool WorkspaceCache::initialize(const CommandLineInputs& inInputs)
 		return false;
 	}
 
+	if (!m_fingerprint.loadFromPath(getHashPath("chalet_fingerprint")))
+		return false;
+
 	return true;
 }
 
@@ -149,6 +152,17 @@ WorkspaceInternalCacheFile& WorkspaceCache::file() noexcept
 	return m_cacheFile;
 }
 
+/*****************************************************************************/
+BuildFingerprint& WorkspaceCache::fingerprint() noexcept
+{
+	return m_fingerprint;
+}
+
+const BuildFingerprint& WorkspaceCache::fingerprint() const noexcept
+{
+	return m_fingerprint;
+}
+
 /*****************************************************************************/
 JsonFile& WorkspaceCache::getSettings(const SettingsType inType) noexcept
 {
@@ -175,6 +189,18 @@ void WorkspaceCache::saveSettings(const SettingsType inType)
 		m_localSettings.save();
 }
 
+/*****************************************************************************/
+void WorkspaceCache::saveFingerprint()
+{
+	Output::setShowCommandOverride(false);
+
+	auto path = getHashPath("chalet_fingerprint");
+	if (m_fingerprint.save() && Files::pathExists(path))
+		m_cacheFile.addExtraHash(String::getPathFilename(path));
+
+	Output::setShowCommandOverride(true);
+}
+
 /*****************************************************************************/
 bool WorkspaceCache::removeStaleProjectCaches()
 {
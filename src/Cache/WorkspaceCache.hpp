@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "Cache/BuildFingerprint.hpp"
 #include "Cache/WorkspaceInternalCacheFile.hpp"
 #include "Settings/SettingsType.hpp"
 #include "Json/JsonFile.hpp"
@@ -26,11 +27,14 @@ struct WorkspaceCache
 	std::string getCachePath(const std::string& inIdentifier) const;
 
 	WorkspaceInternalCacheFile& file() noexcept;
+	BuildFingerprint& fingerprint() noexcept;
+	const BuildFingerprint& fingerprint() const noexcept;
 
 	JsonFile& getSettings(const SettingsType inType) noexcept;
 	const JsonFile& getSettings(const SettingsType inType) const noexcept;
 	void saveSettings(const SettingsType inType);
 
+	void saveFingerprint();
 	bool removeStaleProjectCaches();
 	bool saveProjectCache(const CommandLineInputs& inInputs);
 	bool settingsCreated() const noexcept;
@@ -48,6 +52,7 @@ private:
 	bool updateSettingsFromToolchain(const CommandLineInputs& inInputs, const CentralState& inCentralState, const CompilerTools& inToolchain);
 
 	WorkspaceInternalCacheFile m_cacheFile;
+	BuildFingerprint m_fingerprint;
 
 	JsonFile m_localSettings;
 	JsonFile m_globalSettings;
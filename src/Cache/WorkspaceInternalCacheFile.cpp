@@ -381,7 +381,7 @@ bool WorkspaceInternalCacheFile::initialize(const std::string& inFilename, const
 
 						std::string hash = item.get<std::string>();
 						if (!hash.empty())
-							addExtraHash(std::move(hash));
+							List::addIfDoesNotExist(m_extraHashes, std::move(hash));
 					}
 				}
 			}
@@ -515,6 +515,19 @@ bool WorkspaceInternalCacheFile::canWipeBuildFolder() const
 	return m_forceRebuild || m_toolchainChangedForBuildOutputPath || sources().buildStrategyChanged();
 }
 
+/*****************************************************************************/
+std::string WorkspaceInternalCacheFile::getWipeBuildFolderReason() const
+{
+	if (m_forceRebuild)
+		return "The platform SDKs changed";
+	else if (m_toolchainChangedForBuildOutputPath)
+		return "A different toolchain used the same build folder";
+	else if (sources().buildStrategyChanged())
+		return "The build strategy changed";
+
+	return std::string();
+}
+
 /*****************************************************************************/
 void WorkspaceInternalCacheFile::checkForMetadataChange(const std::string& inHash)
 {
@@ -588,7 +601,8 @@ void WorkspaceInternalCacheFile::checkIfAppVersionChanged(const std::string& inA
 /*****************************************************************************/
 void WorkspaceInternalCacheFile::addExtraHash(std::string&& inHash)
 {
-	List::addIfDoesNotExist(m_extraHashes, std::move(inHash));
+	if (List::addIfDoesNotExist(m_extraHashes, std::move(inHash)))
+		m_dirty = true;
 }
 
 /*****************************************************************************/
@@ -41,6 +41,7 @@ struct WorkspaceInternalCacheFile
 	void setForceRebuild(const bool inValue);
 
 	bool canWipeBuildFolder() const;
+	std::string getWipeBuildFolderReason() const;
 
 	bool metadataChanged() const;
 	void checkForMetadataChange(const std::string& inHash);
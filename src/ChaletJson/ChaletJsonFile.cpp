@@ -28,6 +28,7 @@
 #include "Utility/Path.hpp"
 #include "Utility/String.hpp"
 #include "Utility/Timer.hpp"
+#include "Utility/Trace.hpp"
 #include "Json/JsonKeys.hpp"
 #include "Json/JsonValues.hpp"
 
@@ -66,6 +67,7 @@ constexpr const char kCondition[] = "condition";
 /*****************************************************************************/
 bool ChaletJsonFile::read(BuildState& inState)
 {
+	TraceScope traceScope("ChaletJsonFile::read");
 	auto& buildFile = inState.getCentralState().buildFile();
 	ChaletJsonFile chaletJsonFile(inState);
 	return chaletJsonFile.readFrom(buildFile);
@@ -810,6 +812,8 @@ bool ChaletJsonFile::readFromSourceTarget(SourceTarget& outTarget, const Json& i
 				outTarget.addFile(std::move(val));
 			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "configureFiles", status))
 				outTarget.addConfigureFile(std::move(val));
+			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "heavyFiles", status))
+				outTarget.addHeavyFile(std::move(val));
 			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "importPackages", status))
 				outTarget.addImportPackage(std::move(val));
 			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "language", status))
@@ -830,6 +834,8 @@ bool ChaletJsonFile::readFromSourceTarget(SourceTarget& outTarget, const Json& i
 				outTarget.addFiles(std::move(val));
 			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "configureFiles", status))
 				outTarget.addConfigureFiles(std::move(val));
+			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "heavyFiles", status))
+				outTarget.addHeavyFiles(std::move(val));
 			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "importPackages", status))
 				outTarget.addImportPackages(std::move(val));
 			else if (isUnread(status) && valueMatchesSearchKeyPattern(val, value, key, "dependsOn", status))
@@ -1356,6 +1362,14 @@ bool ChaletJsonFile::readFromCompilerSettingsCxx(SourceTarget& outTarget, const
 
 			//
 		}
+		else if (value.is_number())
+		{
+			i32 val = 0;
+			if (valueMatchesSearchKeyPattern(val, value, key, "unityBuildChunks", status))
+				outTarget.setUnityBuildChunks(val);
+			else if (isInvalid(status))
+				return false;
+		}
 		else if (value.is_array())
 		{
 			StringList val;
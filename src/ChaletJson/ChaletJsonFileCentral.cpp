@@ -12,6 +12,7 @@
 #include "State/TargetMetadata.hpp"
 #include "System/Files.hpp"
 #include "Utility/String.hpp"
+#include "Utility/Trace.hpp"
 #include "Json/JsonFile.hpp"
 #include "Json/JsonKeys.hpp"
 #include "Json/JsonValues.hpp"
@@ -26,6 +27,7 @@ namespace chalet
 /*****************************************************************************/
 bool ChaletJsonFileCentral::read(CentralState& inCentralState)
 {
+	TraceScope traceScope("ChaletJsonFileCentral::read");
 	auto& buildFile = inCentralState.buildFile();
 	ChaletJsonFileCentral chaletJsonFileCentral(inCentralState);
 	return chaletJsonFileCentral.readFrom(buildFile);
@@ -291,6 +293,8 @@ bool ChaletJsonFileCentral::readFromConfigurations(const Json& inNode, const std
 							config.setOptimizationLevel(value.get<std::string>());
 						else if (String::equals("sanitize", key))
 							config.addSanitizeOption(value.get<std::string>());
+						else if (String::equals("interproceduralOptimizationMode", key))
+							config.setInterproceduralOptimizationMode(value.get<std::string>());
 					}
 					else if (value.is_boolean())
 					{
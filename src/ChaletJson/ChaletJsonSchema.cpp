@@ -105,10 +105,21 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 
 	defs[Defs::ConfigurationInterproceduralOptimization] = R"json({
 		"type": "boolean",
-		"description": "true to use interprocedural optimizations, false otherwise.\nIn GCC, this enables link-time optimizations - the equivalent to passing the `-flto` & `-fno-fat-lto-objects` options to the compiler, and `-flto` to the linker.\nIn MSVC, this performs whole program optimizations - the equivalent to passing `/GL` to cl.exe and `/LTCG` to link.exe and lib.exe\nIn Clang, so far, this does nothing.",
+		"description": "true to use interprocedural optimizations, false otherwise.\nIn GCC, this enables link-time optimizations - the equivalent to passing the `-flto` & `-fno-fat-lto-objects` options to the compiler, and `-flto` to the linker.\nIn MSVC, this performs whole program optimizations - the equivalent to passing `/GL` to cl.exe and `/LTCG` to link.exe and lib.exe\nIn Clang, this enables ThinLTO or full LTO, depending on interproceduralOptimizationMode.",
 		"default": false
 	})json"_ojson;
 
+	defs[Defs::ConfigurationInterproceduralOptimizationMode] = R"json({
+		"type": "string",
+		"description": "The kind of link-time optimization to perform if interproceduralOptimization is enabled.\nIn Clang, 'auto' and 'thin' use ThinLTO (`-flto=thin`), with parallel backend jobs and an incremental cache inside the build folder when linking with lld or ld64. 'full' uses monolithic LTO (`-flto=full`).\nIn GCC, link-time optimization is always partitioned - 'auto' uses `-flto=auto` (GCC 10+), while 'full' & 'thin' use `-flto=N`, where N is the maximum number of jobs.\nThis has no effect with MSVC.",
+		"enum": [
+			"auto",
+			"full",
+			"thin"
+		],
+		"default": "auto"
+	})json"_ojson;
+
 	defs[Defs::ConfigurationOptimizationLevel] = R"json({
 		"type": "string",
 		"description": "The optimization level of the build.\nIn GNU-based compilers, This maps 1:1 with its respective `-O` option, except for debug - `-Od` and size - `-Os`.\nIn MSVC, it's mapped as follows: 0 - `/Od`, 1 - `/O1`, 2 - `/O2`, 3 - `/Ox`, size - `/Os`, fast - `/Ot`, debug - `/Od`\nIf this value is unset, no optimization level will be used (implying the compiler's default).",
@@ -619,7 +630,7 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		"minLength": 1
 	})json"_ojson);*/
 	defs[Defs::TargetSourceFiles] = R"json({
-		"description": "Define the source files, relative to the project root.",
+		"description": "Define the source files, relative to the project root.\nGlobs support `*`, `?`, `**` (any number of folders) and `{a,b}`. A pattern with a folder (ie. `src/*.cpp`) only matches from that folder, while one without (ie. `*.cpp`) matches at any depth.\n`.git`, `.hg`, `.svn` and `node_modules` folders are only searched if a pattern names them.",
 		"oneOf": [
 			{
 				"type": "string",
@@ -659,6 +670,7 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 						]
 					},
 					"exclude" : {
+						"description": "Files or folders to leave out of `include`. A path with a folder (ie. `src/gen`) is relative to the project root and excludes that file or folder and everything inside of it, while a name or glob without one (ie. `main.cpp`, `test` or `*_test.cpp`) excludes any file or folder that matches it at any depth. Names are matched whole, so `test` does not exclude `testing.cpp`.\nCan accept a glob pattern.",
 						"oneOf": [
 							{
 								"type": "string",
@@ -721,6 +733,12 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		"minLength": 1
 	})json"_ojson);
 
+	defs[Defs::TargetSourceHeavyFiles] = makeArrayOrString(R"json({
+		"type": "string",
+		"description": "A list of source files that are expensive to compile (ie. in memory usage). These are compiled in their own job pool, limited by the 'maxHeavyJobs' setting.",
+		"minLength": 1
+	})json"_ojson);
+
 	//
 	// workspace metadata / root
 	//
@@ -982,6 +1000,14 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		"default": false
 	})json"_ojson;
 
+	defs[Defs::TargetSourceCxxUnityBuildChunks] = R"json({
+		"description": "If unityBuild is true, the number of unity source files to split this target's files into. Each file is assigned to a chunk by a stable hash of its path, so adding or removing a file only affects the chunk it belongs to, and the chunks can be compiled in parallel. While iterating, files changed since the previous build are compiled on their own until their chunk needs to be rebuilt for another reason.\nIf 1 (default), all files are combined into a single unity source file.",
+		"type": "integer",
+		"default": 1,
+		"minimum": 1,
+		"maximum": 1024
+	})json"_ojson;
+
 	defs[Defs::TargetSourceCxxTreatWarningsAsErrors] = R"json({
 		"description": "true to treat all warnings as errors. false to disable (default).",
 		"type": "boolean",
@@ -1710,6 +1736,7 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		addProperty(configuration, "debugSymbols", Defs::ConfigurationDebugSymbols);
 		addProperty(configuration, "enableProfiling", Defs::ConfigurationEnableProfiling);
 		addProperty(configuration, "interproceduralOptimization", Defs::ConfigurationInterproceduralOptimization);
+		addProperty(configuration, "interproceduralOptimizationMode", Defs::ConfigurationInterproceduralOptimizationMode);
 		addProperty(configuration, "optimizationLevel", Defs::ConfigurationOptimizationLevel);
 		addProperty(configuration, "sanitize", Defs::ConfigurationSanitize);
 		defs[Defs::Configuration] = std::move(configuration);
@@ -1947,6 +1974,7 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		addPropertyAndPattern(sourceTargetCxx, "threads", Defs::TargetSourceCxxThreads, kPatternConditions);
 		addPropertyAndPattern(sourceTargetCxx, "treatWarningsAsErrors", Defs::TargetSourceCxxTreatWarningsAsErrors, kPatternConditions);
 		addPropertyAndPattern(sourceTargetCxx, "unityBuild", Defs::TargetSourceCxxUnityBuild, kPatternConditions);
+		addPropertyAndPattern(sourceTargetCxx, "unityBuildChunks", Defs::TargetSourceCxxUnityBuildChunks, kPatternConditions);
 		addPropertyAndPattern(sourceTargetCxx, "warningsPreset", Defs::TargetSourceCxxWarningsPreset, kPatternConditions);
 		addPropertyAndPattern(sourceTargetCxx, "warnings", Defs::TargetSourceCxxWarnings, kPatternConditions);
 		// addProperty(sourceTargetCxx, "windowsOutputDef", Defs::TargetSourceCxxWindowsOutputDef);
@@ -1993,6 +2021,7 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		})json"_ojson;
 		addPropertyAndPattern(abstractSource, "configureFiles", Defs::TargetSourceConfigureFiles, kPatternConditions);
 		addPropertyAndPattern(abstractSource, "files", Defs::TargetSourceFiles, kPatternConditions);
+		addPropertyAndPattern(abstractSource, "heavyFiles", Defs::TargetSourceHeavyFiles, kPatternConditions);
 		addPropertyAndPattern(abstractSource, "importPackages", Defs::TargetSourceImportPackages, kPatternConditions);
 		addPropertyAndPattern(abstractSource, "language", Defs::TargetSourceLanguage, kPatternConditions);
 		addProperty(abstractSource, "metadata", Defs::TargetSourceMetadata);
@@ -2023,6 +2052,7 @@ ChaletJsonSchema::DefinitionMap ChaletJsonSchema::getDefinitions()
 		addPropertyAndPattern(targetSource, "configureFiles", Defs::TargetSourceConfigureFiles, kPatternConditions);
 		addProperty(targetSource, "extends", Defs::TargetSourceExtends);
 		addPropertyAndPattern(targetSource, "files", Defs::TargetSourceFiles, kPatternConditions);
+		addPropertyAndPattern(targetSource, "heavyFiles", Defs::TargetSourceHeavyFiles, kPatternConditions);
 		addPropertyAndPattern(targetSource, "importPackages", Defs::TargetSourceImportPackages, kPatternConditions);
 		addKindEnum(targetSource, defs, Defs::TargetKind, { "staticLibrary", "sharedLibrary" });
 		addPropertyAndPattern(targetSource, "language", Defs::TargetSourceLanguage, kPatternConditions);
@@ -2259,6 +2289,7 @@ std::string ChaletJsonSchema::getDefinitionName(const Defs inDef)
 		case Defs::ConfigurationDebugSymbols: return "configuration-debugSymbols";
 		case Defs::ConfigurationEnableProfiling: return "configuration-enableProfiling";
 		case Defs::ConfigurationInterproceduralOptimization: return "configuration-interproceduralOptimization";
+		case Defs::ConfigurationInterproceduralOptimizationMode: return "configuration-interproceduralOptimizationMode";
 		case Defs::ConfigurationOptimizationLevel: return "configuration-optimizationLevel";
 		case Defs::ConfigurationSanitize: return "configuration-sanitize";
 		//
@@ -2336,6 +2367,7 @@ std::string ChaletJsonSchema::getDefinitionName(const Defs inDef)
 		case Defs::TargetSourceImportPackages: return "target-source-importPackages";
 		case Defs::TargetSourceLanguage: return "target-source-language";
 		case Defs::TargetSourceConfigureFiles: return "target-source-configureFiles";
+		case Defs::TargetSourceHeavyFiles: return "target-source-heavyFiles";
 		case Defs::TargetSourceDependsOn: return "target-source-dependsOn";
 		//
 		case Defs::TargetAbstract: return "target-abstract";
@@ -2379,6 +2411,7 @@ std::string ChaletJsonSchema::getDefinitionName(const Defs inDef)
 		case Defs::TargetSourceCxxStaticRuntimeLibrary: return "target-source-cxx-staticRuntimeLibrary";
 		case Defs::TargetSourceCxxStaticLinks: return "target-source-cxx-staticLinks";
 		case Defs::TargetSourceCxxUnityBuild: return "target-source-cxx-unityBuild";
+		case Defs::TargetSourceCxxUnityBuildChunks: return "target-source-cxx-unityBuildChunks";
 		case Defs::TargetSourceCxxWarnings: return "target-source-cxx-warnings";
 		case Defs::TargetSourceCxxWarningsPreset: return "target-source-cxx-warningsPreset";
 		case Defs::TargetSourceCxxTreatWarningsAsErrors: return "target-source-cxx-treatWarningsAsErrors";
@@ -27,6 +27,7 @@ class ChaletJsonSchema
 		ConfigurationDebugSymbols,
 		ConfigurationEnableProfiling,
 		ConfigurationInterproceduralOptimization,
+		ConfigurationInterproceduralOptimizationMode,
 		ConfigurationOptimizationLevel,
 		ConfigurationSanitize,
 		//
@@ -107,6 +108,7 @@ class ChaletJsonSchema
 		TargetSourceFiles,
 		TargetSourceLanguage,
 		TargetSourceConfigureFiles,
+		TargetSourceHeavyFiles,
 		TargetSourceCopyFilesOnRun,
 		TargetSourceImportPackages,
 		TargetSourceDependsOn,
@@ -148,6 +150,7 @@ class ChaletJsonSchema
 		TargetSourceCxxStaticRuntimeLibrary,
 		TargetSourceCxxStaticLinks,
 		TargetSourceCxxUnityBuild,
+		TargetSourceCxxUnityBuildChunks,
 		TargetSourceCxxWarningsPreset,
 		TargetSourceCxxWarnings,
 		TargetSourceCxxTreatWarningsAsErrors,
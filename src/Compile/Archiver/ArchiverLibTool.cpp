@@ -37,4 +37,11 @@ StringList ArchiverLibTool::getCommand(const std::string& outputFile, const Stri
 
 	return ret;
 }
+
+/*****************************************************************************/
+// libtool takes a -filelist instead of @file
+bool ArchiverLibTool::supportsResponseFiles() const
+{
+	return false;
+}
 }
@@ -14,5 +14,7 @@ struct ArchiverLibTool final : public IArchiver
 	explicit ArchiverLibTool(const BuildState& inState, const SourceTarget& inProject);
 
 	virtual StringList getCommand(const std::string& outputFile, const StringList& sourceObjs) const final;
+
+	virtual bool supportsResponseFiles() const final;
 };
 }
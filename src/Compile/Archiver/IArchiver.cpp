@@ -75,6 +75,12 @@ bool IArchiver::initialize()
 	return true;
 }
 
+/*****************************************************************************/
+bool IArchiver::supportsResponseFiles() const
+{
+	return true;
+}
+
 /*****************************************************************************/
 void IArchiver::addSourceObjects(StringList& outArgList, const StringList& sourceObjs) const
 {
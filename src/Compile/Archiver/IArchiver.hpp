@@ -19,6 +19,8 @@ struct IArchiver : public IToolchainExecutableBase
 
 	virtual bool initialize() final;
 
+	virtual bool supportsResponseFiles() const;
+
 protected:
 	virtual void addSourceObjects(StringList& outArgList, const StringList& sourceObjs) const final;
 };
@@ -95,6 +95,7 @@ bool AssemblyDumper::dumpProject(const SourceTarget& inTarget, StringList& outCa
 	}
 
 	CommandPool::Settings settings;
+	settings.target = inTarget.name();
 	settings.color = Output::theme().assembly;
 	settings.msvcCommand = false;
 	settings.showCommands = Output::showCommands();
@@ -70,7 +70,7 @@ bool CommandAdapterWinResource::createWindowsApplicationManifest()
 				manifestSettings.description = m_state.workspace.metadata().description();
 
 			auto manifestContents = PlatformFileTemplates::windowsAppManifest(manifestSettings);
-			if (!Files::createFileWithContents(windowsManifestFile, manifestContents))
+			if (!Files::createFileWithContentsIfChanged(windowsManifestFile, manifestContents))
 			{
 				Diagnostic::error("Error creating windows manifest file: {}", windowsManifestFile);
 				return false;
@@ -81,7 +81,7 @@ bool CommandAdapterWinResource::createWindowsApplicationManifest()
 	if (manifestChanged || sources.fileChangedOrDoesNotExist(windowsManifestResourceFile))
 	{
 		auto rcContents = PlatformFileTemplates::windowsManifestResource(windowsManifestFile, m_project.isSharedLibrary());
-		if (!Files::createFileWithContents(windowsManifestResourceFile, rcContents))
+		if (!Files::createFileWithContentsIfChanged(windowsManifestResourceFile, rcContents))
 		{
 			Diagnostic::error("Error creating windows manifest resource file: {}", windowsManifestResourceFile);
 			return false;
@@ -117,7 +117,7 @@ bool CommandAdapterWinResource::createWindowsApplicationIcon()
 	if (iconChanged || sources.fileChangedOrDoesNotExist(windowsIconResourceFile))
 	{
 		auto rcContents = PlatformFileTemplates::windowsIconResource(windowsIconFile);
-		if (!Files::createFileWithContents(windowsIconResourceFile, rcContents))
+		if (!Files::createFileWithContentsIfChanged(windowsIconResourceFile, rcContents))
 		{
 			Diagnostic::error("Error creating windows icon resource file: {}", windowsIconResourceFile);
 			return false;
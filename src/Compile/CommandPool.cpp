@@ -15,7 +15,9 @@
 	#include "Terminal/Shell.hpp"
 	#include "Utility/List.hpp"
 	#include "Utility/Path.hpp"
+	#include "Utility/EventStream.hpp"
 	#include "Utility/String.hpp"
+	#include "Utility/Trace.hpp"
 
 namespace chalet
 {
@@ -39,8 +41,11 @@ struct PoolState
 	std::string dependencySearch;
 	#endif
 
+	std::string target;
+
 	size_t refCount = 0;
 	u32 index = 0;
+	u32 firstJob = 0;
 	// u32 threads = 0;
 
 	CommandPoolErrorCode errorCode = CommandPoolErrorCode::None;
@@ -48,11 +53,90 @@ struct PoolState
 
 	std::mutex mutex;
 
+	std::array<u32, 4> poolLimits{ 0, 0, 0, 0 };
+	std::array<u32, 4> poolJobs{ 0, 0, 0, 0 };
+	std::condition_variable poolCondition;
+	std::mutex poolMutex;
+	bool poolsStopped = false;
+	bool haltOnError = true;
+
 	std::vector<size_t> erroredOn;
 };
 
 static PoolState* state = nullptr;
 
+/*****************************************************************************/
+// Takes a slot in the pool if one is free - the Default pool is never limited
+//
+bool acquirePoolSlot(const CommandPool::Pool inPool)
+{
+	auto index = static_cast<size_t>(inPool);
+	if (state->poolLimits[index] == 0)
+		return true;
+
+	std::lock_guard lock(state->poolMutex);
+	if (state->poolsStopped || state->poolJobs[index] >= state->poolLimits[index])
+		return false;
+
+	++state->poolJobs[index];
+	return true;
+}
+
+/*****************************************************************************/
+void releasePoolSlot(const CommandPool::Pool inPool)
+{
+	auto index = static_cast<size_t>(inPool);
+	if (state->poolLimits[index] == 0)
+		return;
+
+	{
+		std::lock_guard lock(state->poolMutex);
+		if (state->poolJobs[index] > 0)
+			--state->poolJobs[index];
+	}
+
+	state->poolCondition.notify_all();
+}
+
+/*****************************************************************************/
+// Commands still waiting for a slot aren't started after this
+//
+void stopPools()
+{
+	{
+		std::lock_guard lock(state->poolMutex);
+		state->poolsStopped = true;
+	}
+
+	state->poolCondition.notify_all();
+}
+
+/*****************************************************************************/
+void emitJobStarted(const size_t inIndex, const CommandPool::Timing& inTiming)
+{
+	if (!EventStream::enabled())
+		return;
+
+	EventStream::emit("job_started", { { "target", state->target }, { "output", inTiming.outputFile } }, { { "job", static_cast<i64>(state->firstJob + inIndex) } });
+}
+
+/*****************************************************************************/
+void emitJobFinished(const size_t inIndex, const CommandPool::Timing& inTiming, const i32 inExitCode, const std::string& inOutput)
+{
+	if (!EventStream::enabled())
+		return;
+
+	// Anything the compiler printed is a diagnostic (warnings if it succeeded)
+	auto job = static_cast<i64>(state->firstJob + inIndex);
+	if (!inOutput.empty())
+	{
+		const char* level = inExitCode == EXIT_SUCCESS ? "warning" : "error";
+		EventStream::emit("diagnostic", { { "target", state->target }, { "output", inTiming.outputFile }, { "level", level }, { "message", inOutput } }, { { "job", job } });
+	}
+
+	EventStream::emit("job_finished", { { "target", state->target }, { "output", inTiming.outputFile } }, { { "job", job }, { "exitCode", inExitCode }, { "duration", inTiming.end - inTiming.start } });
+}
+
 /*****************************************************************************/
 bool printCommand(std::string inText)
 {
@@ -72,7 +156,7 @@ bool printCommand(std::string inText)
 
 	/*****************************************************************************/
 	#if defined(CHALET_WIN32)
-bool executeCommandMsvc(size_t inIndex, StringList inCommand, std::string sourceFile, std::string dependencyFile)
+bool executeCommandMsvc(size_t inIndex, StringList inCommand, std::string sourceFile, std::string dependencyFile, CommandPool::Pool inPool, CommandPool::Timing* outTiming)
 {
 	std::string output;
 
@@ -84,9 +168,19 @@ bool executeCommandMsvc(size_t inIndex, StringList inCommand, std::string source
 	};
 	options.onStdErr = options.onStdOut;
 
-	bool result = true;
-	if (SubProcessController::run(inCommand, options) != EXIT_SUCCESS)
-		result = false;
+	outTiming->start = Trace::now();
+	outTiming->thread = Trace::threadId();
+	emitJobStarted(inIndex, *outTiming);
+
+	i32 exitCode = SubProcessController::run(inCommand, options);
+	bool result = exitCode == EXIT_SUCCESS;
+
+	outTiming->end = Trace::now();
+	outTiming->usage = SubProcessController::getLastResourceUsage();
+	releasePoolSlot(inPool);
+
+	if (!result && state->haltOnError)
+		stopPools();
 
 	// String::replaceAll(output, "\r\n", "\n");
 	// String::replaceAll(output, '\n', "\r\n");
@@ -144,6 +238,8 @@ bool executeCommandMsvc(size_t inIndex, StringList inCommand, std::string source
 			}
 		}
 
+		emitJobFinished(inIndex, *outTiming, exitCode, toPrint);
+
 		if (result)
 		{
 			if (!dependencies.empty())
@@ -171,13 +267,17 @@ bool executeCommandMsvc(size_t inIndex, StringList inCommand, std::string source
 		}
 		std::cout.flush();
 	}
+	else
+	{
+		emitJobFinished(inIndex, *outTiming, exitCode, output);
+	}
 
 	return result;
 }
 	#endif
 
 /*****************************************************************************/
-bool executeCommand(size_t inIndex, StringList inCommand)
+bool executeCommand(size_t inIndex, StringList inCommand, CommandPool::Pool inPool, CommandPool::Timing* outTiming)
 {
 	std::string output;
 
@@ -188,9 +288,21 @@ bool executeCommand(size_t inIndex, StringList inCommand)
 		output += std::move(inData);
 	};
 
-	bool result = true;
-	if (SubProcessController::run(inCommand, options) != EXIT_SUCCESS)
-		result = false;
+	outTiming->start = Trace::now();
+	outTiming->thread = Trace::threadId();
+	emitJobStarted(inIndex, *outTiming);
+
+	i32 exitCode = SubProcessController::run(inCommand, options);
+	bool result = exitCode == EXIT_SUCCESS;
+
+	outTiming->end = Trace::now();
+	outTiming->usage = SubProcessController::getLastResourceUsage();
+	releasePoolSlot(inPool);
+
+	if (!result && state->haltOnError)
+		stopPools();
+
+	emitJobFinished(inIndex, *outTiming, exitCode, output);
 
 	if (!output.empty())
 	{
@@ -310,7 +422,7 @@ bool CommandPool::runAll(JobList& inJobs, Settings& inSettings)
 /*****************************************************************************/
 bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 {
-	auto&& [cmdColor, startIndex, total, quiet, showCommmands, keepGoing, msvcCommand] = inSettings;
+	auto&& [target, cmdColor, startIndex, total, maxHeavyJobs, maxLinkJobs, maxLtoLinkJobs, quiet, showCommmands, keepGoing, msvcCommand] = inSettings;
 
 	m_exceptionThrown.clear();
 	state->errorCode = CommandPoolErrorCode::None;
@@ -329,6 +441,11 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 	UNUSED(msvcCommand);
 	#endif
 
+	state->poolLimits = { 0, maxHeavyJobs, maxLinkJobs, maxLtoLinkJobs };
+	state->poolJobs = { 0, 0, 0, 0 };
+	state->poolsStopped = false;
+	state->haltOnError = !keepGoing;
+
 	state->shutdownHandler = [this]() -> bool {
 		// if (state->errorCode != CommandPoolErrorCode::None)
 		// 	return false;
@@ -341,12 +458,16 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 		if (state->errorCode == CommandPoolErrorCode::None)
 			state->errorCode = CommandPoolErrorCode::Aborted;
 
+		stopPools();
+
 		return true;
 	};
 
 	Output::setQuietNonBuild(false);
 
 	state->index = startIndex > 0 ? startIndex : 1;
+	state->firstJob = state->index;
+	state->target = target;
 	u32 totalCompiles = total;
 	if (totalCompiles == 0)
 	{
@@ -358,6 +479,19 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 
 	bool haltOnError = !keepGoing;
 
+	// Workers write into these, so they're all added up front (before any pointers are handed out)
+	const size_t firstTiming = m_timings.size();
+	for (auto& cmd : inJob.list)
+	{
+		if (cmd.command.empty())
+			continue;
+
+		auto& timing = m_timings.emplace_back();
+		timing.outputFile = cmd.outputFile;
+	}
+
+	addQueuedEvents(inJob, target, state->firstJob);
+
 	// state->threads = inJob.threads > 0 ? inJob.threads : static_cast<u32>(m_threadPool.threads());
 	if (totalCompiles <= 1 || inJob.threads == 1)
 	{
@@ -375,13 +509,13 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 	#if defined(CHALET_WIN32)
 			if (msvcCommand)
 			{
-				if (!executeCommandMsvc(index, cmd.command, String::getPathFilename(cmd.reference), cmd.dependency) && haltOnError)
+				if (!executeCommandMsvc(index, cmd.command, String::getPathFilename(cmd.reference), cmd.dependency, cmd.pool, &m_timings[firstTiming + index]) && haltOnError)
 					break;
 			}
 			else
 	#endif
 			{
-				if (!executeCommand(index, cmd.command) && haltOnError)
+				if (!executeCommand(index, cmd.command, cmd.pool, &m_timings[firstTiming + index]) && haltOnError)
 					break;
 			}
 
@@ -390,13 +524,8 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 	}
 	else
 	{
-		size_t index = 0;
 		std::vector<std::future<bool>> threadResults;
-		for (auto& cmd : inJob.list)
-		{
-			if (cmd.command.empty())
-				continue;
-
+		auto enqueueCommand = [&](const Cmd& cmd, const size_t index) {
 			threadResults.emplace_back(m_threadPool.enqueue(
 				printCommand,
 				getPrintedText(fmt::format("{}{}", color, (showCommmands ? String::join(cmd.command) : cmd.output)),
@@ -405,17 +534,68 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 	#if defined(CHALET_WIN32)
 			if (msvcCommand)
 			{
-				threadResults.emplace_back(m_threadPool.enqueue(executeCommandMsvc, index, cmd.command, String::getPathFilename(cmd.reference), cmd.dependency));
+				threadResults.emplace_back(m_threadPool.enqueue(executeCommandMsvc, index, cmd.command, String::getPathFilename(cmd.reference), cmd.dependency, cmd.pool, &m_timings[firstTiming + index]));
 			}
 			else
 	#endif
 			{
-				threadResults.emplace_back(m_threadPool.enqueue(executeCommand, index, cmd.command));
+				threadResults.emplace_back(m_threadPool.enqueue(executeCommand, index, cmd.command, cmd.pool, &m_timings[firstTiming + index]));
 			}
+		};
+
+		// A command in a full pool waits here instead of on a worker, so the workers keep running the others
+		std::array<std::deque<std::pair<const Cmd*, size_t>>, 4> waiting;
+
+		size_t index = 0;
+		for (auto& cmd : inJob.list)
+		{
+			if (cmd.command.empty())
+				continue;
+
+			auto& poolWaiting = waiting[static_cast<size_t>(cmd.pool)];
+			if (poolWaiting.empty() && acquirePoolSlot(cmd.pool))
+				enqueueCommand(cmd, index);
+			else
+				poolWaiting.emplace_back(&cmd, index);
 
 			++index;
 		}
 
+		while (true)
+		{
+			size_t pool = 0;
+			{
+				std::unique_lock lock(state->poolMutex);
+				auto nextPool = [&waiting, &pool]() {
+					for (pool = 0; pool < waiting.size(); ++pool)
+					{
+						if (!waiting[pool].empty() && state->poolJobs[pool] < state->poolLimits[pool])
+							return true;
+					}
+					return false;
+				};
+				auto nothingWaiting = [&waiting]() {
+					return std::all_of(waiting.begin(), waiting.end(), [](auto& inWaiting) { return inWaiting.empty(); });
+				};
+
+				if (nothingWaiting())
+					break;
+
+				state->poolCondition.wait(lock, [&nextPool]() {
+					return state->poolsStopped || nextPool();
+				});
+
+				if (state->poolsStopped)
+					break;
+
+				++state->poolJobs[pool];
+			}
+
+			auto [cmd, cmdIndex] = waiting[pool].front();
+			waiting[pool].pop_front();
+			enqueueCommand(*cmd, cmdIndex);
+		}
+
 		for (auto& tr : threadResults)
 		{
 			CHALET_TRY
@@ -448,6 +628,8 @@ bool CommandPool::run(const Job& inJob, const Settings& inSettings)
 			threadResults.clear();
 	}
 
+	addTraceEvents(inJob, target, firstTiming);
+
 	if (state->errorCode != CommandPoolErrorCode::None)
 	{
 		size_t index = 0;
@@ -476,6 +658,70 @@ const StringList& CommandPool::failures() const
 	return m_failures;
 }
 
+/*****************************************************************************/
+const std::vector<CommandPool::Timing>& CommandPool::timings() const noexcept
+{
+	return m_timings;
+}
+
+void CommandPool::clearTimings()
+{
+	m_timings.clear();
+}
+
+/*****************************************************************************/
+void CommandPool::addTraceEvents(const Job& inJob, const std::string& inTarget, const size_t inFirstTiming) const
+{
+	if (!Trace::enabled())
+		return;
+
+	const auto mainThread = Trace::threadId();
+
+	size_t index = inFirstTiming;
+	for (auto& cmd : inJob.list)
+	{
+		if (cmd.command.empty())
+			continue;
+
+		auto& timing = m_timings[index++];
+
+		// Commands that never ran (after an error) have no end time
+		if (timing.end == 0)
+			continue;
+
+		if (timing.thread != mainThread)
+			Trace::setThreadName(timing.thread, fmt::format("worker {}", timing.thread));
+
+		Trace::Event event;
+		event.name = cmd.output;
+		event.category = "command";
+		event.start = timing.start;
+		event.duration = timing.end - timing.start;
+		event.thread = timing.thread;
+		event.args.emplace_back("target", inTarget);
+		if (!cmd.reference.empty())
+			event.args.emplace_back("file", cmd.reference);
+		event.args.emplace_back("output", cmd.outputFile);
+		Trace::addEvent(std::move(event));
+	}
+}
+
+/*****************************************************************************/
+void CommandPool::addQueuedEvents(const Job& inJob, const std::string& inTarget, const u32 inFirstJob) const
+{
+	if (!EventStream::enabled())
+		return;
+
+	i64 job = inFirstJob;
+	for (auto& cmd : inJob.list)
+	{
+		if (cmd.command.empty())
+			continue;
+
+		EventStream::emit("job_queued", { { "target", inTarget }, { "output", cmd.outputFile }, { "description", cmd.output } }, { { "job", job++ } });
+	}
+}
+
 /*****************************************************************************/
 std::string CommandPool::getPrintedText(std::string inText, u32 inTotal)
 {
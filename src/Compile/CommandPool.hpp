@@ -15,24 +15,46 @@ using CommandPool = CommandPoolAlt;
 }
 #else
 	#include "Libraries/ThreadPool.hpp"
+	#include "Process/ProcessResourceUsage.hpp"
 	#include "Terminal/Color.hpp"
 
 namespace chalet
 {
 struct CommandPool
 {
+	// Commands in a pool other than Default are limited by the matching Settings value
+	enum class Pool : u8
+	{
+		Default,
+		Heavy,
+		Link,
+		LtoLink,
+	};
+
 	struct Cmd
 	{
 		std::string output;
 		std::string reference;
+		std::string outputFile; // the file the command produces (timings are recorded against it)
 	#if defined(CHALET_WIN32)
 		// msvc only
 		std::string dependency;
 	#endif
 		StringList command;
+		Pool pool = Pool::Default;
 	};
 	using CmdList = std::vector<Cmd>;
 
+	// Microseconds since chalet started (see Trace::now)
+	struct Timing
+	{
+		std::string outputFile;
+		i64 start = 0;
+		i64 end = 0;
+		u32 thread = 0; // the worker that ran the command
+		ProcessResourceUsage usage;
+	};
+
 	struct Job
 	{
 		CmdList list;
@@ -42,9 +64,13 @@ struct CommandPool
 
 	struct Settings
 	{
+		std::string target; // only used to label commands in traces & events
 		Color color = Color::Red;
 		u32 startIndex = 0;
 		u32 total = 0;
+		u32 maxHeavyJobs = 0;
+		u32 maxLinkJobs = 0;
+		u32 maxLtoLinkJobs = 0;
 		bool quiet = false;
 		bool showCommands = false;
 		bool keepGoing = false;
@@ -60,14 +86,20 @@ struct CommandPool
 
 	const StringList& failures() const;
 
+	const std::vector<Timing>& timings() const noexcept;
+	void clearTimings();
+
 private:
 	std::string getPrintedText(std::string inText, u32 inTotal);
+	void addTraceEvents(const Job& inJob, const std::string& inTarget, const size_t inFirstTiming) const;
+	void addQueuedEvents(const Job& inJob, const std::string& inTarget, const u32 inFirstJob) const;
 	bool onError();
 	void cleanup();
 
 	ThreadPool m_threadPool;
 
 	StringList m_failures;
+	std::vector<Timing> m_timings;
 
 	std::string m_reset;
 	std::string m_exceptionThrown;
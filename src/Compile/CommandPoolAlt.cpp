@@ -15,7 +15,9 @@
 	#include "Terminal/Shell.hpp"
 	#include "Utility/List.hpp"
 	#include "Utility/Path.hpp"
+	#include "Utility/EventStream.hpp"
 	#include "Utility/String.hpp"
+	#include "Utility/Trace.hpp"
 
 	#if defined(max)
 		#undef max
@@ -43,7 +45,10 @@ struct PoolState
 	std::string dependencySearch;
 	#endif
 
+	std::string target;
+
 	size_t refCount = 0;
+	u32 firstJob = 0;
 
 	CommandPoolErrorCode errorCode = CommandPoolErrorCode::None;
 	std::function<bool()> shutdownHandler;
@@ -53,6 +58,32 @@ struct PoolState
 
 static PoolState* state = nullptr;
 
+/*****************************************************************************/
+void emitJobStarted(const size_t inIndex, const CommandPoolAlt::Timing& inTiming)
+{
+	if (!EventStream::enabled())
+		return;
+
+	EventStream::emit("job_started", { { "target", state->target }, { "output", inTiming.outputFile } }, { { "job", static_cast<i64>(state->firstJob + inIndex) } });
+}
+
+/*****************************************************************************/
+void emitJobFinished(const size_t inIndex, const CommandPoolAlt::Timing& inTiming, const i32 inExitCode, const std::string& inOutput)
+{
+	if (!EventStream::enabled())
+		return;
+
+	// Anything the compiler printed is a diagnostic (warnings if it succeeded)
+	auto job = static_cast<i64>(state->firstJob + inIndex);
+	if (!inOutput.empty())
+	{
+		const char* level = inExitCode == EXIT_SUCCESS ? "warning" : "error";
+		EventStream::emit("diagnostic", { { "target", state->target }, { "output", inTiming.outputFile }, { "level", level }, { "message", inOutput } }, { { "job", job } });
+	}
+
+	EventStream::emit("job_finished", { { "target", state->target }, { "output", inTiming.outputFile } }, { { "job", job }, { "exitCode", inExitCode }, { "duration", inTiming.end - inTiming.start } });
+}
+
 /*****************************************************************************/
 void signalHandler(i32 inSignal)
 {
@@ -138,7 +169,7 @@ bool CommandPoolAlt::runAll(JobList& inJobs, Settings& inSettings)
 /*****************************************************************************/
 bool CommandPoolAlt::run(const Job& inJob, const Settings& inSettings)
 {
-	auto&& [cmdColor, startIndex, total, quiet, showCommmands, keepGoing, msvcCommand] = inSettings;
+	auto&& [target, cmdColor, startIndex, total, maxHeavyJobs, maxLinkJobs, maxLtoLinkJobs, quiet, showCommmands, keepGoing, msvcCommand] = inSettings;
 
 	m_processes.clear();
 	m_exceptionThrown.clear();
@@ -171,6 +202,8 @@ bool CommandPoolAlt::run(const Job& inJob, const Settings& inSettings)
 	Output::setQuietNonBuild(false);
 
 	m_index = startIndex > 0 ? startIndex : 1;
+	state->firstJob = m_index;
+	state->target = target;
 	u32 totalCompiles = total;
 	if (totalCompiles == 0)
 	{
@@ -187,22 +220,58 @@ bool CommandPoolAlt::run(const Job& inJob, const Settings& inSettings)
 		size_t maxJobs = jobCount < m_maxJobs ? jobCount : m_maxJobs;
 		m_processes.resize(maxJobs);
 
-		bool queuedAllJobs = false;
+		std::array<u32, 4> poolLimits{ 0, maxHeavyJobs, maxLinkJobs, maxLtoLinkJobs };
+		std::array<u32, 4> poolJobs{ 0, 0, 0, 0 };
+
+		const size_t firstTiming = m_timings.size();
+		for (auto& cmd : inJob.list)
+		{
+			auto& timing = m_timings.emplace_back();
+			timing.outputFile = cmd.outputFile;
+		}
+
+		addQueuedEvents(inJob, target, state->firstJob);
+
+		// The commands start in order, except that one in a full pool doesn't hold up the ones after it
+		std::deque<size_t> waiting;
+		for (size_t i = 0; i < inJob.list.size(); ++i)
+			waiting.push_back(i);
+
+		auto hasPoolSlot = [&inJob, &poolLimits, &poolJobs](const size_t inIndex) {
+			auto poolIndex = static_cast<size_t>(inJob.list[inIndex].pool);
+			return poolLimits[poolIndex] == 0 || poolJobs[poolIndex] < poolLimits[poolIndex];
+		};
+
 		size_t finishedJobs = 0;
-		size_t index = 0;
 		while (finishedJobs < inJob.list.size())
 		{
+			u32 slot = 0;
 			for (auto& process : m_processes)
 			{
-				if (process == nullptr && !queuedAllJobs)
+				++slot;
+				if (process == nullptr && !waiting.empty())
 				{
-					process = std::make_unique<RunningProcess>();
+					auto next = std::find_if(waiting.begin(), waiting.end(), hasPoolSlot);
+					if (next == waiting.end())
+						continue;
+
+					size_t index = *next;
+					waiting.erase(next);
 
 					auto& cmd = inJob.list[index];
+					++poolJobs[static_cast<size_t>(cmd.pool)];
+
+					process = std::make_unique<RunningProcess>();
+					process->pool = cmd.pool;
+
 					printCommand(getPrintedText(fmt::format("{}{}", color, (showCommmands ? String::join(cmd.command) : cmd.output)), totalCompiles));
 
 					process->command = &cmd.command;
 					process->index = index;
+					process->timing = &m_timings[firstTiming + index];
+					process->timing->start = Trace::now();
+					if (Trace::enabled())
+						process->timing->thread = Trace::laneId(fmt::format("worker {}", slot));
 	#if defined(CHALET_WIN32)
 					if (msvcCommand)
 					{
@@ -217,15 +286,15 @@ bool CommandPoolAlt::run(const Job& inJob, const Settings& inSettings)
 						break;
 					}
 
-					index++;
-					if (index == inJob.list.size())
-						queuedAllJobs = true;
+					emitJobStarted(index, *process->timing);
 				}
 
 				if (process != nullptr)
 				{
 					if (process->pollState(m_buffer))
 					{
+						process->timing->end = Trace::now();
+						process->timing->usage = process->process.resourceUsage();
 						process->getResultAndPrintOutput(m_buffer);
 						if (!process->result && haltOnError)
 						{
@@ -233,6 +302,8 @@ bool CommandPoolAlt::run(const Job& inJob, const Settings& inSettings)
 							break;
 						}
 
+						--poolJobs[static_cast<size_t>(process->pool)];
+
 						process.reset();
 						finishedJobs++;
 					}
@@ -245,6 +316,8 @@ bool CommandPoolAlt::run(const Job& inJob, const Settings& inSettings)
 			if (state->errorCode != CommandPoolErrorCode::None)
 				break;
 		}
+
+		addTraceEvents(inJob, target, firstTiming);
 	}
 
 	if (state->errorCode != CommandPoolErrorCode::None)
@@ -283,6 +356,17 @@ const StringList& CommandPoolAlt::failures() const
 	return m_failures;
 }
 
+/*****************************************************************************/
+const std::vector<CommandPoolAlt::Timing>& CommandPoolAlt::timings() const noexcept
+{
+	return m_timings;
+}
+
+void CommandPoolAlt::clearTimings()
+{
+	m_timings.clear();
+}
+
 /*****************************************************************************/
 void CommandPoolAlt::printCommand(std::string text)
 {
@@ -293,6 +377,51 @@ void CommandPoolAlt::printCommand(std::string text)
 	std::cout.flush();
 }
 
+/*****************************************************************************/
+void CommandPoolAlt::addTraceEvents(const Job& inJob, const std::string& inTarget, const size_t inFirstTiming) const
+{
+	if (!Trace::enabled())
+		return;
+
+	size_t index = inFirstTiming;
+	for (auto& cmd : inJob.list)
+	{
+		auto& timing = m_timings[index++];
+
+		// Commands that never ran (after an error) have no end time
+		if (timing.end == 0)
+			continue;
+
+		Trace::Event event;
+		event.name = cmd.output;
+		event.category = "command";
+		event.start = timing.start;
+		event.duration = timing.end - timing.start;
+		event.thread = timing.thread;
+		event.args.emplace_back("target", inTarget);
+		if (!cmd.reference.empty())
+			event.args.emplace_back("file", cmd.reference);
+		event.args.emplace_back("output", cmd.outputFile);
+		Trace::addEvent(std::move(event));
+	}
+}
+
+/*****************************************************************************/
+void CommandPoolAlt::addQueuedEvents(const Job& inJob, const std::string& inTarget, const u32 inFirstJob) const
+{
+	if (!EventStream::enabled())
+		return;
+
+	i64 job = inFirstJob;
+	for (auto& cmd : inJob.list)
+	{
+		if (cmd.command.empty())
+			continue;
+
+		EventStream::emit("job_queued", { { "target", inTarget }, { "output", cmd.outputFile }, { "description", cmd.output } }, { { "job", job++ } });
+	}
+}
+
 /*****************************************************************************/
 std::string CommandPoolAlt::getPrintedText(std::string inText, u32 inTotal)
 {
@@ -394,10 +523,15 @@ void CommandPoolAlt::RunningProcess::getResultAndPrintOutput(SubProcess::OutputB
 	}
 	#if defined(CHALET_WIN32)
 	if (filterMsvc)
+	{
 		printMsvcOutput();
+	}
 	else
 	#endif
+	{
+		emitJobFinished(index, *timing, exitCode, output);
 		printOutput();
+	}
 }
 
 /*****************************************************************************/
@@ -444,6 +578,9 @@ void CommandPoolAlt::RunningProcess::printMsvcOutput()
 	if (String::startsWith(sourceFile, output))
 		String::replaceAll(output, fmt::format("{}\r\n", sourceFile), "");
 
+	if (output.empty())
+		emitJobFinished(index, *timing, exitCode, output);
+
 	if (!output.empty())
 	{
 		std::string toPrint;
@@ -491,6 +628,8 @@ void CommandPoolAlt::RunningProcess::printMsvcOutput()
 			}
 		}
 
+		emitJobFinished(index, *timing, exitCode, toPrint);
+
 		if (result)
 		{
 			if (!dependencies.empty())
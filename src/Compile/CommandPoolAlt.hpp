@@ -15,18 +15,39 @@ namespace chalet
 {
 struct CommandPoolAlt
 {
+	// Commands in a pool other than Default are limited by the matching Settings value
+	enum class Pool : u8
+	{
+		Default,
+		Heavy,
+		Link,
+		LtoLink,
+	};
+
 	struct Cmd
 	{
 		std::string output;
 		std::string reference;
+		std::string outputFile; // the file the command produces (timings are recorded against it)
 	#if defined(CHALET_WIN32)
 		// msvc only
 		std::string dependency;
 	#endif
 		StringList command;
+		Pool pool = Pool::Default;
 	};
 	using CmdList = std::vector<Cmd>;
 
+	// Microseconds since chalet started (see Trace::now)
+	struct Timing
+	{
+		std::string outputFile;
+		i64 start = 0;
+		i64 end = 0;
+		u32 thread = 0; // the worker that ran the command
+		ProcessResourceUsage usage;
+	};
+
 	struct Job
 	{
 		CmdList list;
@@ -36,9 +57,13 @@ struct CommandPoolAlt
 
 	struct Settings
 	{
+		std::string target; // only used to label commands in traces
 		Color color = Color::Red;
 		u32 startIndex = 0;
 		u32 total = 0;
+		u32 maxHeavyJobs = 0;
+		u32 maxLinkJobs = 0;
+		u32 maxLtoLinkJobs = 0;
 		bool quiet = false;
 		bool showCommands = false;
 		bool keepGoing = false;
@@ -54,6 +79,9 @@ struct CommandPoolAlt
 
 	const StringList& failures() const;
 
+	const std::vector<Timing>& timings() const noexcept;
+	void clearTimings();
+
 private:
 	SubProcess::OutputBuffer m_buffer;
 
@@ -61,6 +89,7 @@ private:
 	{
 		std::string output;
 		const StringList* command = nullptr;
+		Timing* timing = nullptr;
 	#if defined(CHALET_WIN32)
 		const std::string* reference = nullptr;
 		const std::string* dependencyFile = nullptr;
@@ -70,6 +99,7 @@ private:
 
 		size_t index = 0;
 		i32 exitCode = -1;
+		Pool pool = Pool::Default;
 
 		bool result = false;
 		bool filterMsvc = false;
@@ -89,6 +119,8 @@ private:
 
 	void printCommand(std::string text);
 	std::string getPrintedText(std::string inText, u32 inTotal);
+	void addTraceEvents(const Job& inJob, const std::string& inTarget, const size_t inFirstTiming) const;
+	void addQueuedEvents(const Job& inJob, const std::string& inTarget, const u32 inFirstJob) const;
 	bool onError();
 	void cleanup();
 
@@ -97,6 +129,7 @@ private:
 	std::vector<Unique<RunningProcess>> m_processes;
 
 	StringList m_failures;
+	std::vector<Timing> m_timings;
 
 	std::string m_reset;
 	std::string m_exceptionThrown;
@@ -155,7 +155,7 @@ StringList CompileCommandsGenerator::getCommand(CompileToolchain& inToolchain, c
 		case SourceType::CPlusPlus:
 		case SourceType::ObjectiveC:
 		case SourceType::ObjectiveCPlusPlus:
-			return inToolchain.compilerCxx->getCommand(source, object, dep, inGroup.type);
+			return inToolchain.compilerCxx->getCachedCommand(source, object, dep, inGroup.type);
 
 		case SourceType::WindowsResource:
 		case SourceType::Unknown:
@@ -7,12 +7,21 @@
 
 #include "BuildEnvironment/IBuildEnvironment.hpp"
 #include "Compile/ToolchainType.hpp"
+#include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
 #include "State/CompilerTools.hpp"
 #include "State/Target/SourceTarget.hpp"
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
 
 namespace chalet
 {
+namespace
+{
+// Keeps well clear of the 8191 character limit of cmd.exe, and anything longer is slow to pass through execve anyway
+constexpr size_t kResponseFileThreshold = 8000;
+}
+
 /*****************************************************************************/
 CompileToolchain::CompileToolchain(const SourceTarget& inProject) :
 	m_project(inProject)
@@ -22,6 +31,8 @@ CompileToolchain::CompileToolchain(const SourceTarget& inProject) :
 /*****************************************************************************/
 bool CompileToolchain::initialize(const BuildState& inState)
 {
+	m_state = &inState;
+
 	ToolchainType type = inState.environment->type();
 
 	const auto& cxxPath = inState.toolchain.compilerCxx(m_project.language()).path;
@@ -101,4 +112,51 @@ StringList CompileToolchain::getOutputTargetCommand(const std::string& outputFil
 	else
 		return linker->getCommand(outputFile, sourceObjs);
 }
+
+/*****************************************************************************/
+StringList CompileToolchain::getOutputTargetCommandWithResponseFile(const std::string& outputFile, const StringList& sourceObjs)
+{
+	if (!canUseResponseFile(sourceObjs))
+		return getOutputTargetCommand(outputFile, sourceObjs);
+
+	StringList lines;
+	for (auto& obj : sourceObjs)
+	{
+		if (String::contains(' ', obj))
+			lines.emplace_back(fmt::format("\"{}\"", obj));
+		else
+			lines.emplace_back(obj);
+	}
+	auto contents = String::join(lines, '\n');
+
+	// Only touch the file when the object list changes, so it doesn't look like a new input
+	auto responseFile = getResponseFile();
+	if (!Files::createFileWithContentsIfChanged(responseFile, contents, true))
+		return getOutputTargetCommand(outputFile, sourceObjs);
+
+	return getOutputTargetCommand(outputFile, { fmt::format("@{}", responseFile) });
+}
+
+/*****************************************************************************/
+bool CompileToolchain::canUseResponseFile(const StringList& sourceObjs) const
+{
+	chalet_assert(archiver != nullptr, "");
+
+	if (m_project.isStaticLibrary() && !archiver->supportsResponseFiles())
+		return false;
+
+	size_t length = 0;
+	for (auto& obj : sourceObjs)
+		length += obj.size() + 1;
+
+	return length > kResponseFileThreshold;
+}
+
+/*****************************************************************************/
+std::string CompileToolchain::getResponseFile() const
+{
+	chalet_assert(m_state != nullptr, "");
+
+	return fmt::format("{}/{}.rsp", m_state->paths.intermediateDir(m_project), m_project.name());
+}
 }
@@ -26,6 +26,10 @@ struct CompileToolchain
 	void setForceActualPchPath(const bool inValue) noexcept;
 
 	StringList getOutputTargetCommand(const std::string& outputFile, const StringList& sourceObjs);
+	StringList getOutputTargetCommandWithResponseFile(const std::string& outputFile, const StringList& sourceObjs);
+
+	bool canUseResponseFile(const StringList& sourceObjs) const;
+	std::string getResponseFile() const;
 
 	Unique<ICompilerCxx> compilerCxx;
 	Unique<ICompilerWinResource> compilerWindowsResource;
@@ -34,5 +38,6 @@ struct CompileToolchain
 
 private:
 	const SourceTarget& m_project;
+	const BuildState* m_state = nullptr;
 };
 }
@@ -124,6 +124,7 @@ StringList CompilerCxxClang::getModuleCommand(const std::string& inputFile, cons
 	addDebuggingInformationOption(ret);
 	addProfileInformation(ret);
 	addSanitizerOptions(ret);
+	addTimeTrace(ret);
 
 	addDefines(ret);
 
@@ -198,6 +199,21 @@ void CompilerCxxClang::addSanitizerOptions(StringList& outArgList) const
 	}
 }
 
+/*****************************************************************************/
+// Writes a trace next to the object file (ie. file.cpp.o -> file.cpp.json)
+//
+void CompilerCxxClang::addTimeTrace(StringList& outArgList) const
+{
+	if (!m_state.info.timeTrace())
+		return;
+
+	outArgList.emplace_back("-ftime-trace");
+
+	auto granularity = m_state.info.timeTraceGranularity();
+	if (granularity > 0)
+		outArgList.emplace_back(fmt::format("-ftime-trace-granularity={}", granularity));
+}
+
 /*****************************************************************************/
 void CompilerCxxClang::addLanguageStandard(StringList& outArgList, const SourceType derivative) const
 {
@@ -280,7 +296,15 @@ bool CompilerCxxClang::addArchitectureToCommand(StringList& outArgList, const st
 /*****************************************************************************/
 void CompilerCxxClang::addLinkTimeOptimizations(StringList& outArgList) const
 {
-	UNUSED(outArgList);
+	// Windows Clang may link with link.exe, which can't read bitcode objects
+	if (!m_state.configuration.interproceduralOptimization() || m_state.environment->isWindowsClang())
+		return;
+
+	auto mode = m_state.configuration.interproceduralOptimizationMode();
+	if (mode == InterproceduralOptimizationMode::Full)
+		List::addIfDoesNotExist(outArgList, "-flto=full");
+	else
+		List::addIfDoesNotExist(outArgList, "-flto=thin");
 }
 
 /*****************************************************************************/
@@ -287,6 +287,7 @@ StringList CompilerCxxGCC::getCommand(const std::string& inputFile, const std::s
 	addDebuggingInformationOption(ret);
 	addProfileInformation(ret);
 	addSanitizerOptions(ret);
+	addTimeTrace(ret);
 
 	addDefines(ret);
 
@@ -139,6 +139,46 @@ ICompilerCxx::ICompilerCxx(const BuildState& inState, const SourceTarget& inProj
 	return std::make_unique<CompilerCxxGCC>(inState, inProject);
 }
 
+/*****************************************************************************/
+// The options for a given source type are the same for every file in the target, so the command
+//   is only generated once with placeholder paths, and each file just fills those in
+//
+StringList ICompilerCxx::getCachedCommand(const std::string& inputFile, const std::string& outputFile, const std::string& dependency, const SourceType derivative)
+{
+	constexpr char kInputFile[] = "@chalet:input@";
+	constexpr char kOutputFile[] = "@chalet:output@";
+	constexpr char kDependencyFile[] = "@chalet:dependency@";
+
+	auto itr = m_commandTemplates.find(derivative);
+	if (itr == m_commandTemplates.end())
+	{
+		CommandTemplate commandTemplate;
+		commandTemplate.command = getCommand(kInputFile, kOutputFile, kDependencyFile, derivative);
+
+		for (size_t i = 0; i < commandTemplate.command.size(); ++i)
+		{
+			auto& arg = commandTemplate.command[i];
+			if (String::contains(kInputFile, arg) || String::contains(kOutputFile, arg) || String::contains(kDependencyFile, arg))
+				commandTemplate.fileArguments.push_back(i);
+		}
+
+		itr = m_commandTemplates.emplace(derivative, std::move(commandTemplate)).first;
+	}
+
+	auto& commandTemplate = itr->second;
+
+	StringList ret = commandTemplate.command;
+	for (auto i : commandTemplate.fileArguments)
+	{
+		auto& arg = ret[i];
+		String::replaceAll(arg, kInputFile, inputFile);
+		String::replaceAll(arg, kOutputFile, outputFile);
+		String::replaceAll(arg, kDependencyFile, dependency);
+	}
+
+	return ret;
+}
+
 /*****************************************************************************/
 StringList ICompilerCxx::getModuleCommand(const std::string& inputFile, const std::string& outputFile, const std::string& dependencyFile, const std::string& interfaceFile, const StringList& inModuleReferences, const StringList& inHeaderUnits, const ModuleFileType inType)
 {
@@ -254,6 +294,12 @@ void ICompilerCxx::addSanitizerOptions(StringList& outArgList) const
 	UNUSED(outArgList);
 }
 
+/*****************************************************************************/
+void ICompilerCxx::addTimeTrace(StringList& outArgList) const
+{
+	UNUSED(outArgList);
+}
+
 /*****************************************************************************/
 void ICompilerCxx::addCompileOptions(StringList& outArgList) const
 {
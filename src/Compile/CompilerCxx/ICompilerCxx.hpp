@@ -21,6 +21,7 @@ struct ICompilerCxx : public IToolchainExecutableBase
 
 	virtual StringList getPrecompiledHeaderCommand(const std::string& inputFile, const std::string& outputFile, const std::string& dependency, const std::string& arch) = 0;
 	virtual StringList getCommand(const std::string& inputFile, const std::string& outputFile, const std::string& dependency, const SourceType derivative) = 0;
+	StringList getCachedCommand(const std::string& inputFile, const std::string& outputFile, const std::string& dependency, const SourceType derivative);
 	virtual void getCommandOptions(StringList& outArgList, const SourceType derivative) = 0;
 
 	virtual StringList getModuleCommand(const std::string& inputFile, const std::string& outputFile, const std::string& dependencyFile, const std::string& interfaceFile, const StringList& inModuleReferences, const StringList& inHeaderUnits, const ModuleFileType inType);
@@ -44,6 +45,7 @@ protected:
 	virtual void addDebuggingInformationOption(StringList& outArgList) const;
 	virtual void addProfileInformation(StringList& outArgList) const;
 	virtual void addSanitizerOptions(StringList& outArgList) const;
+	virtual void addTimeTrace(StringList& outArgList) const;
 	virtual void addCompileOptions(StringList& outArgList) const;
 	virtual void addDiagnosticColorOption(StringList& outArgList) const;
 	virtual void addCharsets(StringList& outArgList) const;
@@ -58,5 +60,14 @@ protected:
 	u32 m_versionPatch = 0;
 
 	bool m_forceActualPchPath = false;
+
+private:
+	struct CommandTemplate
+	{
+		StringList command;
+		std::vector<size_t> fileArguments;
+	};
+
+	std::map<SourceType, CommandTemplate> m_commandTemplates;
 };
 }
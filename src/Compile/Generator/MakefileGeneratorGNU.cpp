@@ -354,7 +354,7 @@ std::string MakefileGeneratorGNU::getCxxRecipe(const std::string& source, const
 	const auto quietFlag = getQuietFlag();
 	const auto compileEcho = getCompileEcho(source);
 
-	auto cppCompile = String::join(m_toolchain->compilerCxx->getCommand(source, object, dependency, derivative));
+	auto cppCompile = String::join(m_toolchain->compilerCxx->getCachedCommand(source, object, dependency, derivative));
 	if (!cppCompile.empty())
 	{
 		std::string pch = pchTarget;
@@ -402,7 +402,7 @@ std::string MakefileGeneratorGNU::getTargetRecipe(const std::string& linkerTarge
 
 	const auto preReqs = getLinkerPreReqs(objects);
 
-	const auto linkerCommand = String::join(m_toolchain->getOutputTargetCommand(linkerTarget, objects));
+	const auto linkerCommand = String::join(m_toolchain->getOutputTargetCommandWithResponseFile(linkerTarget, objects));
 	if (!linkerCommand.empty())
 	{
 		const auto linkerEcho = getLinkerEcho(linkerTarget);
@@ -253,7 +253,7 @@ std::string MakefileGeneratorNMake::getTargetRecipe(const std::string& linkerTar
 
 	const auto preReqs = getLinkerPreReqs(objects);
 
-	const auto linkerCommand = String::join(m_toolchain->getOutputTargetCommand(linkerTarget, objects));
+	const auto linkerCommand = String::join(m_toolchain->getOutputTargetCommandWithResponseFile(linkerTarget, objects));
 
 	if (!linkerCommand.empty())
 	{
@@ -357,7 +357,7 @@ std::string MakefileGeneratorNMake::getCxxRecipe(const std::string& source, cons
 	const auto quietFlag = getQuietFlag();
 
 	std::string dependency;
-	auto cppCompile = String::join(m_toolchain->compilerCxx->getCommand(source, object, dependency, derivative));
+	auto cppCompile = String::join(m_toolchain->compilerCxx->getCachedCommand(source, object, dependency, derivative));
 	if (!cppCompile.empty())
 	{
 		std::string compilerEcho;
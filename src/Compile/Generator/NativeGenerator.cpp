@@ -6,8 +6,10 @@
 #include "Compile/Generator/NativeGenerator.hpp"
 
 #include "BuildEnvironment/IBuildEnvironment.hpp"
+#include "Cache/BuildTimingCache.hpp"
 #include "Cache/SourceCache.hpp"
 #include "Cache/WorkspaceCache.hpp"
+#include "Compile/RebuildExplanation.hpp"
 #include "Core/CommandLineInputs.hpp"
 #include "State/BuildInfo.hpp"
 #include "State/BuildPaths.hpp"
@@ -19,13 +21,52 @@
 #include "System/Files.hpp"
 #include "Terminal/Output.hpp"
 #include "Terminal/Shell.hpp"
+#include "Utility/EventStream.hpp"
 #include "Utility/Hash.hpp"
 #include "Utility/List.hpp"
 #include "Utility/String.hpp"
 #include "Utility/Timer.hpp"
+#include "Utility/Trace.hpp"
 
 namespace chalet
 {
+namespace
+{
+/*****************************************************************************/
+const char* getSourceTypeLabel(const SourceType inType)
+{
+	switch (inType)
+	{
+		case SourceType::C:
+			return "C";
+		case SourceType::CPlusPlus:
+			return "C++";
+		case SourceType::CxxPrecompiledHeader:
+			return "Precompiled header";
+		case SourceType::ObjectiveC:
+			return "Objective-C";
+		case SourceType::ObjectiveCPlusPlus:
+			return "Objective-C++";
+		case SourceType::WindowsResource:
+			return "Windows resource";
+		case SourceType::Unknown:
+		default:
+			return "Unknown";
+	}
+}
+
+/*****************************************************************************/
+// A hit is a source whose object file was up to date, so it won't be compiled
+//
+void emitCacheEvent(const std::string& inTarget, const std::string& inSource, const bool inChanged)
+{
+	if (!EventStream::enabled())
+		return;
+
+	EventStream::emit(inChanged ? "cache_miss" : "cache_hit", { { "target", inTarget }, { "file", inSource } });
+}
+}
+
 /*****************************************************************************/
 NativeGenerator::NativeGenerator(BuildState& inState) :
 	m_state(inState),
@@ -36,6 +77,8 @@ NativeGenerator::NativeGenerator(BuildState& inState) :
 /*****************************************************************************/
 bool NativeGenerator::addProject(const SourceTarget& inProject, const SourceOutputs& inOutputs, CompileToolchain& inToolchain)
 {
+	TraceScope traceScope("NativeGenerator::addProject", inProject.name());
+
 	const auto& name = inProject.name();
 
 	m_project = &inProject;
@@ -51,12 +94,18 @@ bool NativeGenerator::addProject(const SourceTarget& inProject, const SourceOutp
 
 	const auto pchTarget = m_state.paths.getPrecompiledHeaderTarget(*m_project);
 
+	// Nothing this target used has changed since the last build, so its files don't need to be checked
+	m_targetUnchanged = m_state.cache.fingerprint().isUnchanged(name);
+
 	bool targetExists = Files::pathExists(inOutputs.target);
-	bool dependentChanged = targetExists && m_compileAdapter.checkDependentTargets(inProject);
+	bool dependentChanged = targetExists && !m_targetUnchanged && m_compileAdapter.checkDependentTargets(inProject);
 
 	m_fileCache.reserve(m_fileCache.size() + inOutputs.groups.size() + 3);
 	m_compileAdapter.setDependencyCacheSize(m_fileCache.size() * 2);
 
+	if (!m_targetUnchanged)
+		fetchLastWriteTimes(inOutputs.groups, pchTarget);
+
 	{
 		CommandPool::JobList jobs;
 
@@ -80,6 +129,9 @@ bool NativeGenerator::addProject(const SourceTarget& inProject, const SourceOutp
 			}
 		}
 
+		// Anything written from here on would make them out of date
+		m_compileAdapter.clearLastWriteTimes();
+
 		const auto& toCache = inOutputs.target;
 		if (m_fileCache.find(toCache) == m_fileCache.end())
 		{
@@ -91,6 +143,9 @@ bool NativeGenerator::addProject(const SourceTarget& inProject, const SourceOutp
 			{
 				if (linkTarget)
 				{
+					if (m_explanation != nullptr)
+						explainLink(inOutputs.target, targetExists, dependentChanged, otherTargetsChanged);
+
 					Files::removeIfExists(inOutputs.target);
 					jobs.emplace_back(std::move(target));
 				}
@@ -132,6 +187,13 @@ bool NativeGenerator::buildProject(const SourceTarget& inProject)
 		if (miscFilesChanged && m_lateLinkCmds.find(projectName) != m_lateLinkCmds.end())
 		{
 			auto targetOutput = m_state.paths.getExecutableTargetPath(inProject);
+			if (m_explanation != nullptr)
+			{
+				auto miscFile = m_compileAdapter.getChangedMiscellaneousFile(inProject);
+				auto lastBuild = m_state.cache.file().sources().lastBuildTime();
+				m_explanation->add(RebuildExplanation::Reason::LinkerFileChanged, projectName, targetOutput, miscFile, RebuildExplanation::getStampChange(lastBuild, Files::getLastWriteTime(miscFile)));
+			}
+
 			Files::removeIfExists(targetOutput);
 
 			buildJobs.emplace_back(std::move(m_lateLinkCmds.at(projectName)));
@@ -144,6 +206,7 @@ bool NativeGenerator::buildProject(const SourceTarget& inProject)
 	if (!buildJobs.empty())
 	{
 		auto settings = m_compileAdapter.getCommandPoolSettings();
+		settings.target = projectName;
 		if (!m_commandPool->runAll(buildJobs, settings))
 		{
 			for (auto& failure : m_commandPool->failures())
@@ -167,6 +230,28 @@ bool NativeGenerator::anyFilesUpdated() const noexcept
 	return m_anyFilesUpdated;
 }
 
+/*****************************************************************************/
+void NativeGenerator::addTimings(BuildTimingCache& outTimingCache)
+{
+	if (m_commandPool == nullptr)
+		return;
+
+	for (auto& timing : m_commandPool->timings())
+	{
+		// Commands that never ran (after an error) have no end time
+		if (timing.end > 0)
+			outTimingCache.set(timing.outputFile, timing.start / 1000, timing.end / 1000, timing.usage);
+	}
+
+	m_commandPool->clearTimings();
+}
+
+/*****************************************************************************/
+void NativeGenerator::setExplanation(RebuildExplanation* inExplanation) noexcept
+{
+	m_explanation = inExplanation;
+}
+
 /*****************************************************************************/
 void NativeGenerator::initialize()
 {
@@ -179,6 +264,58 @@ void NativeGenerator::dispose() const
 	m_commandPool.reset();
 }
 
+/*****************************************************************************/
+// Only the files whose commands didn't change need to be checked
+//
+void NativeGenerator::fetchLastWriteTimes(const SourceFileGroupList& inGroups, const std::string& pchTarget)
+{
+	chalet_assert(m_project != nullptr, "");
+
+	StringList files;
+	StringList dependencies;
+
+	files.reserve(inGroups.size() * 2 + 2);
+	dependencies.reserve(inGroups.size() + 1);
+
+	if (m_project->usesPrecompiledHeader() && !m_commandsChanged[static_cast<size_t>(SourceType::CxxPrecompiledHeader)])
+	{
+		const auto& source = m_project->precompiledHeader();
+		files.emplace_back(source);
+		files.emplace_back(pchTarget);
+		dependencies.emplace_back(m_state.environment->getDependencyFile(source));
+	}
+
+	const bool objectiveCxx = m_project->objectiveCxx();
+	for (auto& group : inGroups)
+	{
+		if (group->sourceFile.empty() || group->type == SourceType::CxxPrecompiledHeader || group->type == SourceType::Unknown)
+			continue;
+
+		if (m_commandsChanged[static_cast<size_t>(group->type)])
+			continue;
+
+		if (!objectiveCxx && (group->type == SourceType::ObjectiveC || group->type == SourceType::ObjectiveCPlusPlus))
+			continue;
+
+		files.emplace_back(group->sourceFile);
+		files.emplace_back(group->objectFile);
+
+		if (!group->dependencyFile.empty())
+			dependencies.emplace_back(group->dependencyFile);
+	}
+
+	m_compileAdapter.fetchLastWriteTimes(files, dependencies);
+}
+
+/*****************************************************************************/
+bool NativeGenerator::sourceFileChanged(const std::string& source, const std::string& target, const std::string& dependency)
+{
+	if (m_targetUnchanged)
+		return false;
+
+	return m_compileAdapter.fileChangedOrDependentChanged(source, target, dependency);
+}
+
 /*****************************************************************************/
 CommandPool::CmdList NativeGenerator::getPchCommands(const std::string& pchTarget)
 {
@@ -203,8 +340,9 @@ CommandPool::CmdList NativeGenerator::getPchCommands(const std::string& pchTarge
 			{
 				auto outObject = fmt::format("{}_{}/{}", baseFolder, arch, filename);
 
-				bool pchChanged = pchCommandChanged || m_compileAdapter.fileChangedOrDependentChanged(source, outObject, dependency);
+				bool pchChanged = pchCommandChanged || sourceFileChanged(source, outObject, dependency);
 				m_pchChanged |= pchChanged;
+				emitCacheEvent(m_project->name(), outObject, pchChanged);
 				if (pchChanged)
 				{
 					auto intermediateSource = String::getPathFolderBaseName(outObject);
@@ -213,11 +351,15 @@ CommandPool::CmdList NativeGenerator::getPchCommands(const std::string& pchTarge
 					{
 						m_fileCache.insert(std::move(toCache));
 
+						if (m_explanation != nullptr)
+							explainCompile(source, outObject, dependency, SourceType::CxxPrecompiledHeader);
+
 						Files::removeIfExists(outObject);
 
 						CommandPool::Cmd cmd;
 						cmd.output = fmt::format("{} ({})", m_state.paths.getBuildOutputPath(source), arch);
 						cmd.command = m_toolchain->compilerCxx->getPrecompiledHeaderCommand(source, outObject, dependency, arch);
+						cmd.outputFile = outObject;
 
 						ret.emplace_back(std::move(cmd));
 					}
@@ -227,8 +369,9 @@ CommandPool::CmdList NativeGenerator::getPchCommands(const std::string& pchTarge
 		else
 #endif
 		{
-			bool pchChanged = pchCommandChanged || m_compileAdapter.fileChangedOrDependentChanged(source, pchTarget, dependency);
+			bool pchChanged = pchCommandChanged || sourceFileChanged(source, pchTarget, dependency);
 			m_pchChanged |= pchChanged;
+			emitCacheEvent(m_project->name(), source, pchChanged);
 			if (pchChanged)
 			{
 				auto toCache = fmt::format("{}/{}", objDir, source);
@@ -236,11 +379,15 @@ CommandPool::CmdList NativeGenerator::getPchCommands(const std::string& pchTarge
 				{
 					m_fileCache.insert(std::move(toCache));
 
+					if (m_explanation != nullptr)
+						explainCompile(source, pchTarget, dependency, SourceType::CxxPrecompiledHeader);
+
 					Files::removeIfExists(pchTarget);
 
 					CommandPool::Cmd cmd;
 					cmd.output = m_state.paths.getBuildOutputPath(source);
 					cmd.command = m_toolchain->compilerCxx->getPrecompiledHeaderCommand(source, pchTarget, dependency, std::string());
+					cmd.outputFile = pchTarget;
 
 					auto pchSource = m_state.environment->getPrecompiledHeaderSourceFile(*m_project);
 
@@ -288,8 +435,9 @@ CommandPool::CmdList NativeGenerator::getCompileCommands(const SourceFileGroupLi
 		switch (group->type)
 		{
 			case SourceType::WindowsResource: {
-				bool sourceChanged = m_commandsChanged[static_cast<size_t>(group->type)] || m_compileAdapter.fileChangedOrDependentChanged(source, target, dependency);
+				bool sourceChanged = m_commandsChanged[static_cast<size_t>(group->type)] || sourceFileChanged(source, target, dependency);
 				m_sourcesChanged |= sourceChanged;
+				emitCacheEvent(m_project->name(), source, sourceChanged);
 				if (sourceChanged)
 				{
 					auto toCache = fmt::format("{}/{}", objDir, source);
@@ -297,12 +445,16 @@ CommandPool::CmdList NativeGenerator::getCompileCommands(const SourceFileGroupLi
 					{
 						m_fileCache.insert(std::move(toCache));
 
+						if (m_explanation != nullptr)
+							explainCompile(source, target, dependency, group->type);
+
 						Files::removeIfExists(target);
 
 						CommandPool::Cmd cmd;
 						cmd.output = m_state.paths.getBuildOutputPath(source);
 						cmd.command = getRcCompile(source, target);
 						cmd.reference = source;
+						cmd.outputFile = target;
 
 						ret.emplace_back(std::move(cmd));
 					}
@@ -313,8 +465,9 @@ CommandPool::CmdList NativeGenerator::getCompileCommands(const SourceFileGroupLi
 			case SourceType::CPlusPlus:
 			case SourceType::ObjectiveC:
 			case SourceType::ObjectiveCPlusPlus: {
-				bool sourceChanged = m_commandsChanged[static_cast<size_t>(group->type)] || m_compileAdapter.fileChangedOrDependentChanged(source, target, dependency);
+				bool sourceChanged = m_commandsChanged[static_cast<size_t>(group->type)] || sourceFileChanged(source, target, dependency);
 				m_sourcesChanged |= sourceChanged;
+				emitCacheEvent(m_project->name(), source, sourceChanged || m_pchChanged);
 				if (sourceChanged || m_pchChanged)
 				{
 					auto toCache = fmt::format("{}/{}", objDir, source);
@@ -322,12 +475,19 @@ CommandPool::CmdList NativeGenerator::getCompileCommands(const SourceFileGroupLi
 					{
 						m_fileCache.insert(std::move(toCache));
 
+						if (m_explanation != nullptr)
+							explainCompile(source, target, dependency, group->type);
+
 						Files::removeIfExists(target);
 
 						CommandPool::Cmd cmd;
 						cmd.output = m_state.paths.getBuildOutputPath(source);
 						cmd.command = getCxxCompile(source, target, group->type);
 						cmd.reference = source;
+						cmd.outputFile = target;
+
+						if (m_project->isHeavyFile(source))
+							cmd.pool = CommandPool::Pool::Heavy;
 
 #if defined(CHALET_WIN32)
 						if (m_state.environment->isMsvc())
@@ -362,7 +522,7 @@ StringList NativeGenerator::getCxxCompile(const std::string& source, const std::
 	StringList ret;
 
 	auto dependency = m_state.environment->getDependencyFile(source);
-	ret = m_toolchain->compilerCxx->getCommand(source, target, dependency, derivative);
+	ret = m_toolchain->compilerCxx->getCachedCommand(source, target, dependency, derivative);
 
 	return ret;
 }
@@ -422,12 +582,18 @@ void NativeGenerator::checkCommandsForChanges()
 				options = m_toolchain->compilerCxx->getCommand("cmd.cxx", "cmd.cxx.o", "cmd.cxx.d", derivative);
 
 			auto hash = Hash::string(String::join(options));
+			if (m_explanation != nullptr)
+				m_commandHashChanges[static_cast<size_t>(type)] = fmt::format("hash {} -> {}", sourceCache.dataCacheValue(cxxHashKey), hash);
+
 			m_commandsChanged[static_cast<size_t>(type)] = sourceCache.dataCacheValueChanged(cxxHashKey, hash);
 		}
 
 		auto targetHashKey = Hash::string(fmt::format("{}_target", name));
 		auto targetOptions = m_toolchain->getOutputTargetCommand(m_project->outputFile(), m_project->files());
 		auto targetHash = Hash::string(String::join(targetOptions));
+		if (m_explanation != nullptr)
+			m_targetCommandHashChange = fmt::format("hash {} -> {}", sourceCache.dataCacheValue(targetHashKey), targetHash);
+
 		m_targetCommandChanged = sourceCache.dataCacheValueChanged(targetHashKey, targetHash);
 
 		if (m_targetCommandChanged)
@@ -436,4 +602,62 @@ void NativeGenerator::checkCommandsForChanges()
 		}
 	}
 }
+
+/*****************************************************************************/
+// Works out which check made a file rebuild - only called with --explain, so the extra file checks are fine
+//
+void NativeGenerator::explainCompile(const std::string& source, const std::string& target, const std::string& dependency, const SourceType inType) const
+{
+	using Reason = RebuildExplanation::Reason;
+
+	const auto& name = m_project->name();
+	const auto type = static_cast<size_t>(inType);
+	if (m_commandsChanged[type])
+	{
+		m_explanation->add(Reason::CompileCommandChanged, name, source, fmt::format("{} flags", getSourceTypeLabel(inType)), m_commandHashChanges[type]);
+		return;
+	}
+
+	if (!Files::pathExists(target))
+	{
+		m_explanation->add(Reason::ObjectMissing, name, source, std::string(), target);
+		return;
+	}
+
+	auto lastBuild = m_state.cache.file().sources().lastBuildTime();
+	auto lastWrite = Files::getLastWriteTime(source);
+	if (lastWrite == 0 || lastWrite > lastBuild)
+	{
+		m_explanation->add(Reason::SourceChanged, name, source, std::string(), RebuildExplanation::getStampChange(lastBuild, lastWrite));
+		return;
+	}
+
+	auto changed = m_compileAdapter.getChangedDependency(dependency);
+	if (!changed.empty())
+	{
+		m_explanation->add(Reason::DependencyChanged, name, source, changed, RebuildExplanation::getStampChange(lastBuild, Files::getLastWriteTime(changed)));
+		return;
+	}
+
+	if (m_pchChanged && m_project->usesPrecompiledHeader())
+		m_explanation->add(Reason::PrecompiledHeaderChanged, name, source, m_project->precompiledHeader());
+}
+
+/*****************************************************************************/
+void NativeGenerator::explainLink(const std::string& inTarget, const bool inTargetExists, const bool inDependentChanged, const bool inOtherTargetsChanged) const
+{
+	using Reason = RebuildExplanation::Reason;
+
+	const auto& name = m_project->name();
+	if (!inTargetExists)
+		m_explanation->add(Reason::TargetMissing, name, inTarget, std::string());
+	else if (m_targetCommandChanged)
+		m_explanation->add(Reason::LinkCommandChanged, name, inTarget, "Link flags", m_targetCommandHashChange);
+	else if (m_sourcesChanged || m_pchChanged)
+		m_explanation->add(Reason::ObjectsChanged, name, inTarget, std::string());
+	else if (inDependentChanged)
+		m_explanation->add(Reason::DependentTargetChanged, name, inTarget, m_compileAdapter.getChangedDependentTarget(*m_project));
+	else if (inOtherTargetsChanged)
+		m_explanation->add(Reason::SubProjectChanged, name, inTarget, m_compileAdapter.getChangedSubProjectTarget());
+}
 }
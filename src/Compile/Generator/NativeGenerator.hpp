@@ -14,6 +14,8 @@
 namespace chalet
 {
 class BuildState;
+class BuildTimingCache;
+struct RebuildExplanation;
 struct SourceOutputs;
 
 class NativeGenerator
@@ -29,8 +31,12 @@ public:
 	void dispose() const;
 
 	bool anyFilesUpdated() const noexcept;
+	void addTimings(BuildTimingCache& outTimingCache);
+	void setExplanation(RebuildExplanation* inExplanation) noexcept;
 
 private:
+	void fetchLastWriteTimes(const SourceFileGroupList& inGroups, const std::string& pchTarget);
+	bool sourceFileChanged(const std::string& source, const std::string& target, const std::string& dependency);
 	CommandPool::CmdList getPchCommands(const std::string& pchTarget);
 	CommandPool::CmdList getCompileCommands(const SourceFileGroupList& inGroups);
 
@@ -39,6 +45,9 @@ private:
 
 	void checkCommandsForChanges();
 
+	void explainCompile(const std::string& source, const std::string& target, const std::string& dependency, const SourceType inType) const;
+	void explainLink(const std::string& inTarget, const bool inTargetExists, const bool inDependentChanged, const bool inOtherTargetsChanged) const;
+
 	BuildState& m_state;
 
 	NativeCompileAdapter m_compileAdapter;
@@ -50,14 +59,18 @@ private:
 
 	const SourceTarget* m_project = nullptr;
 	CompileToolchain* m_toolchain = nullptr;
+	RebuildExplanation* m_explanation = nullptr;
 
 	std::unordered_set<std::string> m_fileCache;
 
 	std::array<bool, static_cast<size_t>(SourceType::Count)> m_commandsChanged;
+	std::array<std::string, static_cast<size_t>(SourceType::Count)> m_commandHashChanges;
+	std::string m_targetCommandHashChange;
 	bool m_targetCommandChanged = false;
 
 	bool m_pchChanged = false;
 	bool m_sourcesChanged = false;
+	bool m_targetUnchanged = false;
 	bool m_anyFilesUpdated = false;
 };
 }
@@ -9,6 +9,7 @@
 #include "Core/CommandLineInputs.hpp"
 #include "Process/Environment.hpp"
 #include "State/AncillaryTools.hpp"
+#include "State/BuildConfiguration.hpp"
 #include "State/BuildInfo.hpp"
 #include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
@@ -52,6 +53,8 @@ void NinjaGenerator::addProjectRecipes(const SourceTarget& inProject, const Sour
 	}
 	// auto objects = String::join(inOutputs.objectListLinker);
 
+	std::string implicitDeps;
+
 	for (auto& target : m_state.targets)
 	{
 		if (target->isSources())
@@ -65,6 +68,13 @@ void NinjaGenerator::addProjectRecipes(const SourceTarget& inProject, const Sour
 				objects += getSafeNinjaPath(m_state.paths.getTargetFilename(project));
 				objects += ' ';
 			}
+			else if (List::contains(inProject.projectSharedLinks(), project.name()))
+			{
+				// Shared libraries are linked by name, so they're only order dependencies of the link step
+				//   (they allow all targets to be built from a single ninja invocation)
+				implicitDeps += ' ';
+				implicitDeps += getSafeNinjaPath(m_state.paths.getTargetFilename(project));
+			}
 		}
 	}
 
@@ -78,6 +88,9 @@ void NinjaGenerator::addProjectRecipes(const SourceTarget& inProject, const Sour
 	if (objects.back() == ' ')
 		objects.pop_back();
 
+	if (!implicitDeps.empty())
+		objects += fmt::format(" |{}", implicitDeps);
+
 	auto keyword = m_project->isStaticLibrary() ? "archive" : "link";
 
 	//
@@ -119,9 +132,24 @@ std::string NinjaGenerator::getContents(const std::string& inPath) const
 	}*/
 	// #endif
 
+	// Links (and heavy compiles) are memory hungry, so they get their own limits
+	auto pools = fmt::format(R"ninja(
+pool link_pool
+  depth = {maxLinkJobs}
+
+pool lto_link_pool
+  depth = {maxLtoLinkJobs}
+
+pool heavy_pool
+  depth = {maxHeavyJobs}
+)ninja",
+		fmt::arg("maxLinkJobs", m_state.info.maxLinkJobs()),
+		fmt::arg("maxLtoLinkJobs", m_state.info.maxLtoLinkJobs()),
+		fmt::arg("maxHeavyJobs", m_state.info.maxHeavyJobs()));
+
 	std::string ninjaTemplate = fmt::format(R"ninja(
 builddir = {buildCache}
-{msvcDepsPrefix}
+{msvcDepsPrefix}{pools}
 {recipes}
 build makebuild: phony
 
@@ -129,6 +157,7 @@ default makebuild
 )ninja",
 		fmt::arg("buildCache", inPath),
 		FMT_ARG(msvcDepsPrefix),
+		FMT_ARG(pools),
 		FMT_ARG(recipes));
 
 	String::replaceAll(ninjaTemplate, "\"$out\"", "$out");
@@ -178,7 +207,7 @@ std::string NinjaGenerator::getRules(const SourceOutputs& inOutputs)
 		addedRules.push_back(group->type);
 	}
 
-	rules += getLinkRule();
+	rules += getLinkRule(m_toolchain->canUseResponseFile(inOutputs.objectListLinker));
 	rules += '\n';
 
 	return rules;
@@ -364,29 +393,47 @@ std::string NinjaGenerator::getObjcppRule()
 }
 
 /*****************************************************************************/
-std::string NinjaGenerator::getLinkRule()
+std::string NinjaGenerator::getLinkRule(const bool inResponseFile)
 {
 	chalet_assert(m_project != nullptr, "");
 	chalet_assert(m_toolchain != nullptr, "");
 
 	std::string ret;
 
-	const auto linkerCommand = String::join(m_toolchain->getOutputTargetCommand("$out", { "$in" }));
+	std::string linkerCommand;
+	std::string rspFile;
+	if (inResponseFile)
+	{
+		linkerCommand = String::join(m_toolchain->getOutputTargetCommand("$out", { "@$out.rsp" }));
+		rspFile = "\n  rspfile = $out.rsp\n  rspfile_content = $in_newline";
+	}
+	else
+	{
+		linkerCommand = String::join(m_toolchain->getOutputTargetCommand("$out", { "$in" }));
+	}
 
 	if (!linkerCommand.empty())
 	{
 		const char* description = m_project->isStaticLibrary() ? "Archiving" : "Linking";
 		const char* keyword = m_project->isStaticLibrary() ? "archive" : "link";
 
+		std::string pool;
+		if (!m_project->isStaticLibrary())
+		{
+			pool = m_state.configuration.interproceduralOptimization() ? "\n  pool = lto_link_pool" : "\n  pool = link_pool";
+		}
+
 		ret = fmt::format(R"ninja(
 rule {keyword}_{hash}
   description = {description} $out
-  command = {linkerCommand}
+  command = {linkerCommand}{rspFile}{pool}
 )ninja",
 			fmt::arg("hash", m_hash),
 			FMT_ARG(keyword),
 			FMT_ARG(description),
-			FMT_ARG(linkerCommand));
+			FMT_ARG(linkerCommand),
+			FMT_ARG(rspFile),
+			FMT_ARG(pool));
 	}
 
 	return ret;
@@ -540,12 +587,19 @@ std::string NinjaGenerator::getObjBuildRules(const SourceFileGroupList& inGroups
 			implicitDeps = pchImplicitDep;
 		}
 
-		ret += fmt::format("build {object}: {rule}_{hash} {source}{implicitDeps}\n",
+		std::string pool;
+		if (m_project->isHeavyFile(group->sourceFile))
+		{
+			pool = "  pool = heavy_pool\n";
+		}
+
+		ret += fmt::format("build {object}: {rule}_{hash} {source}{implicitDeps}\n{pool}",
 			fmt::arg("hash", m_hash),
 			FMT_ARG(object),
 			FMT_ARG(rule),
 			FMT_ARG(source),
-			FMT_ARG(implicitDeps));
+			FMT_ARG(implicitDeps),
+			FMT_ARG(pool));
 	}
 
 	return ret;
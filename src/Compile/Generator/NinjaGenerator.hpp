@@ -40,7 +40,7 @@ private:
 
 	std::string getCxxRule(const std::string inId, const SourceType derivative);
 
-	std::string getLinkRule();
+	std::string getLinkRule(const bool inResponseFile);
 
 	std::string getPchBuildRule(const std::string& pchTarget);
 	std::string getObjBuildRules(const SourceFileGroupList& inGroups);
@@ -11,6 +11,7 @@
 // #include "Process/Process.hpp"
 #include "State/AncillaryTools.hpp"
 #include "State/BuildConfiguration.hpp"
+#include "State/BuildInfo.hpp"
 #include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
 #include "State/CompilerTools.hpp"
@@ -328,7 +329,21 @@ void LinkerGCC::addLinkTimeOptimizations(StringList& outArgList) const
 {
 	if (m_state.configuration.interproceduralOptimization())
 	{
+		// GCC can run the LTRANS stage in parallel (-flto=auto uses the jobserver if there is one)
 		std::string lto{ "-flto" };
+		if (m_state.environment->isGcc())
+		{
+			auto mode = m_state.configuration.interproceduralOptimizationMode();
+			if (mode == InterproceduralOptimizationMode::Auto && m_versionMajorMinor >= 1000)
+				lto = "-flto=auto";
+			else
+			{
+				// These links run in the LTO link pool, so the jobs are split between the ones running at once
+				auto jobs = std::max(m_state.info.maxJobs() / m_state.info.maxLtoLinkJobs(), 1U);
+				lto = fmt::format("-flto={}", jobs);
+			}
+		}
+
 		// if (isFlagSupported(lto))
 		List::addIfDoesNotExist(outArgList, std::move(lto));
 	}
@@ -454,21 +469,52 @@ void LinkerGCC::addEntryPoint(StringList& outArgList) const
 /*****************************************************************************/
 void LinkerGCC::addFuseLdOption(StringList& outArgList) const
 {
-	auto& linker = m_state.toolchain.linker();
+	auto linker = getFuseLdLinker();
 	if (linker.empty())
 		return;
 
-	auto exec = String::toLowerCase(String::getPathFilename(linker));
-	if (String::endsWith(".exe", exec))
-		exec = String::getPathFolderBaseName(exec);
-
-	if (String::startsWith("ld.", exec))
-		exec = String::getPathSuffix(exec);
+	List::addIfDoesNotExist(outArgList, fmt::format("-fuse-ld={}", linker));
+}
 
-	if (String::equals({ "bfd", "gold", "lld", "mold" }, exec))
+/*****************************************************************************/
+// The linker the toolchain names if -fuse-ld= can select it, otherwise the fastest one found
+//
+std::string LinkerGCC::getFuseLdLinker() const
+{
+	auto& linker = m_state.toolchain.linker();
+	if (!linker.empty())
 	{
-		List::addIfDoesNotExist(outArgList, fmt::format("-fuse-ld={}", exec));
+		auto exec = String::toLowerCase(String::getPathFilename(linker));
+		if (String::endsWith(".exe", exec))
+			exec = String::getPathFolderBaseName(exec);
+
+		if (String::startsWith("ld.", exec))
+			exec = String::getPathSuffix(exec);
+
+		if (String::equals({ "bfd", "gold", "lld", "mold" }, exec))
+			return exec;
 	}
+
+	return getFastLinker();
+}
+
+/*****************************************************************************/
+std::string LinkerGCC::getFastLinker() const
+{
+	if (!m_state.info.fastLinker() || m_state.environment->isEmscripten())
+		return std::string();
+
+	auto strategy = m_state.toolchain.strategy();
+	if (strategy != StrategyType::Native && strategy != StrategyType::Ninja)
+		return std::string();
+
+	auto& fastLinker = m_state.toolchain.fastLinker();
+
+	// lld can't read GCC's LTO objects (gold & mold load its plugin), and the probe doesn't use -flto
+	if (String::equals("lld", fastLinker) && m_state.environment->isGcc() && m_state.configuration.interproceduralOptimization())
+		return std::string();
+
+	return fastLinker;
 }
 
 /*****************************************************************************/
@@ -40,6 +40,8 @@ protected:
 
 	// Linking (Misc)
 	virtual void addFuseLdOption(StringList& outArgList) const;
+	std::string getFuseLdLinker() const;
+	std::string getFastLinker() const;
 	virtual void addCppFilesystem(StringList& outArgList) const;
 	virtual void startStaticLinkGroup(StringList& outArgList) const;
 	virtual void endStaticLinkGroup(StringList& outArgList) const;
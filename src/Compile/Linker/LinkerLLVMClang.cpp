@@ -10,9 +10,12 @@
 #include "Compile/CompilerCxx/CompilerCxxClang.hpp"
 #include "Compile/Linker/LinkerVisualStudioLINK.hpp"
 #include "State/BuildConfiguration.hpp"
+#include "State/BuildInfo.hpp"
+#include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
 #include "State/Target/SourceTarget.hpp"
 #include "Utility/List.hpp"
+#include "Utility/String.hpp"
 
 namespace chalet
 {
@@ -91,6 +94,49 @@ void LinkerLLVMClang::addStaticCompilerLibraries(StringList& outArgList) const
 	}
 }
 
+/*****************************************************************************/
+void LinkerLLVMClang::addLinkTimeOptimizations(StringList& outArgList) const
+{
+	// Windows Clang may link with link.exe, so leave that to the base behavior
+	if (m_state.environment->isWindowsClang())
+	{
+		LinkerGCC::addLinkTimeOptimizations(outArgList);
+		return;
+	}
+
+	if (!m_state.configuration.interproceduralOptimization())
+		return;
+
+	auto mode = m_state.configuration.interproceduralOptimizationMode();
+	if (mode == InterproceduralOptimizationMode::Full)
+	{
+		List::addIfDoesNotExist(outArgList, "-flto=full");
+		return;
+	}
+
+	List::addIfDoesNotExist(outArgList, "-flto=thin");
+
+	if (m_state.environment->isEmscripten())
+		return;
+
+	// ThinLTO backends run in parallel & get cached between links, so incremental release links stay fast
+	auto cacheDir = fmt::format("{}/thinlto", m_state.paths.buildOutputDir());
+
+#if defined(CHALET_MACOS)
+	outArgList.emplace_back(getPathCommand("-Wl,-cache_path_lto,", cacheDir));
+#elif defined(CHALET_LINUX)
+	if (String::equals("lld", getFuseLdLinker()))
+	{
+		// These links run in the LTO link pool, so the jobs are split between the ones running at once
+		auto jobs = std::max(m_state.info.maxJobs() / m_state.info.maxLtoLinkJobs(), 1U);
+		List::addIfDoesNotExist(outArgList, fmt::format("-Wl,--thinlto-jobs={}", jobs));
+		outArgList.emplace_back(getPathCommand("-Wl,--thinlto-cache-dir=", cacheDir));
+	}
+#else
+	UNUSED(cacheDir);
+#endif
+}
+
 /*****************************************************************************/
 bool LinkerLLVMClang::addArchitecture(StringList& outArgList, const std::string& inArch) const
 {
@@ -100,7 +146,11 @@ bool LinkerLLVMClang::addArchitecture(StringList& outArgList, const std::string&
 /*****************************************************************************/
 void LinkerLLVMClang::addFuseLdOption(StringList& outArgList) const
 {
+#if defined(CHALET_LINUX)
+	LinkerGCC::addFuseLdOption(outArgList);
+#else
 	UNUSED(outArgList);
+#endif
 }
 
 /*****************************************************************************/
@@ -22,6 +22,7 @@ protected:
 	virtual void addLibStdCppLinkerOption(StringList& outArgList) const override;
 	virtual void addSanitizerOptions(StringList& outArgList) const override;
 	virtual void addStaticCompilerLibraries(StringList& outArgList) const override;
+	virtual void addLinkTimeOptimizations(StringList& outArgList) const override;
 	virtual bool addArchitecture(StringList& outArgList, const std::string& inArch) const override;
 
 	// Linking (Misc)
@@ -160,6 +160,7 @@ bool IModuleStrategy::buildProject(const SourceTarget& inProject)
 		// Output::lineBreak();
 
 		auto settings = m_compileAdapter.getCommandPoolSettings();
+		settings.target = m_project->name();
 		settings.startIndex = 1;
 		settings.total = 0;
 
@@ -568,6 +569,10 @@ CommandPool::CmdList IModuleStrategy::getModuleCommands(const SourceFileGroupLis
 				cmd.command = toolchain->compilerCxx->getModuleCommand(inputFile, target, dependency, bmiFile, blankList, blankList, type);
 			}
 			cmd.reference = source;
+			cmd.outputFile = target;
+
+			if (m_project->isHeavyFile(source))
+				cmd.pool = CommandPool::Pool::Heavy;
 
 			if (cmd.command.empty())
 				continue;
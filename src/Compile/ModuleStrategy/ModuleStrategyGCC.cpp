@@ -303,7 +303,7 @@ bool ModuleStrategyGCC::scanHeaderUnitsForModuleDependencies(CommandPool::Job& o
 		auto outputFile = m_state.environment->getModuleDirectivesDependencyFile(mapFile);
 		// if (!Files::pathExists(outputFile))
 		{
-			Files::createFileWithContents(outputFile, contents, true);
+			Files::createFileWithContentsIfChanged(outputFile, contents, true);
 		}
 	}
 
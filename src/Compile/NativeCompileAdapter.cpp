@@ -8,6 +8,7 @@
 #include "BuildEnvironment/IBuildEnvironment.hpp"
 #include "Cache/SourceCache.hpp"
 #include "Cache/WorkspaceCache.hpp"
+#include "State/BuildConfiguration.hpp"
 #include "State/BuildInfo.hpp"
 #include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
@@ -16,6 +17,7 @@
 #include "State/Target/MesonTarget.hpp"
 #include "State/Target/SourceTarget.hpp"
 #include "State/Target/SubChaletTarget.hpp"
+#include "System/BatchStat.hpp"
 #include "System/Files.hpp"
 #include "Terminal/Output.hpp"
 #include "Utility/List.hpp"
@@ -39,36 +41,13 @@ void NativeCompileAdapter::addChangedTarget(const SourceTarget& inProject)
 /*****************************************************************************/
 bool NativeCompileAdapter::checkDependentTargets(const SourceTarget& inProject) const
 {
-	bool result = false;
-
-	auto links = List::combineRemoveDuplicates(inProject.projectSharedLinks(), inProject.projectStaticLinks());
-	for (auto& link : links)
-	{
-		if (List::contains(m_targetsChanged, link))
-		{
-			result = true;
-			break;
-		}
-	}
-
-	return result;
+	return !getChangedDependentTarget(inProject).empty();
 }
 
 /*****************************************************************************/
 bool NativeCompileAdapter::checkDependentMiscellaneousFiles(const SourceTarget& inProject) const
 {
-	StringList linkerFiles = inProject.getLinkerDependentFiles();
-	if (!linkerFiles.empty())
-	{
-		auto& sources = m_state.cache.file().sources();
-		for (auto& miscFile : linkerFiles)
-		{
-			if (sources.fileChangedOrDoesNotExist(miscFile))
-				return true;
-		}
-	}
-
-	return false;
+	return !getChangedMiscellaneousFile(inProject).empty();
 }
 
 /*****************************************************************************/
@@ -100,29 +79,89 @@ bool NativeCompileAdapter::anySubProjectTargetsChanged() const
 	// Note: At the moment, this forces any sources targets to re-link if the below returns true
 	//  In the future, it would be better to figure out which libraries are where
 	//
+	return !getChangedSubProjectTarget().empty();
+}
+
+/*****************************************************************************/
+std::string NativeCompileAdapter::getChangedDependentTarget(const SourceTarget& inProject) const
+{
+	auto links = List::combineRemoveDuplicates(inProject.projectSharedLinks(), inProject.projectStaticLinks());
+	for (auto& link : links)
+	{
+		if (List::contains(m_targetsChanged, link))
+			return link;
+	}
+
+	return std::string();
+}
+
+/*****************************************************************************/
+std::string NativeCompileAdapter::getChangedMiscellaneousFile(const SourceTarget& inProject) const
+{
+	StringList linkerFiles = inProject.getLinkerDependentFiles();
+	for (auto& miscFile : linkerFiles)
+	{
+		if (m_sourceCache.fileChangedOrDoesNotExist(miscFile))
+			return miscFile;
+	}
+
+	return std::string();
+}
+
+/*****************************************************************************/
+std::string NativeCompileAdapter::getChangedSubProjectTarget() const
+{
 	for (auto& target : m_state.targets)
 	{
 		if (target->isSubChalet())
 		{
 			auto& project = static_cast<const SubChaletTarget&>(*target);
 			if (project.hashChanged())
-				return true;
+				return project.name();
 		}
 		else if (target->isCMake())
 		{
 			auto& project = static_cast<const CMakeTarget&>(*target);
 			if (project.hashChanged())
-				return true;
+				return project.name();
 		}
 		else if (target->isMeson())
 		{
 			auto& project = static_cast<const MesonTarget&>(*target);
 			if (project.hashChanged())
-				return true;
+				return project.name();
 		}
 	}
 
-	return false;
+	return std::string();
+}
+
+/*****************************************************************************/
+// Same as anyDependenciesChanged, but returns the first file that changed (for --explain)
+//
+std::string NativeCompileAdapter::getChangedDependency(const std::string& dependency) const
+{
+	if (Files::pathExists(dependency))
+	{
+		std::string line;
+		auto input = Files::ifstream(dependency);
+		auto lineEnd = input.widen('\n');
+		while (std::getline(input, line, lineEnd))
+		{
+			if (line.empty() || line.back() != ':')
+				continue;
+
+			line.pop_back();
+
+			if (m_dependencyCache.find(line) != m_dependencyCache.end())
+				continue;
+
+			if (m_sourceCache.fileChangedOrDoesNotExist(line))
+				return line;
+		}
+	}
+
+	return std::string();
 }
 
 /*****************************************************************************/
@@ -137,6 +176,81 @@ void NativeCompileAdapter::clearDependencyCache()
 	m_dependencyCache.clear();
 }
 
+/*****************************************************************************/
+// Everything the dirty checks look at - the sources, objects, and every file listed in the dependency
+//   files - is looked up in one batch. That means reading the dependency files first, so whether
+//   anything in them changed is decided here as well
+//
+void NativeCompileAdapter::fetchLastWriteTimes(const StringList& inFiles, const StringList& inDependencies)
+{
+	StringList files;
+	Dictionary<u32> indices;
+	auto addFile = [&files, &indices](const std::string& inFile) {
+		auto it = indices.find(inFile);
+		if (it != indices.end())
+			return it->second;
+
+		auto index = static_cast<u32>(files.size());
+		indices.emplace(inFile, index);
+		files.push_back(inFile);
+		return index;
+	};
+
+	for (auto& file : inFiles)
+		addFile(file);
+
+	StringList dependencyFiles;
+	std::vector<std::vector<u32>> dependencies;
+
+	std::string line;
+	for (auto& dependency : inDependencies)
+	{
+		auto input = Files::ifstream(dependency);
+		if (!input.is_open())
+			continue;
+
+		std::vector<u32> listed;
+		auto lineEnd = input.widen('\n');
+		while (std::getline(input, line, lineEnd))
+		{
+			if (line.empty() || line.back() != ':')
+				continue;
+
+			line.pop_back();
+			listed.push_back(addFile(line));
+		}
+
+		dependencyFiles.push_back(dependency);
+		dependencies.emplace_back(std::move(listed));
+	}
+
+	auto lastWriteTimes = BatchStat::getLastWriteTimes(files);
+	auto lastBuildTime = m_sourceCache.lastBuildTime();
+
+	for (size_t i = 0; i < dependencyFiles.size(); ++i)
+	{
+		bool changed = std::any_of(dependencies[i].begin(), dependencies[i].end(), [&lastWriteTimes, &lastBuildTime](const u32 inIndex) {
+			auto lastWrite = lastWriteTimes[inIndex];
+			return lastWrite <= 0 || lastWrite > lastBuildTime;
+		});
+		m_dependenciesChanged[dependencyFiles[i]] = changed;
+	}
+
+	Dictionary<i64> result;
+	result.reserve(files.size());
+	for (size_t i = 0; i < files.size(); ++i)
+		result.emplace(std::move(files[i]), lastWriteTimes[i]);
+
+	m_sourceCache.setLastWriteTimes(std::move(result));
+}
+
+/*****************************************************************************/
+void NativeCompileAdapter::clearLastWriteTimes()
+{
+	m_sourceCache.clearLastWriteTimes();
+	m_dependenciesChanged.clear();
+}
+
 /*****************************************************************************/
 bool NativeCompileAdapter::fileChangedOrDependentChanged(const std::string& source, const std::string& target, const std::string& dependency)
 {
@@ -151,6 +265,10 @@ bool NativeCompileAdapter::fileChangedOrDependentChanged(const std::string& sour
 /*****************************************************************************/
 bool NativeCompileAdapter::anyDependenciesChanged(const std::string& dependency)
 {
+	auto changed = m_dependenciesChanged.find(dependency);
+	if (changed != m_dependenciesChanged.end())
+		return changed->second;
+
 	// Read through all the dependencies
 	if (Files::pathExists(dependency))
 	{
@@ -189,6 +307,9 @@ CommandPool::Settings NativeCompileAdapter::getCommandPoolSettings() const
 	settings.keepGoing = m_state.info.keepGoing();
 	settings.showCommands = Output::showCommands();
 	settings.quiet = Output::quietNonBuild();
+	settings.maxHeavyJobs = m_state.info.maxHeavyJobs();
+	settings.maxLinkJobs = m_state.info.maxLinkJobs();
+	settings.maxLtoLinkJobs = m_state.info.maxLtoLinkJobs();
 
 	return settings;
 }
@@ -205,10 +326,14 @@ CommandPool::CmdList NativeCompileAdapter::getLinkCommandList(const SourceTarget
 CommandPool::Cmd NativeCompileAdapter::getLinkCommand(const SourceTarget& inProject, CompileToolchain& inToolchain, const SourceOutputs& inOutputs) const
 {
 	CommandPool::Cmd cmd;
-	cmd.command = inToolchain.getOutputTargetCommand(inOutputs.target, inOutputs.objectListLinker);
+	cmd.command = inToolchain.getOutputTargetCommandWithResponseFile(inOutputs.target, inOutputs.objectListLinker);
 
 	auto label = inProject.isStaticLibrary() ? "Archiving" : "Linking";
 	cmd.output = fmt::format("{} {}", label, inOutputs.target);
+	cmd.outputFile = inOutputs.target;
+
+	if (!inProject.isStaticLibrary())
+		cmd.pool = m_state.configuration.interproceduralOptimization() ? CommandPool::Pool::LtoLink : CommandPool::Pool::Link;
 
 	return cmd;
 }
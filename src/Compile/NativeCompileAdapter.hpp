@@ -26,8 +26,15 @@ struct NativeCompileAdapter
 	bool rebuildRequiredFromLinks(const SourceTarget& inProject) const;
 	bool anySubProjectTargetsChanged() const;
 
+	std::string getChangedDependentTarget(const SourceTarget& inProject) const;
+	std::string getChangedMiscellaneousFile(const SourceTarget& inProject) const;
+	std::string getChangedSubProjectTarget() const;
+	std::string getChangedDependency(const std::string& dependency) const;
+
 	void setDependencyCacheSize(const size_t inSize);
 	void clearDependencyCache();
+	void fetchLastWriteTimes(const StringList& inFiles, const StringList& inDependencies);
+	void clearLastWriteTimes();
 	bool fileChangedOrDependentChanged(const std::string& source, const std::string& target, const std::string& dependency);
 	bool anyDependenciesChanged(const std::string& dependency);
 
@@ -43,5 +50,6 @@ private:
 	StringList m_targetsChanged;
 
 	std::unordered_set<std::string> m_dependencyCache;
+	Dictionary<bool> m_dependenciesChanged;
 };
 }
@@ -0,0 +1,169 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Compile/RebuildExplanation.hpp"
+
+namespace chalet
+{
+namespace
+{
+/*****************************************************************************/
+const char* getReasonLabel(const RebuildExplanation::Reason inReason)
+{
+	using Reason = RebuildExplanation::Reason;
+	switch (inReason)
+	{
+		case Reason::BuildFolderRemoved:
+			return "Build folder removed";
+		case Reason::TargetMissing:
+			return "Target missing";
+		case Reason::LinkCommandChanged:
+			return "Link command changed";
+		case Reason::DependentTargetChanged:
+			return "Linked target changed";
+		case Reason::SubProjectChanged:
+			return "Sub-project changed";
+		case Reason::LinkerFileChanged:
+			return "Linker input changed";
+		case Reason::ObjectsChanged:
+			return "Objects recompiled";
+		case Reason::CompileCommandChanged:
+			return "Compile command changed";
+		case Reason::ObjectMissing:
+			return "Object file missing";
+		case Reason::SourceChanged:
+			return "Source file changed";
+		case Reason::DependencyChanged:
+			return "Dependency changed";
+		case Reason::PrecompiledHeaderChanged:
+			return "Precompiled header changed";
+		default:
+			return "Unknown";
+	}
+}
+}
+
+/*****************************************************************************/
+// Only the first reason given for a file (or target) is kept - anything after it didn't affect the decision
+//
+void RebuildExplanation::add(const Reason inReason, const std::string& inTarget, const std::string& inFile, std::string inCause, std::string inDetail)
+{
+	auto key = fmt::format("{}\n{}", inTarget, inFile);
+	if (m_decisions.find(key) != m_decisions.end())
+		return;
+
+	m_decisions.emplace(std::move(key));
+
+	Entry entry;
+	entry.target = inTarget;
+	entry.file = inFile;
+	entry.cause = std::move(inCause);
+	entry.detail = std::move(inDetail);
+	entry.reason = inReason;
+	m_entries.emplace_back(std::move(entry));
+}
+
+/*****************************************************************************/
+bool RebuildExplanation::empty() const noexcept
+{
+	return m_entries.empty();
+}
+
+/*****************************************************************************/
+const std::vector<RebuildExplanation::Entry>& RebuildExplanation::entries() const noexcept
+{
+	return m_entries;
+}
+
+/*****************************************************************************/
+// Groups the decisions by reason, then by what changed, with the most common cause first
+//   inCount limits the causes shown per reason, and the files shown per cause
+//
+std::string RebuildExplanation::getText(const size_t inCount) const
+{
+	std::string ret;
+	if (m_entries.empty())
+		return ret;
+
+	std::map<Reason, std::vector<const Entry*>> reasons;
+	for (auto& entry : m_entries)
+		reasons[entry.reason].push_back(&entry);
+
+	ret += fmt::format("**** Rebuild explanation ({} decision(s)):\n", m_entries.size());
+
+	for (auto& [reason, entries] : reasons)
+	{
+		ret += fmt::format("\n   {} ({}):\n", getReasonLabel(reason), entries.size());
+
+		std::vector<std::pair<std::string, std::vector<const Entry*>>> causes;
+		for (auto& entry : entries)
+		{
+			auto cause = entry->cause.empty() ? std::string() : fmt::format("{}{}", entry->cause, entry->detail.empty() ? std::string() : fmt::format(" - {}", entry->detail));
+			auto it = std::find_if(causes.begin(), causes.end(), [&cause](const auto& inCause) {
+				return inCause.first == cause;
+			});
+			if (it == causes.end())
+				causes.emplace_back(std::move(cause), std::vector<const Entry*>{ entry });
+			else
+				it->second.push_back(entry);
+		}
+
+		std::stable_sort(causes.begin(), causes.end(), [](const auto& inA, const auto& inB) {
+			return inA.second.size() > inB.second.size();
+		});
+
+		auto addEntries = [&ret, &inCount](const std::vector<const Entry*>& inEntries, const char* inIndent, const bool inWithDetail) {
+			size_t count = 0;
+			for (auto& entry : inEntries)
+			{
+				if (count == inCount)
+				{
+					ret += fmt::format("{}... and {} more\n", inIndent, inEntries.size() - count);
+					break;
+				}
+
+				ret += fmt::format("{}{}: {}", inIndent, entry->target, entry->file);
+				if (inWithDetail && !entry->detail.empty())
+					ret += fmt::format(" - {}", entry->detail);
+
+				ret += '\n';
+				++count;
+			}
+		};
+
+		size_t count = 0;
+		for (auto& [cause, causeEntries] : causes)
+		{
+			if (count == inCount)
+			{
+				ret += fmt::format("      ... and {} other cause(s)\n", causes.size() - count);
+				break;
+			}
+
+			if (cause.empty())
+			{
+				addEntries(causeEntries, "      ", true);
+			}
+			else
+			{
+				ret += fmt::format("      {} ({}):\n", cause, causeEntries.size());
+				addEntries(causeEntries, "         ", false);
+			}
+			++count;
+		}
+	}
+
+	return ret;
+}
+
+/*****************************************************************************/
+std::string RebuildExplanation::getStampChange(const i64 inLastBuild, const i64 inLastWrite)
+{
+	if (inLastWrite == 0)
+		return "does not exist";
+
+	return fmt::format("stamp {} > last build {} ({:+}s)", inLastWrite, inLastBuild, inLastWrite - inLastBuild);
+}
+}
@@ -0,0 +1,55 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// Records the first reason behind each rebuild decision (--explain), so unexpected rebuilds
+//   can be traced back to the header, flags or dependency that caused them
+//
+struct RebuildExplanation
+{
+	enum class Reason : u16
+	{
+		BuildFolderRemoved,
+		TargetMissing,
+		LinkCommandChanged,
+		DependentTargetChanged,
+		SubProjectChanged,
+		LinkerFileChanged,
+		ObjectsChanged,
+		CompileCommandChanged,
+		ObjectMissing,
+		SourceChanged,
+		DependencyChanged,
+		PrecompiledHeaderChanged,
+	};
+
+	struct Entry
+	{
+		std::string target;
+		std::string file;
+		std::string cause; // what changed (a header, a dependent target...)
+		std::string detail;
+		Reason reason = Reason::SourceChanged;
+	};
+
+	RebuildExplanation() = default;
+
+	void add(const Reason inReason, const std::string& inTarget, const std::string& inFile, std::string inCause, std::string inDetail = std::string());
+
+	bool empty() const noexcept;
+	const std::vector<Entry>& entries() const noexcept;
+
+	std::string getText(const size_t inCount) const;
+
+	static std::string getStampChange(const i64 inLastBuild, const i64 inLastWrite);
+
+private:
+	std::vector<Entry> m_entries;
+	std::unordered_set<std::string> m_decisions;
+};
+}
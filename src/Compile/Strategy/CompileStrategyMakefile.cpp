@@ -95,8 +95,11 @@ bool CompileStrategyMakefile::addProject(const SourceTarget& inProject)
 		auto& toolchain = m_toolchains.at(name);
 		m_generator->addProjectRecipes(inProject, *outputs, *toolchain, hash);
 
-		Files::ofstream(buildFile) << m_generator->getContents(buildFile)
-								   << std::endl;
+		if (!Files::createFileWithContentsIfChanged(buildFile, m_generator->getContents(buildFile)))
+		{
+			Diagnostic::error("Error creating file: '{}'", buildFile);
+			return false;
+		}
 
 		m_generator->reset();
 	}
@@ -6,6 +6,7 @@
 #include "Compile/Strategy/CompileStrategyNative.hpp"
 
 #include "Cache/WorkspaceCache.hpp"
+#include "State/BuildInfo.hpp"
 #include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
 #include "System/Files.hpp"
@@ -42,6 +43,9 @@ bool CompileStrategyNative::initialize()
 	if (!Files::pathExists(m_cacheFolder))
 		Files::makeDirectory(m_cacheFolder);
 
+	if (m_state.info.explain())
+		m_nativeGenerator.setExplanation(&m_explanation);
+
 	m_initialized = true;
 
 	return true;
@@ -86,7 +90,10 @@ bool CompileStrategyNative::doPostBuild() const
 /*****************************************************************************/
 bool CompileStrategyNative::buildProject(const SourceTarget& inProject)
 {
-	if (!m_nativeGenerator.buildProject(inProject))
+	bool result = m_nativeGenerator.buildProject(inProject);
+	m_nativeGenerator.addTimings(m_timingCache);
+
+	if (!result)
 	{
 		m_anyFilesUpdated = true;
 		return false;
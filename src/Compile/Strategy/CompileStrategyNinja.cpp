@@ -17,7 +17,9 @@
 #include "System/Files.hpp"
 #include "Terminal/Output.hpp"
 #include "Utility/Hash.hpp"
+#include "Utility/List.hpp"
 #include "Utility/String.hpp"
+#include "Utility/Trace.hpp"
 
 namespace chalet
 {
@@ -74,6 +76,7 @@ bool CompileStrategyNinja::addProject(const SourceTarget& inProject)
 		if (m_hashes.find(name) == m_hashes.end())
 		{
 			m_hashes.emplace(name, Hash::string(outputs->target));
+			m_targetOutputs.emplace(name, TargetOutputs{ m_state.paths.objectDir(inProject) + '/', outputs->target });
 		}
 
 		if (m_cacheNeedsUpdate)
@@ -94,8 +97,11 @@ bool CompileStrategyNinja::doPreBuild()
 	{
 		if (m_cacheNeedsUpdate)
 		{
-			Files::ofstream(m_cacheFile) << m_generator->getContents(m_cacheFolder)
-										 << std::endl;
+			if (!Files::createFileWithContentsIfChanged(m_cacheFile, m_generator->getContents(m_cacheFolder)))
+			{
+				Diagnostic::error("Error creating file: '{}'", m_cacheFile);
+				return false;
+			}
 		}
 	}
 
@@ -109,6 +115,13 @@ bool CompileStrategyNinja::buildProject(const SourceTarget& inProject)
 	if (m_hashes.find(inProject.name()) == m_hashes.end())
 		return false;
 
+	// The target was already built as part of an earlier invocation
+	if (List::contains(m_builtTargets, inProject.name()))
+	{
+		checkIfTargetWasUpdated(inProject);
+		return ICompileStrategy::buildProject(inProject);
+	}
+
 	StringList command;
 	command.push_back(ninjaExec);
 
@@ -133,7 +146,21 @@ bool CompileStrategyNinja::buildProject(const SourceTarget& inProject)
 	command.emplace_back("-d");
 	command.emplace_back("keepdepfile");
 
-	auto& hash = m_hashes.at(inProject.name());
+	// Ninja makes its own rebuild decisions, so it has to explain them too
+	if (m_state.info.explain())
+	{
+		command.emplace_back("-d");
+		command.emplace_back("explain");
+	}
+
+	// Every consecutive sources target is requested at once, so ninja can schedule
+	//   the whole graph together instead of draining between targets
+	auto group = getBuildGroup(inProject);
+	for (auto& name : group)
+	{
+		auto& hash = m_hashes.at(name);
+		command.emplace_back(fmt::format("build_{}", hash));
+	}
 
 	static const char* kNinjaStatus = "NINJA_STATUS";
 	auto oldNinjaStatus = Environment::getString(kNinjaStatus);
@@ -141,13 +168,19 @@ bool CompileStrategyNinja::buildProject(const SourceTarget& inProject)
 	const auto& color = Output::getAnsiStyle(Output::theme().build);
 	Environment::set(kNinjaStatus, fmt::format("   [%f/%t] {}", color));
 
-	command.emplace_back(fmt::format("build_{}", hash));
+	const auto ninjaStart = Trace::now();
 	bool result = Process::runNinjaBuild(command);
 
 	Environment::set(kNinjaStatus, oldNinjaStatus);
 
+	// Ninja already timed everything it ran (even if it failed part way through)
+	readNinjaLog(group, ninjaStart);
+
 	if (result)
 	{
+		for (auto& name : group)
+			m_builtTargets.emplace_back(std::move(name));
+
 		checkIfTargetWasUpdated(inProject);
 		return ICompileStrategy::buildProject(inProject);
 	}
@@ -157,4 +190,125 @@ bool CompileStrategyNinja::buildProject(const SourceTarget& inProject)
 		return false;
 	}
 }
+
+/*****************************************************************************/
+std::optional<i64> CompileStrategyNinja::getTargetDuration(const std::string& inName) const
+{
+	auto duration = m_targetDurations.find(inName);
+	if (duration == m_targetDurations.end())
+		return std::nullopt;
+
+	return duration->second;
+}
+
+/*****************************************************************************/
+StringList CompileStrategyNinja::getBuildGroup(const SourceTarget& inProject) const
+{
+	StringList ret;
+
+	bool found = false;
+	for (auto& target : m_state.targets)
+	{
+		if (!found)
+		{
+			found = target.get() == &inProject;
+			if (!found)
+				continue;
+		}
+
+		// Anything that isn't built by ninja (scripts, cmake, modules, etc.) has to run in between
+		if (!target->isSources())
+			break;
+
+		auto& project = static_cast<const SourceTarget&>(*target);
+		if (project.cppModules())
+			break;
+
+		// Sources targets that weren't added aren't required by this build
+		if (m_hashes.find(project.name()) == m_hashes.end())
+			continue;
+
+		ret.emplace_back(project.name());
+	}
+
+	return ret;
+}
+
+/*****************************************************************************/
+void CompileStrategyNinja::readNinjaLog(const StringList& inGroup, const i64 inNinjaStart)
+{
+	auto ninjaLog = fmt::format("{}/.ninja_log", m_cacheFolder);
+
+	NinjaLogEntries entries;
+	m_timingCache.readNinjaLog(ninjaLog, [&entries](const std::string& inOutputFile, const BuildTimingCache::Entry& inEntry) {
+		entries.emplace_back(inOutputFile, inEntry);
+	});
+
+	addTargetDurations(inGroup, entries);
+
+	if (!Trace::enabled())
+		return;
+
+	std::sort(entries.begin(), entries.end(), [](const auto& inA, const auto& inB) {
+		return inA.second.start < inB.second.start;
+	});
+
+	// Ninja doesn't log which of its workers ran a command, so each one goes in the first lane that's free by then
+	auto target = String::join(inGroup, ", ");
+	std::vector<i64> lanes;
+	for (auto& [outputFile, entry] : entries)
+	{
+		size_t lane = 0;
+		while (lane < lanes.size() && lanes[lane] > entry.start)
+			++lane;
+
+		if (lane == lanes.size())
+			lanes.push_back(entry.end);
+		else
+			lanes[lane] = entry.end;
+
+		Trace::Event event;
+		event.name = outputFile;
+		event.category = "ninja";
+		event.start = inNinjaStart + (entry.start * 1000);
+		event.duration = entry.duration() * 1000;
+		event.thread = Trace::laneId(fmt::format("ninja {}", lane + 1));
+		event.args.emplace_back("target", target);
+		event.args.emplace_back("output", outputFile);
+		Trace::addEvent(std::move(event));
+	}
+}
+
+/*****************************************************************************/
+// The whole group is one ninja run, so each target's share of it is the span of its own commands
+//   (the ones writing into its object folder, and its link). Nothing can be told apart if ninja
+//   recompacted its log, so the time is left with the first target then
+//
+void CompileStrategyNinja::addTargetDurations(const StringList& inGroup, const NinjaLogEntries& inEntries)
+{
+	if (inEntries.empty())
+		return;
+
+	for (auto& name : inGroup)
+	{
+		auto outputs = m_targetOutputs.find(name);
+		if (outputs == m_targetOutputs.end())
+			continue;
+
+		auto& [objectDir, target] = outputs->second;
+
+		i64 start = std::numeric_limits<i64>::max();
+		i64 end = 0;
+		for (auto& [outputFile, entry] : inEntries)
+		{
+			if (!String::equals(target, outputFile) && !String::startsWith(objectDir, outputFile))
+				continue;
+
+			start = std::min(start, entry.start);
+			end = std::max(end, entry.end);
+		}
+
+		m_targetDurations[name] = end > start ? end - start : 0;
+	}
+}
 }
@@ -23,11 +23,27 @@ struct CompileStrategyNinja final : ICompileStrategy
 	virtual bool doPreBuild() final;
 	virtual bool buildProject(const SourceTarget& inProject) final;
 
+	virtual std::optional<i64> getTargetDuration(const std::string& inName) const final;
+
 private:
+	struct TargetOutputs
+	{
+		std::string objectDir;
+		std::string target;
+	};
+	using NinjaLogEntries = std::vector<std::pair<std::string, BuildTimingCache::Entry>>;
+
+	StringList getBuildGroup(const SourceTarget& inProject) const;
+	void readNinjaLog(const StringList& inGroup, const i64 inNinjaStart);
+	void addTargetDurations(const StringList& inGroup, const NinjaLogEntries& inEntries);
+
 	std::string m_cacheFile;
 	std::string m_cacheFolder;
 
 	Dictionary<std::string> m_hashes;
+	Dictionary<TargetOutputs> m_targetOutputs;
+	Dictionary<i64> m_targetDurations;
+	StringList m_builtTargets;
 
 	bool m_initialized = false;
 	bool m_cacheNeedsUpdate = false;
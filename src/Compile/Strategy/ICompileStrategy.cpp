@@ -91,6 +91,25 @@ bool ICompileStrategy::saveCompileCommands() const
 	return true;
 }
 
+/*****************************************************************************/
+const BuildTimingCache& ICompileStrategy::timingCache() const noexcept
+{
+	return m_timingCache;
+}
+
+/*****************************************************************************/
+RebuildExplanation& ICompileStrategy::explanation() noexcept
+{
+	return m_explanation;
+}
+
+/*****************************************************************************/
+std::optional<i64> ICompileStrategy::getTargetDuration(const std::string& inName) const
+{
+	UNUSED(inName);
+	return std::nullopt;
+}
+
 /*****************************************************************************/
 void ICompileStrategy::setSourceOutputs(const SourceTarget& inProject, Unique<SourceOutputs>&& inOutputs)
 {
@@ -108,6 +127,7 @@ void ICompileStrategy::setToolchainController(const SourceTarget& inProject, Uni
 /*****************************************************************************/
 bool ICompileStrategy::doPreBuild()
 {
+	m_timingCache.loadFromPath(m_state.cache.getCachePath(m_state.cachePathId()));
 	return true;
 }
 
@@ -136,6 +156,7 @@ bool ICompileStrategy::buildProject(const SourceTarget& inProject)
 /*****************************************************************************/
 bool ICompileStrategy::doPostBuild() const
 {
+	m_timingCache.save();
 	return true;
 }
 
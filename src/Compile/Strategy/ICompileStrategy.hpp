@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include "Cache/BuildTimingCache.hpp"
 #include "Compile/CompileCommandsGenerator.hpp"
 #include "Compile/Generator/IStrategyGenerator.hpp"
+#include "Compile/RebuildExplanation.hpp"
 #include "Compile/Strategy/StrategyType.hpp"
 #include "State/SourceOutputs.hpp"
 #include "State/Target/SourceTarget.hpp"
@@ -28,6 +30,8 @@ struct ICompileStrategy
 	bool isXcodeBuild() const noexcept;
 
 	bool saveCompileCommands() const;
+	const BuildTimingCache& timingCache() const noexcept;
+	RebuildExplanation& explanation() noexcept;
 
 	void setSourceOutputs(const SourceTarget& inProject, Unique<SourceOutputs>&& inOutputs);
 	void setToolchainController(const SourceTarget& inProject, Unique<CompileToolchain>&& inToolchain);
@@ -41,6 +45,9 @@ struct ICompileStrategy
 	virtual bool buildProject(const SourceTarget& inProject);
 	virtual bool doPostBuild() const;
 
+	// How long the target itself took to build (in milliseconds), for strategies that build targets together
+	virtual std::optional<i64> getTargetDuration(const std::string& inName) const;
+
 	bool buildProjectModules(const SourceTarget& inProject);
 
 protected:
@@ -53,6 +60,8 @@ protected:
 
 	Unique<IStrategyGenerator> m_generator;
 	CompileCommandsGenerator m_compileCommandsGenerator;
+	BuildTimingCache m_timingCache;
+	RebuildExplanation m_explanation;
 
 	StrategyType m_type;
 
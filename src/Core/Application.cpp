@@ -7,12 +7,16 @@
 
 #include "Core/Router/Router.hpp"
 
+#include "Cache/ExecutableCache.hpp"
 #include "Core/Arguments/CommandLine.hpp"
 #include "SettingsJson/SettingsJsonFileTheme.hpp"
 #include "System/Files.hpp"
 #include "System/SignalHandler.hpp"
+#include "System/Trash.hpp"
 #include "Terminal/Output.hpp"
 #include "Terminal/Shell.hpp"
+#include "Utility/EventStream.hpp"
+#include "Utility/Trace.hpp"
 
 #if defined(CHALET_WIN32)
 	#include "Terminal/WindowsTerminal.hpp"
@@ -39,7 +43,32 @@ i32 Application::run(const i32 argc, const char* argv[])
 	if (m_inputs->route().isHelp())
 		return onExit(Status::Success);
 
-	if (!handleRoute())
+	const auto& traceFile = m_inputs->traceFile();
+	if (!traceFile.empty())
+		Trace::enable();
+
+	const auto& eventsFile = m_inputs->eventsFile();
+	if (!eventsFile.empty() && !EventStream::open(eventsFile))
+	{
+		Diagnostic::error("The events file could not be opened: {}", eventsFile);
+		return onExit(Status::Failure);
+	}
+
+	ExecutableCache::load(m_inputs->getGlobalDirectory());
+
+	bool result = handleRoute();
+
+	Trash::wait();
+	ExecutableCache::save();
+	EventStream::close();
+
+	if (!traceFile.empty() && !Trace::save(traceFile))
+	{
+		Diagnostic::error("The trace could not be written: {}", traceFile);
+		result = false;
+	}
+
+	if (!result)
 		return onExit(Status::Failure);
 
 	return onExit(Status::Success);
@@ -52,6 +81,7 @@ bool Application::handleRoute()
 	CHALET_TRY
 #endif
 	{
+		TraceScope traceScope("chalet");
 		Router routes(*m_inputs);
 		return routes.run();
 	}
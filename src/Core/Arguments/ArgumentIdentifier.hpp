@@ -22,6 +22,7 @@ enum class ArgumentIdentifier : u16
 	ExternalDirectory,
 	OutputDirectory,
 	DistributionDirectory,
+	ScratchDirectory,
 	// ProjectGen
 	EnvFile,
 	BuildConfiguration,
@@ -30,6 +31,10 @@ enum class ArgumentIdentifier : u16
 	BuildStrategy,
 	BuildPathStyle,
 	MaxJobs,
+	MaxLinkJobs,
+	MaxLtoLinkJobs,
+	MaxHeavyJobs,
+	TimeTraceGranularity,
 	BuildTargetName,
 	RunTargetArguments,
 	SaveSchema,
@@ -41,9 +46,16 @@ enum class ArgumentIdentifier : u16
 	OnlyRequired,
 	ShowCommands,
 	Benchmark,
+	TraceFile,
+	EventsFile,
 	LaunchProfiler,
 	KeepGoing,
 	CompilerCache,
+	FastLinker,
+	PersistScratch,
+	TimeTrace,
+	Explain,
+	ResourceUsage,
 	SaveUserToolchainGlobally,
 	SigningIdentity,
 	ProfilerConfig,
@@ -65,6 +77,10 @@ enum class ArgumentIdentifier : u16
 	ExportBuildConfigurations,
 	ExportArchitectures,
 	//
+	// Report
+	RegressionThreshold,
+	BaselineBuilds,
+	//
 	// Other
 	RouteString,
 	SettingsKey,
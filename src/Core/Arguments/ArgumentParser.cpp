@@ -70,6 +70,7 @@ ArgumentParser::ArgumentParser(const CommandLineInputs& inInputs) :
 		{ RouteType::SettingsUnset, &ArgumentParser::populateSettingsUnsetArguments },
 		{ RouteType::Validate, &ArgumentParser::populateValidateArguments },
 		{ RouteType::Query, &ArgumentParser::populateQueryArguments },
+		{ RouteType::Report, &ArgumentParser::populateReportArguments },
 		{ RouteType::Convert, &ArgumentParser::populateConvertArguments },
 		{ RouteType::TerminalTest, &ArgumentParser::populateTerminalTestArguments },
 	}),
@@ -90,6 +91,7 @@ ArgumentParser::ArgumentParser(const CommandLineInputs& inInputs) :
 		{ RouteType::SettingsUnset, "Remove the key/value pair given a valid property key." },
 		{ RouteType::Validate, "Validate JSON file(s) against a schema." },
 		{ RouteType::Query, "Query Chalet for project-specific information. Intended for IDE integrations." },
+		{ RouteType::Report, "Compare the latest build with the builds before it, and fail if it regressed." },
 		{ RouteType::Convert, "Convert the build file from one supported format to another." },
 		{ RouteType::TerminalTest, "Display all color themes and terminal capabilities." },
 	}),
@@ -113,6 +115,7 @@ ArgumentParser::ArgumentParser(const CommandLineInputs& inInputs) :
 		{ "unset", RouteType::SettingsUnset },
 		{ "validate", RouteType::Validate },
 		{ "query", RouteType::Query },
+		{ "report", RouteType::Report },
 		{ "convert", RouteType::Convert },
 		{ "termtest", RouteType::TerminalTest },
 	})
@@ -143,6 +146,16 @@ StringList ArgumentParser::getTruthyArguments() const
 		"--no-only-required",
 		"--compiler-cache",
 		"--no-compiler-cache",
+		"--fast-linker",
+		"--no-fast-linker",
+		"--persist-scratch",
+		"--no-persist-scratch",
+		"--time-trace",
+		"--no-time-trace",
+		"--resource-usage",
+		"--no-resource-usage",
+		"--explain",
+		"--no-explain",
 		"--save-user-toolchain-globally",
 		"--save-schema",
 		"--quieter",
@@ -1057,6 +1070,14 @@ MappedArgument& ArgumentParser::addTwoStringListArguments(const ArgumentIdentifi
 	return arg;
 }
 
+/*****************************************************************************/
+MappedArgument& ArgumentParser::addIntArgument(const ArgumentIdentifier inId, const char* inArgument)
+{
+	auto& arg = m_argumentList.emplace_back(inId, Variant::Kind::OptionalInteger);
+	arg.addArgument(inArgument);
+	return arg;
+}
+
 /*****************************************************************************/
 MappedArgument& ArgumentParser::addTwoIntArguments(const ArgumentIdentifier inId, const char* inShort, const char* inLong)
 {
@@ -1148,6 +1169,9 @@ void ArgumentParser::populateMainArguments()
 	subcommands.push_back(fmt::format("query {} {}", Arg::QueryType, Arg::RemainingArguments));
 	descriptions.push_back(m_routeDescriptions.at(RouteType::Query));
 
+	subcommands.push_back("report");
+	descriptions.push_back(m_routeDescriptions.at(RouteType::Report));
+
 	subcommands.push_back("termtest");
 	descriptions.push_back(m_routeDescriptions.at(RouteType::TerminalTest));
 
@@ -1229,6 +1253,13 @@ void ArgumentParser::addOutputDirArg()
 	arg.setHelp(fmt::format("The output directory of the build. [default: \"{}\"]", defaultValue));
 }
 
+/*****************************************************************************/
+void ArgumentParser::addScratchDirArg()
+{
+	auto& arg = addStringArgument(ArgumentIdentifier::ScratchDirectory, "--scratch-dir");
+	arg.setHelp("A separate root for object files & other intermediates (ex: /dev/shm). Final binaries stay in the output directory.");
+}
+
 /*****************************************************************************/
 void ArgumentParser::addExternalDirArg()
 {
@@ -1261,6 +1292,27 @@ void ArgumentParser::addMaxJobsArg()
 	arg.setHelp(fmt::format("The number of jobs to run during compilation. [default: {}]", jobs));
 }
 
+/*****************************************************************************/
+void ArgumentParser::addMaxLinkJobsArg()
+{
+	auto& arg = addIntArgument(ArgumentIdentifier::MaxLinkJobs, "--max-link-jobs");
+	arg.setHelp("The number of link jobs to run at once in ninja builds, or 0 for no limit. [default: 0]");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addMaxLtoLinkJobsArg()
+{
+	auto& arg = addIntArgument(ArgumentIdentifier::MaxLtoLinkJobs, "--max-lto-link-jobs");
+	arg.setHelp("The number of link-time optimized link jobs to run at once in ninja builds, or 0 for one. [default: 0]");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addMaxHeavyJobsArg()
+{
+	auto& arg = addIntArgument(ArgumentIdentifier::MaxHeavyJobs, "--max-heavy-jobs");
+	arg.setHelp("The number of 'heavyFiles' to compile at once, or 0 for one per 4 jobs. [default: 0]");
+}
+
 /*****************************************************************************/
 void ArgumentParser::addEnvFileArg()
 {
@@ -1422,6 +1474,62 @@ void ArgumentParser::addCompilerCacheArg()
 	arg.setHelp("Use a compiler cache (ie. ccache) if available.");
 }
 
+/*****************************************************************************/
+void ArgumentParser::addFastLinkerArg()
+{
+	auto& arg = addOptionalBoolArgument(ArgumentIdentifier::FastLinker, "--[no-]fast-linker");
+	arg.setHelp("Link with the first of mold, lld or gold that works, in that order, in native & ninja builds.");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addPersistScratchArg()
+{
+	auto& arg = addOptionalBoolArgument(ArgumentIdentifier::PersistScratch, "--[no-]persist-scratch");
+	arg.setHelp("Keep a copy of the scratch directory in the build folder after each successful build, and restore it if the scratch directory is cleared.");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addTimeTraceArg()
+{
+	auto& arg = addOptionalBoolArgument(ArgumentIdentifier::TimeTrace, "--[no-]time-trace");
+	arg.setHelp("Profile each compile with -ftime-trace (Clang only) and summarize the results after the build.");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addTimeTraceGranularityArg()
+{
+	auto& arg = addIntArgument(ArgumentIdentifier::TimeTraceGranularity, "--time-trace-granularity");
+	arg.setHelp("The minimum time (in microseconds) of an event recorded by --time-trace, or 0 for the compiler's default. [default: 0]");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addExplainArg()
+{
+	auto& arg = addOptionalBoolArgument(ArgumentIdentifier::Explain, "--[no-]explain");
+	arg.setHelp("Print why each target and file was rebuilt.");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addResourceUsageArg()
+{
+	auto& arg = addOptionalBoolArgument(ArgumentIdentifier::ResourceUsage, "--[no-]resource-usage");
+	arg.setHelp("Summarize the CPU time, memory and page faults of each compile, link & script command after the build.");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addTraceFileArg()
+{
+	auto& arg = addStringArgument(ArgumentIdentifier::TraceFile, "--trace");
+	arg.setHelp("Write a trace of the command to the given file. (open with ui.perfetto.dev or chrome://tracing)");
+}
+
+/*****************************************************************************/
+void ArgumentParser::addEventsFileArg()
+{
+	auto& arg = addStringArgument(ArgumentIdentifier::EventsFile, "--events");
+	arg.setHelp("Write build events as newline-delimited JSON to the given file, or file descriptor number.");
+}
+
 /*****************************************************************************/
 void ArgumentParser::addSigningIdentityArg()
 {
@@ -1494,6 +1602,7 @@ void ArgumentParser::populateCommonBuildArguments()
 	addRootDirArg();
 	addExternalDirArg();
 	addOutputDirArg();
+	addScratchDirArg();
 	addDistributionDirArg();
 	addBuildConfigurationArg();
 	addToolchainArg();
@@ -1502,6 +1611,9 @@ void ArgumentParser::populateCommonBuildArguments()
 	addBuildPathStyleArg();
 	addEnvFileArg();
 	addMaxJobsArg();
+	addMaxLinkJobsArg();
+	addMaxLtoLinkJobsArg();
+	addMaxHeavyJobsArg();
 	addOsTargetNameArg();
 	addOsTargetVersionArg();
 	addSigningIdentityArg();
@@ -1509,9 +1621,17 @@ void ArgumentParser::populateCommonBuildArguments()
 	addShowCommandsArg();
 	addDumpAssemblyArg();
 	addBenchmarkArg();
+	addTraceFileArg();
+	addEventsFileArg();
 	addLaunchProfilerArg();
 	addKeepGoingArg();
 	addCompilerCacheArg();
+	addFastLinkerArg();
+	addPersistScratchArg();
+	addTimeTraceArg();
+	addTimeTraceGranularityArg();
+	addExplainArg();
+	addResourceUsageArg();
 	addGenerateCompileCommandsArg();
 	addOnlyRequiredArg();
 	addSaveUserToolchainGloballyArg();
@@ -1657,6 +1777,23 @@ void ArgumentParser::populateQueryArguments()
 	arg2.setHelp("Data to provide to the query. (architecture: <toolchain-name>)");
 }
 
+/*****************************************************************************/
+void ArgumentParser::populateReportArguments()
+{
+	addInputFileArg();
+	addSettingsFileArg();
+	addRootDirArg();
+	addOutputDirArg();
+	addBuildConfigurationArg();
+	addToolchainArg();
+
+	auto& arg1 = addIntArgument(ArgumentIdentifier::RegressionThreshold, "--regression-threshold");
+	arg1.setHelp("The percentage a phase or target can be slower than the baseline before it counts as a regression. [default: 10]");
+
+	auto& arg2 = addIntArgument(ArgumentIdentifier::BaselineBuilds, "--baseline-builds");
+	arg2.setHelp("The number of earlier comparable builds to take the baseline (median) from. [default: 10]");
+}
+
 /*****************************************************************************/
 void ArgumentParser::populateTerminalTestArguments()
 {
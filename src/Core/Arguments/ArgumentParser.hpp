@@ -55,6 +55,7 @@ private:
 	MappedArgument& addStringArgument(const ArgumentIdentifier inId, const char* inArg, std::string inDefaultValue = std::string());
 	MappedArgument& addTwoStringArguments(const ArgumentIdentifier inId, const char* inShort, const char* inLong, std::string inDefaultValue = std::string());
 	MappedArgument& addTwoStringListArguments(const ArgumentIdentifier inId, const char* inShort, const char* inLong, StringList inDefaultValue = StringList());
+	MappedArgument& addIntArgument(const ArgumentIdentifier inId, const char* inArgument);
 	MappedArgument& addTwoIntArguments(const ArgumentIdentifier inId, const char* inShort, const char* inLong);
 	MappedArgument& addBoolArgument(const ArgumentIdentifier inId, const char* inArgument, const bool inDefaultValue);
 	MappedArgument& addOptionalBoolArgument(const ArgumentIdentifier inId, const char* inArgument);
@@ -71,12 +72,16 @@ private:
 	void addRootDirArg();
 	void addExternalDirArg();
 	void addOutputDirArg();
+	void addScratchDirArg();
 	void addDistributionDirArg();
 	void addToolchainArg();
 	void addArchArg();
 	void addBuildStrategyArg();
 	void addBuildPathStyleArg();
 	void addMaxJobsArg();
+	void addMaxLinkJobsArg();
+	void addMaxLtoLinkJobsArg();
+	void addMaxHeavyJobsArg();
 	void addEnvFileArg();
 	void addBuildConfigurationArg();
 	void addExportBuildConfigurationsArg();
@@ -93,9 +98,17 @@ private:
 	void addOnlyRequiredArg();
 	void addShowCommandsArg();
 	void addBenchmarkArg();
+	void addTraceFileArg();
+	void addEventsFileArg();
 	void addLaunchProfilerArg();
 	void addKeepGoingArg();
 	void addCompilerCacheArg();
+	void addFastLinkerArg();
+	void addPersistScratchArg();
+	void addTimeTraceArg();
+	void addTimeTraceGranularityArg();
+	void addExplainArg();
+	void addResourceUsageArg();
 	void addSigningIdentityArg();
 	void addProfilerConfigArg();
 	void addOsTargetNameArg();
@@ -117,6 +130,7 @@ private:
 	void populateConvertArguments();
 	void populateValidateArguments();
 	void populateQueryArguments();
+	void populateReportArguments();
 	void populateTerminalTestArguments();
 
 #if defined(CHALET_DEBUG)
@@ -89,6 +89,10 @@ Unique<CommandLineInputs> CommandLine::read(const i32 argc, const char* argv[],
 						distributionDirectory = variant.asString();
 						break;
 
+					case ArgumentIdentifier::ScratchDirectory:
+						inputs->setScratchDirectory(variant.asString());
+						break;
+
 					case ArgumentIdentifier::Toolchain:
 						toolchainPreference = variant.asString();
 						break;
@@ -97,6 +101,14 @@ Unique<CommandLineInputs> CommandLine::read(const i32 argc, const char* argv[],
 						inputs->setSigningIdentity(variant.asString());
 						break;
 
+					case ArgumentIdentifier::TraceFile:
+						inputs->setTraceFile(variant.asString());
+						break;
+
+					case ArgumentIdentifier::EventsFile:
+						inputs->setEventsFile(variant.asString());
+						break;
+
 					case ArgumentIdentifier::ProfilerConfig:
 						inputs->setProfilerConfig(variant.asString());
 						break;
@@ -208,9 +220,37 @@ Unique<CommandLineInputs> CommandLine::read(const i32 argc, const char* argv[],
 
 				i32 value = *rawValue;
 
-				if (id == ArgumentIdentifier::MaxJobs)
+				switch (id)
 				{
-					inputs->setMaxJobs(static_cast<u32>(value));
+					case ArgumentIdentifier::MaxJobs:
+						inputs->setMaxJobs(static_cast<u32>(value));
+						break;
+
+					case ArgumentIdentifier::MaxLinkJobs:
+						inputs->setMaxLinkJobs(static_cast<u32>(std::max(value, 0)));
+						break;
+
+					case ArgumentIdentifier::MaxLtoLinkJobs:
+						inputs->setMaxLtoLinkJobs(static_cast<u32>(std::max(value, 0)));
+						break;
+
+					case ArgumentIdentifier::MaxHeavyJobs:
+						inputs->setMaxHeavyJobs(static_cast<u32>(std::max(value, 0)));
+						break;
+
+					case ArgumentIdentifier::TimeTraceGranularity:
+						inputs->setTimeTraceGranularity(static_cast<u32>(std::max(value, 0)));
+						break;
+
+					case ArgumentIdentifier::RegressionThreshold:
+						inputs->setRegressionThreshold(static_cast<u32>(std::max(value, 0)));
+						break;
+
+					case ArgumentIdentifier::BaselineBuilds:
+						inputs->setBaselineBuilds(static_cast<u32>(std::max(value, 1)));
+						break;
+
+					default: break;
 				}
 				break;
 			}
@@ -248,6 +288,26 @@ Unique<CommandLineInputs> CommandLine::read(const i32 argc, const char* argv[],
 						inputs->setCompilerCache(value);
 						break;
 
+					case ArgumentIdentifier::FastLinker:
+						inputs->setFastLinker(value);
+						break;
+
+					case ArgumentIdentifier::PersistScratch:
+						inputs->setPersistScratch(value);
+						break;
+
+					case ArgumentIdentifier::TimeTrace:
+						inputs->setTimeTrace(value);
+						break;
+
+					case ArgumentIdentifier::Explain:
+						inputs->setExplain(value);
+						break;
+
+					case ArgumentIdentifier::ResourceUsage:
+						inputs->setResourceUsage(value);
+						break;
+
 					case ArgumentIdentifier::GenerateCompileCommands:
 						inputs->setGenerateCompileCommands(value);
 						break;
@@ -371,6 +371,22 @@ void CommandLineInputs::setDistributionDirectory(std::string&& inValue) noexcept
 	Path::toUnix(m_distributionDirectory);
 	// clearWorkingDirectory(m_distributionDirectory);
 }
+
+/*****************************************************************************/
+const std::string& CommandLineInputs::scratchDirectory() const noexcept
+{
+	return m_scratchDirectory;
+}
+
+void CommandLineInputs::setScratchDirectory(std::string&& inValue) noexcept
+{
+	if (inValue.empty())
+		return;
+
+	m_scratchDirectory = std::move(inValue);
+
+	Path::toUnix(m_scratchDirectory);
+}
 /*****************************************************************************/
 const std::string& CommandLineInputs::defaultInputFile() const noexcept
 {
@@ -869,6 +885,37 @@ void CommandLineInputs::setProfilerConfig(std::string&& inValue) noexcept
 	m_profilerConfig = std::move(inValue);
 }
 
+/*****************************************************************************/
+const std::string& CommandLineInputs::traceFile() const noexcept
+{
+	return m_traceFile;
+}
+void CommandLineInputs::setTraceFile(std::string&& inValue) noexcept
+{
+	if (inValue.empty())
+		return;
+
+	// Resolved before --root-dir changes the working directory
+	m_traceFile = Files::getAbsolutePath(inValue);
+}
+
+/*****************************************************************************/
+const std::string& CommandLineInputs::eventsFile() const noexcept
+{
+	return m_eventsFile;
+}
+void CommandLineInputs::setEventsFile(std::string&& inValue) noexcept
+{
+	if (inValue.empty())
+		return;
+
+	// A file descriptor number is kept as-is
+	if (inValue.find_first_not_of("0123456789") == std::string::npos)
+		m_eventsFile = std::move(inValue);
+	else
+		m_eventsFile = Files::getAbsolutePath(inValue);
+}
+
 /*****************************************************************************/
 const std::string& CommandLineInputs::osTargetName() const noexcept
 {
@@ -1116,6 +1163,39 @@ void CommandLineInputs::setMaxJobs(const u32 inValue) noexcept
 	m_maxJobs = std::max(inValue, 1U);
 }
 
+/*****************************************************************************/
+const std::optional<u32>& CommandLineInputs::maxLinkJobs() const noexcept
+{
+	return m_maxLinkJobs;
+}
+
+void CommandLineInputs::setMaxLinkJobs(const u32 inValue) noexcept
+{
+	m_maxLinkJobs = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<u32>& CommandLineInputs::maxLtoLinkJobs() const noexcept
+{
+	return m_maxLtoLinkJobs;
+}
+
+void CommandLineInputs::setMaxLtoLinkJobs(const u32 inValue) noexcept
+{
+	m_maxLtoLinkJobs = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<u32>& CommandLineInputs::maxHeavyJobs() const noexcept
+{
+	return m_maxHeavyJobs;
+}
+
+void CommandLineInputs::setMaxHeavyJobs(const u32 inValue) noexcept
+{
+	m_maxHeavyJobs = inValue;
+}
+
 /*****************************************************************************/
 const std::optional<bool>& CommandLineInputs::dumpAssembly() const noexcept
 {
@@ -1179,6 +1259,66 @@ void CommandLineInputs::setCompilerCache(const bool inValue) noexcept
 	m_compilerCache = inValue;
 }
 
+/*****************************************************************************/
+const std::optional<bool>& CommandLineInputs::fastLinker() const noexcept
+{
+	return m_fastLinker;
+}
+void CommandLineInputs::setFastLinker(const bool inValue) noexcept
+{
+	m_fastLinker = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<bool>& CommandLineInputs::persistScratch() const noexcept
+{
+	return m_persistScratch;
+}
+void CommandLineInputs::setPersistScratch(const bool inValue) noexcept
+{
+	m_persistScratch = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<bool>& CommandLineInputs::timeTrace() const noexcept
+{
+	return m_timeTrace;
+}
+void CommandLineInputs::setTimeTrace(const bool inValue) noexcept
+{
+	m_timeTrace = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<u32>& CommandLineInputs::timeTraceGranularity() const noexcept
+{
+	return m_timeTraceGranularity;
+}
+void CommandLineInputs::setTimeTraceGranularity(const u32 inValue) noexcept
+{
+	m_timeTraceGranularity = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<bool>& CommandLineInputs::explain() const noexcept
+{
+	return m_explain;
+}
+void CommandLineInputs::setExplain(const bool inValue) noexcept
+{
+	m_explain = inValue;
+}
+
+/*****************************************************************************/
+const std::optional<bool>& CommandLineInputs::resourceUsage() const noexcept
+{
+	return m_resourceUsage;
+}
+void CommandLineInputs::setResourceUsage(const bool inValue) noexcept
+{
+	m_resourceUsage = inValue;
+}
+
 /*****************************************************************************/
 const std::optional<bool>& CommandLineInputs::generateCompileCommands() const noexcept
 {
@@ -1230,6 +1370,26 @@ void CommandLineInputs::setCleanAll(const bool inValue) noexcept
 	m_cleanAll = inValue;
 }
 
+/*****************************************************************************/
+u32 CommandLineInputs::regressionThreshold() const noexcept
+{
+	return m_regressionThreshold;
+}
+void CommandLineInputs::setRegressionThreshold(const u32 inValue) noexcept
+{
+	m_regressionThreshold = inValue;
+}
+
+/*****************************************************************************/
+u32 CommandLineInputs::baselineBuilds() const noexcept
+{
+	return m_baselineBuilds;
+}
+void CommandLineInputs::setBaselineBuilds(const u32 inValue) noexcept
+{
+	m_baselineBuilds = inValue;
+}
+
 /*****************************************************************************/
 StringList CommandLineInputs::getToolchainPresets() const
 {
@@ -60,6 +60,9 @@ struct CommandLineInputs
 	const std::string& distributionDirectory() const noexcept;
 	void setDistributionDirectory(std::string&& inValue) noexcept;
 
+	const std::string& scratchDirectory() const noexcept;
+	void setScratchDirectory(std::string&& inValue) noexcept;
+
 	const CommandRoute& route() const noexcept;
 	void setRoute(const CommandRoute& inValue) noexcept;
 
@@ -133,6 +136,12 @@ struct CommandLineInputs
 	const std::string& profilerConfig() const noexcept;
 	void setProfilerConfig(std::string&& inValue) noexcept;
 
+	const std::string& traceFile() const noexcept;
+	void setTraceFile(std::string&& inValue) noexcept;
+
+	const std::string& eventsFile() const noexcept;
+	void setEventsFile(std::string&& inValue) noexcept;
+
 	const std::string& osTargetName() const noexcept;
 	void setOsTargetName(std::string&& inValue) noexcept;
 	std::string getDefaultOsTargetName() const;
@@ -174,6 +183,15 @@ struct CommandLineInputs
 	const std::optional<u32>& maxJobs() const noexcept;
 	void setMaxJobs(const u32 inValue) noexcept;
 
+	const std::optional<u32>& maxLinkJobs() const noexcept;
+	void setMaxLinkJobs(const u32 inValue) noexcept;
+
+	const std::optional<u32>& maxLtoLinkJobs() const noexcept;
+	void setMaxLtoLinkJobs(const u32 inValue) noexcept;
+
+	const std::optional<u32>& maxHeavyJobs() const noexcept;
+	void setMaxHeavyJobs(const u32 inValue) noexcept;
+
 	const std::optional<bool>& dumpAssembly() const noexcept;
 	void setDumpAssembly(const bool inValue) noexcept;
 
@@ -192,6 +210,24 @@ struct CommandLineInputs
 	const std::optional<bool>& compilerCache() const noexcept;
 	void setCompilerCache(const bool inValue) noexcept;
 
+	const std::optional<bool>& fastLinker() const noexcept;
+	void setFastLinker(const bool inValue) noexcept;
+
+	const std::optional<bool>& persistScratch() const noexcept;
+	void setPersistScratch(const bool inValue) noexcept;
+
+	const std::optional<bool>& timeTrace() const noexcept;
+	void setTimeTrace(const bool inValue) noexcept;
+
+	const std::optional<u32>& timeTraceGranularity() const noexcept;
+	void setTimeTraceGranularity(const u32 inValue) noexcept;
+
+	const std::optional<bool>& explain() const noexcept;
+	void setExplain(const bool inValue) noexcept;
+
+	const std::optional<bool>& resourceUsage() const noexcept;
+	void setResourceUsage(const bool inValue) noexcept;
+
 	const std::optional<bool>& generateCompileCommands() const noexcept;
 	void setGenerateCompileCommands(const bool inValue) noexcept;
 
@@ -207,6 +243,12 @@ struct CommandLineInputs
 	bool cleanAll() const noexcept;
 	void setCleanAll(const bool inValue) noexcept;
 
+	u32 regressionThreshold() const noexcept;
+	void setRegressionThreshold(const u32 inValue) noexcept;
+
+	u32 baselineBuilds() const noexcept;
+	void setBaselineBuilds(const u32 inValue) noexcept;
+
 	StringList getToolchainPresets() const;
 	StringList getExportKindPresets() const;
 	StringList getConvertFormatPresets() const;
@@ -237,6 +279,7 @@ private:
 	std::string m_outputDirectory;
 	std::string m_externalDirectory;
 	std::string m_distributionDirectory;
+	std::string m_scratchDirectory;
 	std::string m_buildConfiguration;
 	std::string m_buildFromCommandLine;
 	mutable std::string m_lastTarget;
@@ -248,6 +291,8 @@ private:
 	std::string m_buildPathStylePreference;
 	std::string m_signingIdentity;
 	std::string m_profilerConfig;
+	std::string m_traceFile;
+	std::string m_eventsFile;
 	std::string m_osTargetName;
 	std::string m_osTargetVersion;
 
@@ -262,12 +307,21 @@ private:
 	mutable std::string m_targetArchitecture;
 
 	std::optional<u32> m_maxJobs;
+	std::optional<u32> m_maxLinkJobs;
+	std::optional<u32> m_maxLtoLinkJobs;
+	std::optional<u32> m_maxHeavyJobs;
+	std::optional<u32> m_timeTraceGranularity;
 	std::optional<bool> m_dumpAssembly;
 	std::optional<bool> m_showCommands;
 	std::optional<bool> m_benchmark;
 	std::optional<bool> m_launchProfiler;
 	std::optional<bool> m_keepGoing;
 	std::optional<bool> m_compilerCache;
+	std::optional<bool> m_fastLinker;
+	std::optional<bool> m_persistScratch;
+	std::optional<bool> m_timeTrace;
+	std::optional<bool> m_explain;
+	std::optional<bool> m_resourceUsage;
 	std::optional<bool> m_generateCompileCommands;
 	mutable std::optional<bool> m_onlyRequired;
 
@@ -280,6 +334,9 @@ private:
 
 	mutable VisualStudioVersion m_visualStudioVersion = VisualStudioVersion::None;
 
+	u32 m_regressionThreshold = 10;
+	u32 m_baselineBuilds = 10;
+
 	bool m_saveSchemaToFile = false;
 	mutable bool m_isToolchainPreset = false;
 	mutable bool m_isMultiArchToolchainPreset = false;
@@ -89,6 +89,12 @@ constexpr bool CommandRoute::isQuery() const noexcept
 	return m_route == RouteType::Query;
 }
 
+/*****************************************************************************/
+constexpr bool CommandRoute::isReport() const noexcept
+{
+	return m_route == RouteType::Report;
+}
+
 /*****************************************************************************/
 constexpr bool CommandRoute::isValidate() const noexcept
 {
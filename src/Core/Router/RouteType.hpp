@@ -27,6 +27,7 @@ enum class RouteType : u16
 	SettingsUnset,
 	Validate,
 	Query,
+	Report,
 	Convert,
 	TerminalTest,
 #if defined(CHALET_DEBUG)
@@ -11,6 +11,7 @@
 
 #include "BuildEnvironment/IBuildEnvironment.hpp"
 #include "Builder/BatchValidator.hpp"
+#include "Builder/BuildHistoryReport.hpp"
 #include "ChaletJson/ChaletJsonSchema.hpp"
 #include "Check/BuildFileChecker.hpp"
 #include "Convert/BuildFileConverter.hpp"
@@ -79,6 +80,9 @@ bool Router::run()
 		case RouteType::Query:
 			return routeQuery();
 
+		case RouteType::Report:
+			return routeReport();
+
 		case RouteType::Convert:
 			return routeConvert();
 
@@ -125,6 +129,15 @@ bool Router::runRoutesThatRequireState()
 	if (!centralState->initialize())
 		return false;
 
+	// Nothing the last build used has changed, so there's no build state to load
+	if (centralState->cache.fingerprint().upToDate())
+	{
+		bool result = routeUpToDate(*centralState);
+		UpdateNotifier::checkForUpdates(*centralState);
+		centralState->saveCaches();
+		return result;
+	}
+
 	bool cleanAll = route.isClean() && m_inputs.cleanAll();
 	if (!route.isExport() && !cleanAll)
 	{
@@ -211,6 +224,24 @@ bool Router::routeConfigure(BuildState& inState)
 	return true;
 }
 
+/*****************************************************************************/
+bool Router::routeUpToDate(const CentralState& inCentralState)
+{
+	Output::lineBreak();
+
+	for (auto& target : inCentralState.cache.fingerprint().targets())
+	{
+		Output::msgTargetOfType("Build", target, Output::theme().header);
+		Output::msgTargetUpToDate(target, nullptr);
+		Output::lineBreak();
+	}
+
+	Output::msgBuildSuccess();
+	Output::lineBreak();
+
+	return true;
+}
+
 /*****************************************************************************/
 bool Router::routeBundle(BuildState& inState)
 {
@@ -306,6 +337,39 @@ bool Router::routeQuery()
 	return query.printListOfRequestedType();
 }
 
+/*****************************************************************************/
+bool Router::routeReport()
+{
+	CentralState centralState(m_inputs);
+	if (!centralState.initialize())
+		return false;
+
+	BuildHistory history(m_inputs.outputDirectory());
+	if (!history.load())
+		return false;
+
+	BuildHistoryReport report(m_inputs.regressionThreshold(), m_inputs.baselineBuilds());
+	if (!report.compare(history.records(), m_inputs.buildConfiguration(), m_inputs.toolchainPreferenceName()))
+	{
+		Diagnostic::error("No '{}' builds with '{}' were found in: {}", m_inputs.buildConfiguration(), m_inputs.toolchainPreferenceName(), history.filename());
+		return false;
+	}
+
+	auto text = report.getText();
+
+	Output::lineBreak();
+	std::cout.write(text.data(), text.size());
+	std::cout.flush();
+
+	if (report.regressions() > 0)
+	{
+		Diagnostic::error("The latest build regressed in {} place(s) by more than {}% compared to the baseline.", report.regressions(), m_inputs.regressionThreshold());
+		return false;
+	}
+
+	return true;
+}
+
 /*****************************************************************************/
 bool Router::routeConvert()
 {
@@ -22,9 +22,11 @@ private:
 	bool runRoutesThatRequireState();
 
 	bool routeConfigure(BuildState& inState);
+	bool routeUpToDate(const CentralState& inCentralState);
 	bool routeBundle(BuildState& inState);
 	bool routeValidate();
 	bool routeQuery();
+	bool routeReport();
 	bool routeConvert();
 
 	bool routeExport(CentralState& inCentralState);
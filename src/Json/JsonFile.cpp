@@ -9,6 +9,7 @@
 #include "Terminal/Output.hpp"
 #include "Utility/List.hpp"
 #include "Utility/String.hpp"
+#include "Utility/Trace.hpp"
 #include "Yaml/YamlFile.hpp"
 #include "Json/JsonComments.hpp"
 #include "Json/JsonValidator.hpp"
@@ -33,10 +34,19 @@ bool JsonFile::saveToFile(const Json& inJson, const std::string& outFilename, co
 			return false;
 	}
 
+	std::string contents;
 	if ((inIndent < -1 || inIndent > 4) || inIndent == 1)
-		Files::ofstream(outFilename) << json::dump(inJson, 1, '\t') << std::endl;
+		contents = json::dump(inJson, 1, '\t');
 	else
-		Files::ofstream(outFilename) << json::dump(inJson, inIndent) << std::endl;
+		contents = json::dump(inJson, inIndent);
+
+	contents += '\n';
+
+	// Nothing changed, so the file (and its last write time) is left as it was
+	if (String::equals(contents, Files::getFileContents(outFilename)))
+		return true;
+
+	Files::ofstream(outFilename) << contents;
 
 	return true;
 }
@@ -147,6 +157,8 @@ bool JsonFile::validate(const Json& inSchemaJson) const
 	if (m_filename.empty())
 		return false;
 
+	TraceScope traceScope("JsonFile::validate", m_filename);
+
 	JsonValidator validator;
 	if (!validator.setSchema(inSchemaJson))
 		return false;
@@ -71,11 +71,20 @@ CHALET_CONSTANT(OptionsDumpAssembly) = "dumpAssembly";
 CHALET_CONSTANT(OptionsGenerateCompileCommands) = "generateCompileCommands";
 CHALET_CONSTANT(OptionsOnlyRequired) = "onlyRequired";
 CHALET_CONSTANT(OptionsMaxJobs) = "maxJobs";
+CHALET_CONSTANT(OptionsMaxLinkJobs) = "maxLinkJobs";
+CHALET_CONSTANT(OptionsMaxLtoLinkJobs) = "maxLtoLinkJobs";
+CHALET_CONSTANT(OptionsMaxHeavyJobs) = "maxHeavyJobs";
 CHALET_CONSTANT(OptionsShowCommands) = "showCommands";
 CHALET_CONSTANT(OptionsBenchmark) = "benchmark";
 CHALET_CONSTANT(OptionsLaunchProfiler) = "launchProfiler";
 CHALET_CONSTANT(OptionsKeepGoing) = "keepGoing";
 CHALET_CONSTANT(OptionsCompilerCache) = "compilerCache";
+CHALET_CONSTANT(OptionsFastLinker) = "fastLinker";
+CHALET_CONSTANT(OptionsPersistScratch) = "persistScratch";
+CHALET_CONSTANT(OptionsTimeTrace) = "timeTrace";
+CHALET_CONSTANT(OptionsTimeTraceGranularity) = "timeTraceGranularity";
+CHALET_CONSTANT(OptionsExplain) = "explain";
+CHALET_CONSTANT(OptionsResourceUsage) = "resourceUsage";
 CHALET_CONSTANT(OptionsSigningIdentity) = "signingIdentity";
 CHALET_CONSTANT(OptionsProfilerConfig) = "profilerConfig";
 CHALET_CONSTANT(OptionsOsTargetName) = "osTargetName";
@@ -86,6 +95,7 @@ CHALET_CONSTANT(OptionsRootDirectory) = "rootDir";
 CHALET_CONSTANT(OptionsOutputDirectory) = "outputDir";
 CHALET_CONSTANT(OptionsExternalDirectory) = "externalDir";
 CHALET_CONSTANT(OptionsDistributionDirectory) = "distributionDir";
+CHALET_CONSTANT(OptionsScratchDirectory) = "scratchDir";
 CHALET_CONSTANT(OptionsLastTarget) = "lastTarget";
 CHALET_CONSTANT(OptionsRunArguments) = "runArguments";
 //
@@ -98,6 +108,7 @@ CHALET_CONSTANT(ToolchainCompilerCpp) = "compilerCpp";
 CHALET_CONSTANT(ToolchainCompilerC) = "compilerC";
 CHALET_CONSTANT(ToolchainCompilerWindowsResource) = "compilerWindowsResource";
 CHALET_CONSTANT(ToolchainLinker) = "linker";
+CHALET_CONSTANT(ToolchainFastLinker) = "fastLinker";
 CHALET_CONSTANT(ToolchainProfiler) = "profiler";
 CHALET_CONSTANT(ToolchainDisassembler) = "disassembler";
 CHALET_CONSTANT(ToolchainCMake) = "cmake";
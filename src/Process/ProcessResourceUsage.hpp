@@ -0,0 +1,21 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// What a process used by the time it exited (from wait4 / GetProcessTimes)
+//   Values the platform can't report are left at 0
+//
+struct ProcessResourceUsage
+{
+	i64 userTime = 0;		 // microseconds
+	i64 systemTime = 0;		 // microseconds
+	i64 maxResidentSize = 0; // kilobytes
+	i64 majorFaults = 0;
+	i64 contextSwitches = 0; // voluntary & involuntary
+};
+}
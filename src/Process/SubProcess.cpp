@@ -6,9 +6,11 @@
 #include "Process/SubProcess.hpp"
 
 #if defined(CHALET_WIN32)
+	#include <psapi.h>
 #else
 	#include <signal.h>
 	#include <string.h>
+	#include <sys/resource.h>
 	#include <sys/wait.h>
 	#include <unistd.h>
 #endif
@@ -59,6 +61,36 @@ std::string getWindowsArguments(const StringList& inCmd)
 
 	return args;
 }
+
+/*****************************************************************************/
+ProcessResourceUsage getResourceUsage(const HANDLE inProcess)
+{
+	ProcessResourceUsage ret;
+
+	// FILETIME durations are in 100 nanosecond intervals
+	auto getMicroseconds = [](const FILETIME& inTime) -> i64 {
+		ULARGE_INTEGER value;
+		value.LowPart = inTime.dwLowDateTime;
+		value.HighPart = inTime.dwHighDateTime;
+		return static_cast<i64>(value.QuadPart / 10);
+	};
+
+	FILETIME creationTime, exitTime, kernelTime, userTime;
+	if (::GetProcessTimes(inProcess, &creationTime, &exitTime, &kernelTime, &userTime) == TRUE)
+	{
+		ret.userTime = getMicroseconds(userTime);
+		ret.systemTime = getMicroseconds(kernelTime);
+	}
+
+	// Note: PageFaultCount includes soft faults, so it's not reported as majorFaults
+	PROCESS_MEMORY_COUNTERS counters;
+	if (::GetProcessMemoryInfo(inProcess, &counters, sizeof(counters)) == TRUE)
+	{
+		ret.maxResidentSize = static_cast<i64>(counters.PeakWorkingSetSize / 1024);
+	}
+
+	return ret;
+}
 }
 
 /*****************************************************************************/
@@ -105,6 +137,8 @@ i32 SubProcess::pollState()
 		return -1;
 	}
 
+	m_resourceUsage = getResourceUsage(m_processInfo.hProcess);
+
 	return static_cast<i32>(exitCode);
 }
 
@@ -154,6 +188,8 @@ i32 SubProcess::waitForResult()
 		return -1;
 	}
 
+	m_resourceUsage = getResourceUsage(m_processInfo.hProcess);
+
 	close();
 	return static_cast<i32>(exitCode);
 }
@@ -182,14 +218,43 @@ std::string SubProcess::getErrorMessageFromCode(const i32 inCode)
 	return message;
 }
 #else
+namespace
+{
+/*****************************************************************************/
+ProcessResourceUsage getResourceUsage(const struct rusage& inUsage)
+{
+	ProcessResourceUsage ret;
+
+	auto getMicroseconds = [](const struct timeval& inTime) -> i64 {
+		return (static_cast<i64>(inTime.tv_sec) * 1000000) + static_cast<i64>(inTime.tv_usec);
+	};
+
+	ret.userTime = getMicroseconds(inUsage.ru_utime);
+	ret.systemTime = getMicroseconds(inUsage.ru_stime);
+#if defined(CHALET_MACOS)
+	ret.maxResidentSize = static_cast<i64>(inUsage.ru_maxrss) / 1024; // bytes on macOS
+#else
+	ret.maxResidentSize = static_cast<i64>(inUsage.ru_maxrss);
+#endif
+	ret.majorFaults = static_cast<i64>(inUsage.ru_majflt);
+	ret.contextSwitches = static_cast<i64>(inUsage.ru_nvcsw + inUsage.ru_nivcsw);
+
+	return ret;
+}
+}
+
 /*****************************************************************************/
 i32 SubProcess::pollState()
 {
 	i32 exitCode = -1;
-	ProcessID child = ::waitpid(m_pid, &exitCode, WNOHANG);
+	struct rusage usage;
+	ProcessID child = ::wait4(m_pid, &exitCode, WNOHANG, &usage);
 	if (child == 0 || (child == -1 && errno == EINTR))
 		return -1;
 
+	if (child == m_pid)
+		m_resourceUsage = getResourceUsage(usage);
+
 	return getReturnCode(exitCode);
 }
 
@@ -197,12 +262,16 @@ i32 SubProcess::pollState()
 i32 SubProcess::waitForResult()
 {
 	i32 exitCode = -1;
+	struct rusage usage;
 	while (true)
 	{
-		ProcessID child = ::waitpid(m_pid, &exitCode, 0);
+		ProcessID child = ::wait4(m_pid, &exitCode, 0, &usage);
 		if (child == -1 && errno == EINTR)
 			continue;
 
+		if (child == m_pid)
+			m_resourceUsage = getResourceUsage(usage);
+
 		break;
 	}
 
@@ -759,6 +828,12 @@ bool SubProcess::killed()
 	return m_killed;
 }
 
+/*****************************************************************************/
+const ProcessResourceUsage& SubProcess::resourceUsage() const noexcept
+{
+	return m_resourceUsage;
+}
+
 /*****************************************************************************/
 SubProcess::ReadResult SubProcess::getInitialReadValue()
 {
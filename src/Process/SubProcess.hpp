@@ -7,6 +7,7 @@
 
 #include "Process/ProcessOptions.hpp"
 #include "Process/ProcessPipe.hpp"
+#include "Process/ProcessResourceUsage.hpp"
 #include "Process/ProcessTypes.hpp"
 #include "Process/SigNum.hpp"
 
@@ -49,6 +50,8 @@ public:
 	bool kill();
 	bool killed();
 
+	const ProcessResourceUsage& resourceUsage() const noexcept;
+
 	void read(const HandleInput& inFileNo, OutputBuffer& dataBuffer, const ProcessOptions::PipeFunc& onRead = nullptr);
 	bool readOnce(const HandleInput& inFileNo, OutputBuffer& dataBuffer, ReadResult& bytesRead);
 
@@ -68,6 +71,8 @@ private:
 	ProcessPipe m_out;
 	ProcessPipe m_err;
 
+	ProcessResourceUsage m_resourceUsage;
+
 	ProcessID m_pid = 0;
 
 	bool m_killed = false;
@@ -35,6 +35,9 @@ struct
 #endif
 } state;
 
+// Per thread, since the command pool runs processes from several at once
+thread_local ProcessResourceUsage lastResourceUsage;
+
 #if defined(CHALET_WIN32)
 /*****************************************************************************/
 void addProcess(SubProcess& inProcess)
@@ -152,6 +155,7 @@ bool SubProcessController::create(SubProcess& outProcess, const StringList& inCm
 i32 SubProcessController::getLastExitCodeFromProcess(SubProcess& process)
 {
 	state.lastErrorCode = process.waitForResult();
+	lastResourceUsage = process.resourceUsage();
 
 #if defined(CHALET_WIN32)
 	removeProcess(process);
@@ -164,6 +168,7 @@ i32 SubProcessController::getLastExitCodeFromProcess(SubProcess& process)
 i32 SubProcessController::getLastExitCodeFromProcess(SubProcess& process, const bool waitForResult)
 {
 	state.lastErrorCode = waitForResult ? process.waitForResult() : 0;
+	lastResourceUsage = process.resourceUsage();
 
 #if defined(CHALET_WIN32)
 	removeProcess(process);
@@ -180,6 +185,7 @@ i32 SubProcessController::pollProcessState(SubProcess& process)
 		return result;
 
 	state.lastErrorCode = result;
+	lastResourceUsage = process.resourceUsage();
 	return result;
 }
 
@@ -189,6 +195,12 @@ i32 SubProcessController::getLastExitCode()
 	return state.lastErrorCode;
 }
 
+/*****************************************************************************/
+const ProcessResourceUsage& SubProcessController::getLastResourceUsage()
+{
+	return lastResourceUsage;
+}
+
 /*****************************************************************************/
 std::string SubProcessController::getSystemMessage(const i32 inExitCode)
 {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Process/ProcessOptions.hpp"
+#include "Process/ProcessResourceUsage.hpp"
 #include "Process/SigNum.hpp"
 
 namespace chalet
@@ -20,6 +21,7 @@ struct SubProcessController
 	static i32 getLastExitCodeFromProcess(SubProcess& process, const bool waitForResult);
 	static i32 pollProcessState(SubProcess& process);
 	static i32 getLastExitCode();
+	static const ProcessResourceUsage& getLastResourceUsage(); // of the last process that exited on this thread
 	static std::string getSystemMessage(const i32 inExitCode);
 	static std::string getSignalRaisedMessage(const i32 inExitCode);
 	static std::string getSignalNameFromCode(const i32 inExitCode);
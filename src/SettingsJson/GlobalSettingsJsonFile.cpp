@@ -61,9 +61,18 @@ bool GlobalSettingsJsonFile::readFrom(JsonFile& inJsonFile)
 	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsLaunchProfiler, m_fallback.launchProfiler);
 	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsKeepGoing, m_fallback.keepGoing);
 	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsCompilerCache, m_fallback.compilerCache);
+	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsFastLinker, m_fallback.fastLinker);
+	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsPersistScratch, m_fallback.persistScratch);
+	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsTimeTrace, m_fallback.timeTrace);
 	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsGenerateCompileCommands, m_fallback.generateCompileCommands);
 	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsOnlyRequired, m_fallback.onlyRequired);
 	dirty |= json::assignNodeIfEmpty<u32>(jOptions, Keys::OptionsMaxJobs, m_fallback.maxJobs);
+	dirty |= json::assignNodeIfEmpty<u32>(jOptions, Keys::OptionsMaxLinkJobs, m_fallback.maxLinkJobs);
+	dirty |= json::assignNodeIfEmpty<u32>(jOptions, Keys::OptionsMaxLtoLinkJobs, m_fallback.maxLtoLinkJobs);
+	dirty |= json::assignNodeIfEmpty<u32>(jOptions, Keys::OptionsMaxHeavyJobs, m_fallback.maxHeavyJobs);
+	dirty |= json::assignNodeIfEmpty<u32>(jOptions, Keys::OptionsTimeTraceGranularity, m_fallback.timeTraceGranularity);
+	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsExplain, m_fallback.explain);
+	dirty |= json::assignNodeIfEmpty<bool>(jOptions, Keys::OptionsResourceUsage, m_fallback.resourceUsage);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsBuildConfiguration, m_fallback.buildConfiguration);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsToolchain, m_fallback.toolchainPreference);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsArchitecture, m_fallback.architecturePreference);
@@ -72,6 +81,7 @@ bool GlobalSettingsJsonFile::readFrom(JsonFile& inJsonFile)
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsOutputDirectory, m_fallback.outputDirectory);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsExternalDirectory, m_fallback.externalDirectory);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsDistributionDirectory, m_fallback.distributionDirectory);
+	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsScratchDirectory, m_fallback.scratchDirectory);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsOsTargetName, m_fallback.osTargetName);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsOsTargetVersion, m_fallback.osTargetVersion);
 	dirty |= json::assignNodeIfEmpty<std::string>(jOptions, Keys::OptionsSigningIdentity, m_fallback.signingIdentity);
@@ -129,6 +139,8 @@ void GlobalSettingsJsonFile::reassignIntermediateStateFromSettings(IntermediateS
 				outState.externalDirectory = value.get<std::string>();
 			else if (String::equals(Keys::OptionsDistributionDirectory, key))
 				outState.distributionDirectory = value.get<std::string>();
+			else if (String::equals(Keys::OptionsScratchDirectory, key))
+				outState.scratchDirectory = value.get<std::string>();
 		}
 		else if (value.is_boolean())
 		{
@@ -144,6 +156,16 @@ void GlobalSettingsJsonFile::reassignIntermediateStateFromSettings(IntermediateS
 				outState.keepGoing = value.get<bool>();
 			else if (String::equals(Keys::OptionsCompilerCache, key))
 				outState.compilerCache = value.get<bool>();
+			else if (String::equals(Keys::OptionsFastLinker, key))
+				outState.fastLinker = value.get<bool>();
+			else if (String::equals(Keys::OptionsPersistScratch, key))
+				outState.persistScratch = value.get<bool>();
+			else if (String::equals(Keys::OptionsTimeTrace, key))
+				outState.timeTrace = value.get<bool>();
+			else if (String::equals(Keys::OptionsExplain, key))
+				outState.explain = value.get<bool>();
+			else if (String::equals(Keys::OptionsResourceUsage, key))
+				outState.resourceUsage = value.get<bool>();
 			else if (String::equals(Keys::OptionsGenerateCompileCommands, key))
 				outState.generateCompileCommands = value.get<bool>();
 			else if (String::equals(Keys::OptionsOnlyRequired, key))
@@ -153,6 +175,14 @@ void GlobalSettingsJsonFile::reassignIntermediateStateFromSettings(IntermediateS
 		{
 			if (String::equals(Keys::OptionsMaxJobs, key))
 				outState.maxJobs = static_cast<u32>(value.get<i32>());
+			else if (String::equals(Keys::OptionsMaxLinkJobs, key))
+				outState.maxLinkJobs = static_cast<u32>(value.get<i32>());
+			else if (String::equals(Keys::OptionsMaxLtoLinkJobs, key))
+				outState.maxLtoLinkJobs = static_cast<u32>(value.get<i32>());
+			else if (String::equals(Keys::OptionsMaxHeavyJobs, key))
+				outState.maxHeavyJobs = static_cast<u32>(value.get<i32>());
+			else if (String::equals(Keys::OptionsTimeTraceGranularity, key))
+				outState.timeTraceGranularity = static_cast<u32>(value.get<i32>());
 		}
 	}
 
@@ -25,6 +25,7 @@ struct IntermediateSettingsState
 	std::string outputDirectory;
 	std::string externalDirectory;
 	std::string distributionDirectory;
+	std::string scratchDirectory;
 	std::string signingIdentity;
 	std::string profilerConfig;
 	std::string osTargetName;
@@ -32,10 +33,19 @@ struct IntermediateSettingsState
 	std::string lastTarget;
 
 	u32 maxJobs = 0;
+	u32 maxLinkJobs = 0;
+	u32 maxLtoLinkJobs = 0;
+	u32 maxHeavyJobs = 0;
+	u32 timeTraceGranularity = 0;
 	bool benchmark = false;
 	bool launchProfiler = false;
 	bool keepGoing = false;
 	bool compilerCache = false;
+	bool fastLinker = true;
+	bool persistScratch = false;
+	bool timeTrace = false;
+	bool explain = false;
+	bool resourceUsage = false;
 	bool showCommands = false;
 	bool dumpAssembly = false;
 	bool generateCompileCommands = false;
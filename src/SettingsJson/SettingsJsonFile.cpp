@@ -59,9 +59,18 @@ bool SettingsJsonFile::readFrom(JsonFile& inJsonFile)
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsLaunchProfiler, m_inputs.launchProfiler(), m_fallback.launchProfiler);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsKeepGoing, m_inputs.keepGoing(), m_fallback.keepGoing);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsCompilerCache, m_inputs.compilerCache(), m_fallback.compilerCache);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsFastLinker, m_inputs.fastLinker(), m_fallback.fastLinker);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsPersistScratch, m_inputs.persistScratch(), m_fallback.persistScratch);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsTimeTrace, m_inputs.timeTrace(), m_fallback.timeTrace);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsGenerateCompileCommands, m_inputs.generateCompileCommands(), m_fallback.generateCompileCommands);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsOnlyRequired, m_inputs.onlyRequired(), m_fallback.onlyRequired);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsMaxJobs, m_inputs.maxJobs(), m_fallback.maxJobs);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsMaxLinkJobs, m_inputs.maxLinkJobs(), m_fallback.maxLinkJobs);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsMaxLtoLinkJobs, m_inputs.maxLtoLinkJobs(), m_fallback.maxLtoLinkJobs);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsMaxHeavyJobs, m_inputs.maxHeavyJobs(), m_fallback.maxHeavyJobs);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsTimeTraceGranularity, m_inputs.timeTraceGranularity(), m_fallback.timeTraceGranularity);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsExplain, m_inputs.explain(), m_fallback.explain);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsResourceUsage, m_inputs.resourceUsage(), m_fallback.resourceUsage);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsToolchain, m_inputs.toolchainPreferenceName(), m_fallback.toolchainPreference);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsBuildConfiguration, m_inputs.buildConfiguration(), m_fallback.buildConfiguration);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsArchitecture, m_inputs.architectureRaw(), m_fallback.architecturePreference);
@@ -71,6 +80,7 @@ bool SettingsJsonFile::readFrom(JsonFile& inJsonFile)
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsOutputDirectory, m_inputs.outputDirectory(), m_fallback.outputDirectory);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsExternalDirectory, m_inputs.externalDirectory(), m_fallback.externalDirectory);
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsDistributionDirectory, m_inputs.distributionDirectory(), m_fallback.distributionDirectory);
+	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsScratchDirectory, m_inputs.scratchDirectory(), m_fallback.scratchDirectory);
 
 	// We always want to save these values
 	dirty |= json::assignNodeIfEmptyWithFallback(jOptions, Keys::OptionsOsTargetName, m_inputs.osTargetName(), m_fallback.osTargetName);
@@ -295,6 +305,11 @@ bool SettingsJsonFile::readFromSettings(Json& inNode)
 				if (m_inputs.distributionDirectory().empty() || !String::equals(StringList{ m_inputs.distributionDirectory(), m_inputs.defaultDistributionDirectory() }, val))
 					m_inputs.setDistributionDirectory(std::move(val));
 			}
+			else if (String::equals(Keys::OptionsScratchDirectory, key))
+			{
+				if (m_inputs.scratchDirectory().empty())
+					m_inputs.setScratchDirectory(value.get<std::string>());
+			}
 			else
 				removeKeys.push_back(key);
 		}
@@ -338,6 +353,31 @@ bool SettingsJsonFile::readFromSettings(Json& inNode)
 				if (!m_inputs.compilerCache().has_value())
 					m_inputs.setCompilerCache(value.get<bool>());
 			}
+			else if (String::equals(Keys::OptionsFastLinker, key))
+			{
+				if (!m_inputs.fastLinker().has_value())
+					m_inputs.setFastLinker(value.get<bool>());
+			}
+			else if (String::equals(Keys::OptionsPersistScratch, key))
+			{
+				if (!m_inputs.persistScratch().has_value())
+					m_inputs.setPersistScratch(value.get<bool>());
+			}
+			else if (String::equals(Keys::OptionsTimeTrace, key))
+			{
+				if (!m_inputs.timeTrace().has_value())
+					m_inputs.setTimeTrace(value.get<bool>());
+			}
+			else if (String::equals(Keys::OptionsExplain, key))
+			{
+				if (!m_inputs.explain().has_value())
+					m_inputs.setExplain(value.get<bool>());
+			}
+			else if (String::equals(Keys::OptionsResourceUsage, key))
+			{
+				if (!m_inputs.resourceUsage().has_value())
+					m_inputs.setResourceUsage(value.get<bool>());
+			}
 			else if (String::equals(Keys::OptionsGenerateCompileCommands, key))
 			{
 				if (!m_inputs.generateCompileCommands().has_value())
@@ -358,6 +398,26 @@ bool SettingsJsonFile::readFromSettings(Json& inNode)
 				if (!m_inputs.maxJobs().has_value())
 					m_inputs.setMaxJobs(static_cast<u32>(value.get<i32>()));
 			}
+			else if (String::equals(Keys::OptionsMaxLinkJobs, key))
+			{
+				if (!m_inputs.maxLinkJobs().has_value())
+					m_inputs.setMaxLinkJobs(static_cast<u32>(value.get<i32>()));
+			}
+			else if (String::equals(Keys::OptionsMaxLtoLinkJobs, key))
+			{
+				if (!m_inputs.maxLtoLinkJobs().has_value())
+					m_inputs.setMaxLtoLinkJobs(static_cast<u32>(value.get<i32>()));
+			}
+			else if (String::equals(Keys::OptionsMaxHeavyJobs, key))
+			{
+				if (!m_inputs.maxHeavyJobs().has_value())
+					m_inputs.setMaxHeavyJobs(static_cast<u32>(value.get<i32>()));
+			}
+			else if (String::equals(Keys::OptionsTimeTraceGranularity, key))
+			{
+				if (!m_inputs.timeTraceGranularity().has_value())
+					m_inputs.setTimeTraceGranularity(static_cast<u32>(value.get<i32>()));
+			}
 			else
 				removeKeys.push_back(key);
 		}
@@ -210,6 +210,7 @@ Json& SettingsJsonFileToolchain::getToolchainNode(Json& inToolchainsNode)
 		Keys::ToolchainCompilerC,
 		Keys::ToolchainCompilerCpp,
 		Keys::ToolchainLinker,
+		Keys::ToolchainFastLinker,
 		Keys::ToolchainArchiver,
 		Keys::ToolchainDisassembler,
 		Keys::ToolchainBuildStrategy,
@@ -276,6 +277,8 @@ bool SettingsJsonFileToolchain::readFromToolchainNode(JsonFile& inJsonFile, Json
 				m_state.toolchain.setCompilerWindowsResource(value.get<std::string>());
 			else if (String::equals(Keys::ToolchainLinker, key))
 				m_state.toolchain.setLinker(value.get<std::string>());
+			else if (String::equals(Keys::ToolchainFastLinker, key))
+				m_state.toolchain.setFastLinker(value.get<std::string>());
 			else if (String::equals(Keys::ToolchainProfiler, key))
 				m_state.toolchain.setProfiler(value.get<std::string>());
 			//
@@ -459,6 +462,25 @@ bool SettingsJsonFileToolchain::detectToolchainPaths(Json& toolchain, const Tool
 		dirty = true;
 	}
 
+	// An empty value is valid here - it means no faster linker was found, so don't re-probe
+	//
+	if (!json::isValid<std::string>(toolchain, Keys::ToolchainFastLinker))
+	{
+		std::string fastLinker;
+		if (inIsCustomToolchain || isGNU || (isLLVM && preference.type == ToolchainType::LLVM))
+		{
+			auto compiler = json::get<std::string>(toolchain, Keys::ToolchainCompilerC);
+			if (compiler.empty())
+				compiler = json::get<std::string>(toolchain, Keys::ToolchainCompilerCpp);
+
+			auto probeDirectory = m_state.cache.getCachePath("linker_probe");
+			fastLinker = CompilerTools::detectFastLinker(compiler, probeDirectory);
+		}
+
+		toolchain[Keys::ToolchainFastLinker] = std::move(fastLinker);
+		dirty = true;
+	}
+
 	if (json::isStringInvalidOrEmpty(toolchain, Keys::ToolchainArchiver))
 	{
 		std::string ar;
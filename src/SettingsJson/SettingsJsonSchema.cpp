@@ -53,6 +53,7 @@ enum class Defs : u16
 	CompilerWindowsResource,
 	Archiver,
 	Linker,
+	ToolchainFastLinker,
 	Profiler,
 	Disassembler,
 	Make,
@@ -65,10 +66,18 @@ enum class Defs : u16
 	GenerateCompileCommands,
 	OnlyRequired,
 	MaxJobs,
+	MaxLinkJobs,
+	MaxLtoLinkJobs,
+	MaxHeavyJobs,
+	TimeTraceGranularity,
 	ShowCommands,
 	Benchmark,
 	KeepGoing,
 	CompilerCache,
+	FastLinker,
+	TimeTrace,
+	Explain,
+	ResourceUsage,
 	LaunchProfiler,
 	LastBuildConfiguration,
 	LastToolchain,
@@ -84,6 +93,8 @@ enum class Defs : u16
 	OutputDir,
 	ExternalDir,
 	DistributionDir,
+	ScratchDir,
+	PersistScratch,
 	LastTarget,
 	RunArguments,
 	Theme,
@@ -307,6 +318,18 @@ Json SettingsJsonSchema::get(const CommandLineInputs& inInputs)
 		"default": "/usr/bin/ld"
 	})json"_ojson;
 
+	defs[Defs::ToolchainFastLinker] = R"json({
+		"type": "string",
+		"description": "The linker passed to the compiler via -fuse-ld= in native & ninja builds. This is detected automatically as the first of mold, lld and gold (a fixed order, generally fastest first - link times aren't measured) that passes a test link, and an empty value means none did.",
+		"enum": [
+			"",
+			"mold",
+			"lld",
+			"gold",
+			"bfd"
+		]
+	})json"_ojson;
+
 	defs[Defs::Profiler] = R"json({
 		"type": "string",
 		"description": "The executable path to the toochain's command-line profiler (if applicable) - for instance, gprof with GCC.",
@@ -377,6 +400,27 @@ Json SettingsJsonSchema::get(const CommandLineInputs& inInputs)
 		"minimum": 1
 	})json"_ojson;
 
+	defs[Defs::MaxLinkJobs] = R"json({
+		"type": "integer",
+		"description": "The number of link jobs to run at once in the ninja strategy, or 0 for no limit other than maxJobs (default). The native strategy links one target at a time.",
+		"minimum": 0,
+		"default": 0
+	})json"_ojson;
+
+	defs[Defs::MaxLtoLinkJobs] = R"json({
+		"type": "integer",
+		"description": "The number of link-time optimized link jobs to run at once in the ninja strategy, or 0 to allow one (default). The linker's own threads are divided between them. The native strategy links one target at a time.",
+		"minimum": 0,
+		"default": 0
+	})json"_ojson;
+
+	defs[Defs::MaxHeavyJobs] = R"json({
+		"type": "integer",
+		"description": "The number of source files tagged with 'heavyFiles' to compile at once in the native & ninja strategies, or 0 to allow one per 4 jobs (default).",
+		"minimum": 0,
+		"default": 0
+	})json"_ojson;
+
 	defs[Defs::ShowCommands] = R"json({
 		"type": "boolean",
 		"description": "true to show the commands run during the build, false to just show the source file (default).",
@@ -401,6 +445,37 @@ Json SettingsJsonSchema::get(const CommandLineInputs& inInputs)
 		"default": false
 	})json"_ojson;
 
+	defs[Defs::FastLinker] = R"json({
+		"type": "boolean",
+		"description": "true to link with the first of mold, lld or gold that works with the toolchain (in that order) in the native & ninja strategies (default), false to use the toolchain's default linker.",
+		"default": true
+	})json"_ojson;
+
+	defs[Defs::TimeTrace] = R"json({
+		"type": "boolean",
+		"description": "true to profile each compile with -ftime-trace (Clang only) and write a summary of the slowest headers, template instantiations & functions after the build, false to disable (default).",
+		"default": false
+	})json"_ojson;
+
+	defs[Defs::TimeTraceGranularity] = R"json({
+		"type": "integer",
+		"description": "The minimum time (in microseconds) of an event recorded with 'timeTrace', or 0 for the compiler's default (default).",
+		"minimum": 0,
+		"default": 0
+	})json"_ojson;
+
+	defs[Defs::Explain] = R"json({
+		"type": "boolean",
+		"description": "true to print why each target & file was rebuilt after the build (the first changed header, flags or dependency behind each decision), false to disable (default).",
+		"default": false
+	})json"_ojson;
+
+	defs[Defs::ResourceUsage] = R"json({
+		"type": "boolean",
+		"description": "true to summarize the CPU time, memory & page faults of each compile, link & script command after the build (compared to the previous build), false to disable (default).",
+		"default": false
+	})json"_ojson;
+
 	defs[Defs::LaunchProfiler] = R"json({
 		"type": "boolean",
 		"description": "If running profile targets, true to launch the preferred profiler afterwards (default), false to just generate the output files.",
@@ -477,6 +552,17 @@ Json SettingsJsonSchema::get(const CommandLineInputs& inInputs)
 	})json"_ojson;
 	defs[Defs::DistributionDir]["default"] = inInputs.defaultDistributionDirectory();
 
+	defs[Defs::ScratchDir] = R"json({
+		"type": "string",
+		"description": "A separate root directory for object files, dependency files, precompiled headers & assembly dumps (ex: /dev/shm), while final binaries stay in the output directory."
+	})json"_ojson;
+
+	defs[Defs::PersistScratch] = R"json({
+		"type": "boolean",
+		"description": "true to keep a copy of the scratch directory in the build folder after each successful build, and restore it from there if the scratch directory is cleared (ex: after a reboot), false to disable (default).",
+		"default": false
+	})json"_ojson;
+
 	defs[Defs::LastTarget] = R"json({
 		"type": "string",
 		"description": "The last build target used (or ran), or 'all' if one was not specified."
@@ -551,6 +637,7 @@ Json SettingsJsonSchema::get(const CommandLineInputs& inInputs)
 	toolchain[SKeys::Properties][Keys::ToolchainCompilerWindowsResource] = defs[Defs::CompilerWindowsResource];
 	toolchain[SKeys::Properties][Keys::ToolchainDisassembler] = defs[Defs::Disassembler];
 	toolchain[SKeys::Properties][Keys::ToolchainLinker] = defs[Defs::Linker];
+	toolchain[SKeys::Properties][Keys::ToolchainFastLinker] = defs[Defs::ToolchainFastLinker];
 	toolchain[SKeys::Properties][Keys::ToolchainMake] = defs[Defs::Make];
 	toolchain[SKeys::Properties][Keys::ToolchainMeson] = defs[Defs::Meson];
 	toolchain[SKeys::Properties][Keys::ToolchainNinja] = defs[Defs::Ninja];
@@ -586,13 +673,23 @@ Json SettingsJsonSchema::get(const CommandLineInputs& inInputs)
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsInputFile] = defs[Defs::InputFile];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsKeepGoing] = defs[Defs::KeepGoing];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsCompilerCache] = defs[Defs::CompilerCache];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsFastLinker] = defs[Defs::FastLinker];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsLaunchProfiler] = defs[Defs::LaunchProfiler];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsMaxJobs] = defs[Defs::MaxJobs];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsMaxLinkJobs] = defs[Defs::MaxLinkJobs];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsMaxLtoLinkJobs] = defs[Defs::MaxLtoLinkJobs];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsMaxHeavyJobs] = defs[Defs::MaxHeavyJobs];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsOutputDirectory] = defs[Defs::OutputDir];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsRootDirectory] = defs[Defs::RootDir];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsScratchDirectory] = defs[Defs::ScratchDir];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsPersistScratch] = defs[Defs::PersistScratch];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsLastTarget] = defs[Defs::LastTarget];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsRunArguments] = defs[Defs::RunArguments];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsShowCommands] = defs[Defs::ShowCommands];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsTimeTrace] = defs[Defs::TimeTrace];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsTimeTraceGranularity] = defs[Defs::TimeTraceGranularity];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsExplain] = defs[Defs::Explain];
+	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsResourceUsage] = defs[Defs::ResourceUsage];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsSigningIdentity] = defs[Defs::SigningIdentity];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsProfilerConfig] = defs[Defs::ProfilerConfig];
 	ret[SKeys::Properties][Keys::Options][SKeys::Properties][Keys::OptionsOsTargetName] = defs[Defs::OsTargetName];
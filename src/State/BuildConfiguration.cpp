@@ -297,7 +297,7 @@ bool BuildConfiguration::validate(const BuildState& inState, const bool inErrors
 /*****************************************************************************/
 std::string BuildConfiguration::getHash() const
 {
-	auto hashable = Hash::getHashableString(m_sanitizeOptions, m_optimizationLevel, m_interproceduralOptimization, m_debugSymbols, m_enableProfiling);
+	auto hashable = Hash::getHashableString(m_sanitizeOptions, m_optimizationLevel, m_interproceduralOptimization, m_interproceduralOptimizationMode, m_debugSymbols, m_enableProfiling);
 	return Hash::string(hashable);
 }
 
@@ -339,6 +339,22 @@ void BuildConfiguration::setInterproceduralOptimization(const bool inValue) noex
 	m_interproceduralOptimization = inValue;
 }
 
+/*****************************************************************************/
+InterproceduralOptimizationMode BuildConfiguration::interproceduralOptimizationMode() const noexcept
+{
+	return m_interproceduralOptimizationMode;
+}
+
+void BuildConfiguration::setInterproceduralOptimizationMode(const std::string& inValue)
+{
+	if (String::equals("full", inValue))
+		m_interproceduralOptimizationMode = InterproceduralOptimizationMode::Full;
+	else if (String::equals("thin", inValue))
+		m_interproceduralOptimizationMode = InterproceduralOptimizationMode::Thin;
+	else
+		m_interproceduralOptimizationMode = InterproceduralOptimizationMode::Auto;
+}
+
 /*****************************************************************************/
 bool BuildConfiguration::debugSymbols() const noexcept
 {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "State/InterproceduralOptimizationMode.hpp"
 #include "State/OptimizationLevel.hpp"
 #include "State/SanitizeOptions.hpp"
 
@@ -33,6 +34,9 @@ struct BuildConfiguration
 	bool interproceduralOptimization() const noexcept;
 	void setInterproceduralOptimization(const bool inValue) noexcept;
 
+	InterproceduralOptimizationMode interproceduralOptimizationMode() const noexcept;
+	void setInterproceduralOptimizationMode(const std::string& inValue);
+
 	bool debugSymbols() const noexcept;
 	void setDebugSymbols(const bool inValue) noexcept;
 
@@ -63,6 +67,7 @@ private:
 	mutable SanitizeOptions::Type m_sanitizeOptions = SanitizeOptions::None;
 
 	OptimizationLevel m_optimizationLevel = OptimizationLevel::None;
+	InterproceduralOptimizationMode m_interproceduralOptimizationMode = InterproceduralOptimizationMode::Auto;
 
 	bool m_interproceduralOptimization = false;
 	bool m_debugSymbols = false;
@@ -29,6 +29,18 @@ BuildInfo::BuildInfo(const BuildState& inState, const CommandLineInputs& inInput
 	if (m_inputs.maxJobs().has_value())
 		m_maxJobs = *m_inputs.maxJobs();
 
+	if (m_inputs.maxLinkJobs().has_value())
+		m_maxLinkJobs = *m_inputs.maxLinkJobs();
+
+	if (m_inputs.maxLtoLinkJobs().has_value())
+		m_maxLtoLinkJobs = *m_inputs.maxLtoLinkJobs();
+
+	if (m_inputs.maxHeavyJobs().has_value())
+		m_maxHeavyJobs = *m_inputs.maxHeavyJobs();
+
+	if (m_inputs.timeTraceGranularity().has_value())
+		m_timeTraceGranularity = *m_inputs.timeTraceGranularity();
+
 	if (m_inputs.dumpAssembly().has_value())
 		m_dumpAssembly = *m_inputs.dumpAssembly();
 
@@ -44,6 +56,21 @@ BuildInfo::BuildInfo(const BuildState& inState, const CommandLineInputs& inInput
 	if (m_inputs.compilerCache().has_value())
 		m_compilerCache = *m_inputs.compilerCache();
 
+	if (m_inputs.fastLinker().has_value())
+		m_fastLinker = *m_inputs.fastLinker();
+
+	if (m_inputs.persistScratch().has_value())
+		m_persistScratch = *m_inputs.persistScratch();
+
+	if (m_inputs.timeTrace().has_value())
+		m_timeTrace = *m_inputs.timeTrace();
+
+	if (m_inputs.explain().has_value())
+		m_explain = *m_inputs.explain();
+
+	if (m_inputs.resourceUsage().has_value())
+		m_resourceUsage = *m_inputs.resourceUsage();
+
 	if (m_inputs.onlyRequired().has_value())
 		m_onlyRequired = *m_inputs.onlyRequired();
 }
@@ -153,6 +180,36 @@ u32 BuildInfo::maxJobs() const noexcept
 	return m_maxJobs;
 }
 
+/*****************************************************************************/
+u32 BuildInfo::maxLinkJobs() const noexcept
+{
+	// Only limited if asked for - ninja is the only strategy that runs links in parallel, and throttling
+	//   them by default would slow down builds with plenty of memory
+	u32 ret = m_maxLinkJobs > 0 ? m_maxLinkJobs : m_maxJobs;
+	return std::clamp(ret, 1U, std::max(m_maxJobs, 1U));
+}
+
+/*****************************************************************************/
+u32 BuildInfo::maxLtoLinkJobs() const noexcept
+{
+	// LTO links are already parallelized by the linker itself (see: LinkerGCC::addLinkTimeOptimizations)
+	u32 ret = m_maxLtoLinkJobs > 0 ? m_maxLtoLinkJobs : 1;
+	return std::clamp(ret, 1U, std::max(m_maxJobs, 1U));
+}
+
+/*****************************************************************************/
+u32 BuildInfo::maxHeavyJobs() const noexcept
+{
+	u32 ret = m_maxHeavyJobs > 0 ? m_maxHeavyJobs : m_maxJobs / 4;
+	return std::clamp(ret, 1U, std::max(m_maxJobs, 1U));
+}
+
+/*****************************************************************************/
+u32 BuildInfo::timeTraceGranularity() const noexcept
+{
+	return m_timeTraceGranularity;
+}
+
 /*****************************************************************************/
 bool BuildInfo::dumpAssembly() const noexcept
 {
@@ -183,6 +240,36 @@ bool BuildInfo::compilerCache() const noexcept
 	return m_compilerCache;
 }
 
+/*****************************************************************************/
+bool BuildInfo::fastLinker() const noexcept
+{
+	return m_fastLinker;
+}
+
+/*****************************************************************************/
+bool BuildInfo::persistScratch() const noexcept
+{
+	return m_persistScratch;
+}
+
+/*****************************************************************************/
+bool BuildInfo::timeTrace() const noexcept
+{
+	return m_timeTrace;
+}
+
+/*****************************************************************************/
+bool BuildInfo::explain() const noexcept
+{
+	return m_explain;
+}
+
+/*****************************************************************************/
+bool BuildInfo::resourceUsage() const noexcept
+{
+	return m_resourceUsage;
+}
+
 /*****************************************************************************/
 bool BuildInfo::onlyRequired() const noexcept
 {
@@ -37,11 +37,20 @@ struct BuildInfo
 	bool targettingMinGW() const;
 
 	u32 maxJobs() const noexcept;
+	u32 maxLinkJobs() const noexcept;
+	u32 maxLtoLinkJobs() const noexcept;
+	u32 maxHeavyJobs() const noexcept;
+	u32 timeTraceGranularity() const noexcept;
 	bool dumpAssembly() const noexcept;
 	bool generateCompileCommands() const noexcept;
 	bool launchProfiler() const noexcept;
 	bool keepGoing() const noexcept;
 	bool compilerCache() const noexcept;
+	bool fastLinker() const noexcept;
+	bool persistScratch() const noexcept;
+	bool timeTrace() const noexcept;
+	bool explain() const noexcept;
+	bool resourceUsage() const noexcept;
 	bool onlyRequired() const noexcept;
 
 private:
@@ -56,12 +65,21 @@ private:
 	Arch m_targetArchitecture;
 
 	u32 m_maxJobs = 0;
+	u32 m_maxLinkJobs = 0;
+	u32 m_maxLtoLinkJobs = 0;
+	u32 m_maxHeavyJobs = 0;
+	u32 m_timeTraceGranularity = 0;
 
 	bool m_dumpAssembly = false;
 	bool m_generateCompileCommands = false;
 	bool m_launchProfiler = true;
 	bool m_keepGoing = false;
 	bool m_compilerCache = false;
+	bool m_fastLinker = true;
+	bool m_persistScratch = false;
+	bool m_timeTrace = false;
+	bool m_explain = false;
+	bool m_resourceUsage = false;
 	bool m_onlyRequired = false;
 };
 }
@@ -20,6 +20,7 @@
 #include "State/Target/MesonTarget.hpp"
 #include "State/Target/SourceTarget.hpp"
 #include "System/Files.hpp"
+#include "Utility/Hash.hpp"
 #include "Utility/List.hpp"
 #include "Utility/Path.hpp"
 #include "Utility/String.hpp"
@@ -92,6 +93,18 @@ bool BuildPaths::initialize()
 
 	m_externalBuildDir = fmt::format("{}/ext", m_buildOutputDir);
 
+	// Each build folder gets its own root in the scratch directory, so they can share it
+	const auto& scratchDirectory = m_state.inputs.scratchDirectory();
+	if (!scratchDirectory.empty())
+	{
+		auto buildOutputDir = Files::getAbsolutePath(m_buildOutputDir);
+		m_scratchDir = fmt::format("{}/chalet_{}", Files::getAbsolutePath(scratchDirectory), Hash::string(buildOutputDir));
+	}
+	else
+	{
+		m_scratchDir = m_buildOutputDir;
+	}
+
 	m_initialized = true;
 
 	return true;
@@ -127,6 +140,30 @@ const std::string& BuildPaths::externalBuildDir() const
 	return m_externalBuildDir;
 }
 
+const std::string& BuildPaths::scratchDir() const
+{
+	chalet_assert(!m_scratchDir.empty(), "BuildPaths::scratchDir() called before BuildPaths::initialize().");
+	return m_scratchDir;
+}
+
+bool BuildPaths::usesScratchDir() const
+{
+	return !String::equals(m_buildOutputDir, m_scratchDir);
+}
+
+/*****************************************************************************/
+// The copy of the scratch directory that survives a reboot, and the file that says it's up to date
+//
+std::string BuildPaths::scratchSnapshotDir() const
+{
+	return fmt::format("{}/.scratch", buildOutputDir());
+}
+
+std::string BuildPaths::scratchSnapshotStamp() const
+{
+	return fmt::format("{}/.scratch_synced", buildOutputDir());
+}
+
 const std::string& BuildPaths::objDir() const
 {
 	chalet_assert(!m_objDir.empty(), "BuildPaths::objDir() called before BuildPaths::setBuildDirectoriesBasedOnProjectKind().");
@@ -150,6 +187,10 @@ std::string BuildPaths::intermediateDir(const SourceTarget& inProject) const
 {
 	return fmt::format("{}/int.{}", buildOutputDir(), inProject.buildSuffix());
 }
+std::string BuildPaths::objectDir(const SourceTarget& inProject) const
+{
+	return fmt::format("{}/obj.{}", scratchDir(), inProject.buildSuffix());
+}
 std::string BuildPaths::intermediateIncludeDir(const SourceTarget& inProject) const
 {
 	auto intDir = intermediateDir(inProject);
@@ -168,6 +209,12 @@ std::string BuildPaths::currentCompileCommands() const
 	return fmt::format("{}/compile_commands.json", outputDirectory());
 }
 
+/*****************************************************************************/
+std::string BuildPaths::trashDir() const
+{
+	return fmt::format("{}/.chalettrash", outputDirectory());
+}
+
 /*****************************************************************************/
 std::string BuildPaths::getExternalDir(const std::string& inName) const
 {
@@ -232,8 +279,8 @@ const std::string& BuildPaths::objectiveCppExtension() const
 /*****************************************************************************/
 void BuildPaths::setBuildDirectoriesBasedOnProjectKind(const SourceTarget& inProject)
 {
-	m_objDir = fmt::format("{}/obj.{}", m_buildOutputDir, inProject.buildSuffix());
-	m_asmDir = fmt::format("{}/asm.{}", m_buildOutputDir, inProject.buildSuffix());
+	m_objDir = objectDir(inProject);
+	m_asmDir = fmt::format("{}/asm.{}", m_scratchDir, inProject.buildSuffix());
 
 	m_intermediateDirWithPathSep = intermediateDir(inProject) + '/';
 
@@ -247,17 +294,23 @@ Unique<SourceOutputs> BuildPaths::getOutputs(const SourceTarget& inProject, Stri
 
 	setBuildDirectoriesBasedOnProjectKind(inProject);
 
-	auto files = getFiles(inProject);
-	SourceGroup directories = getDirectories(inProject);
+	SourceGroup files;
+	SourceGroup directories;
+	getSourceGroups(inProject, files, directories);
 
 	// inProject.isSharedLibrary() ? m_fileListCacheShared : m_fileListCache
 
 	const bool isNotMsvc = !m_state.environment->isMsvc();
 	const bool dumpAssembly = m_state.info.dumpAssembly();
 
-	ret->objectListLinker = getObjectFilesList(files->list, inProject);
-	files->list = String::excludeIf(outFileCache, files->list);
-	ret->groups = getSourceFileGroupList(*files, inProject, outFileCache);
+	ret->groups = getSourceFileGroupList(files, inProject, outFileCache, ret->objectListLinker);
+
+#if defined(CHALET_WIN32)
+	if (!isNotMsvc && inProject.usesPrecompiledHeader())
+	{
+		ret->objectListLinker.emplace_back(getPrecompiledHeaderObject(getPrecompiledHeaderTarget(inProject)));
+	}
+#endif
 
 	StringList objSubDirs = getOutputDirectoryList(directories, objDir());
 	// StringList depSubDirs = getOutputDirectoryList(directories, depDir());
@@ -468,6 +521,18 @@ std::string BuildPaths::getUnityBuildSourceFilename(const SourceTarget& inProjec
 	return std::string();
 }
 
+/*****************************************************************************/
+std::string BuildPaths::getUnityBuildChunkSourceFilename(const SourceTarget& inProject, const size_t inIndex) const
+{
+	if (inProject.unityBuild())
+	{
+		const auto& name = inProject.name();
+		return fmt::format("{}/{}_unity_{}.cxx", intermediateDir(inProject), name, inIndex);
+	}
+
+	return std::string();
+}
+
 /*****************************************************************************/
 std::string BuildPaths::getNormalizedOutputPath(const std::string& inPath) const
 {
@@ -516,31 +581,33 @@ void BuildPaths::normalizedPath(std::string& outPath) const
 /*****************************************************************************/
 /*****************************************************************************/
 /*****************************************************************************/
-SourceFileGroupList BuildPaths::getSourceFileGroupList(const SourceGroup& inFiles, const SourceTarget& inProject, StringList& outFileCache)
+SourceFileGroupList BuildPaths::getSourceFileGroupList(const SourceGroup& inFiles, const SourceTarget& inProject, StringList& outFileCache, StringList& outObjectList)
 {
 	SourceFileGroupList ret;
 
 	const bool isModule = inProject.cppModules();
+	const bool dumpAssembly = m_state.info.dumpAssembly();
 
-	auto makeGroup = [this, &isModule](SourceType type, const std::string& file) {
-		auto group = std::make_unique<SourceFileGroup>();
-		group->type = type;
-		group->objectFile = getObjectFile(file);
-
-		if (type == SourceType::CPlusPlus && isModule)
-			group->dependencyFile = m_state.environment->getModuleDirectivesDependencyFile(file);
-		else
-			group->dependencyFile = m_state.environment->getDependencyFile(file);
+	// Files already built by a previous target are only linked
+	//   (reserved first, so the cache doesn't move out from under the views)
+	outFileCache.reserve(outFileCache.size() + inFiles.list.size());
+	std::unordered_set<std::string_view> previousFiles(outFileCache.begin(), outFileCache.end());
 
-		group->sourceFile = file;
-		return group;
-	};
+	outObjectList.reserve(outObjectList.size() + inFiles.list.size());
+	ret.reserve(inFiles.list.size() + 1);
 
 	for (auto& file : inFiles.list)
 	{
 		if (file.empty())
 			continue;
 
+		auto objectFile = getObjectFile(file);
+		if (!objectFile.empty())
+			outObjectList.push_back(objectFile);
+
+		if (previousFiles.find(file) != previousFiles.end())
+			continue;
+
 		outFileCache.push_back(file);
 
 		SourceType type = getSourceType(file);
@@ -551,16 +618,21 @@ SourceFileGroupList BuildPaths::getSourceFileGroupList(const SourceGroup& inFile
 		if (!m_state.toolchain.canCompileWindowsResources() && type == SourceType::WindowsResource)
 			continue;
 
-		ret.push_back(makeGroup(type, file));
-	}
+		auto group = std::make_unique<SourceFileGroup>();
+		group->type = type;
+		group->objectFile = std::move(objectFile);
 
-	// don't do this for the pch
-	if (m_state.info.dumpAssembly())
-	{
-		for (auto& group : ret)
-		{
-			group->otherFile = getAssemblyFile(group->sourceFile);
-		}
+		if (type == SourceType::CPlusPlus && isModule)
+			group->dependencyFile = m_state.environment->getModuleDirectivesDependencyFile(file);
+		else
+			group->dependencyFile = m_state.environment->getDependencyFile(file);
+
+		// don't do this for the pch
+		if (dumpAssembly)
+			group->otherFile = getAssemblyFile(file);
+
+		group->sourceFile = file;
+		ret.push_back(std::move(group));
 	}
 
 	// add the pch
@@ -643,32 +715,6 @@ SourceType BuildPaths::getSourceType(const std::string& inSource) const
 	return SourceType::Unknown;
 }
 
-/*****************************************************************************/
-StringList BuildPaths::getObjectFilesList(const StringList& inFiles, const SourceTarget& inProject) const
-{
-	StringList ret;
-	for (const auto& file : inFiles)
-	{
-		auto outFile = getObjectFile(file);
-		if (!outFile.empty())
-			ret.emplace_back(std::move(outFile));
-	}
-
-#if defined(CHALET_WIN32)
-	if (m_state.environment->isMsvc())
-	{
-		if (inProject.usesPrecompiledHeader())
-		{
-			ret.emplace_back(getPrecompiledHeaderObject(getPrecompiledHeaderTarget(inProject)));
-		}
-	}
-#else
-	UNUSED(inProject);
-#endif
-
-	return ret;
-}
-
 /*****************************************************************************/
 StringList BuildPaths::getOutputDirectoryList(const SourceGroup& inDirectoryList, const std::string& inFolder) const
 {
@@ -681,12 +727,37 @@ StringList BuildPaths::getOutputDirectoryList(const SourceGroup& inDirectoryList
 }
 
 /*****************************************************************************/
-StringList BuildPaths::getFileList(const SourceTarget& inProject) const
+// Each file is only checked once, and the folders they're in come from the same pass
+//
+void BuildPaths::getSourceGroups(const SourceTarget& inProject, SourceGroup& outFiles, SourceGroup& outDirectories) const
 {
 	const auto& files = inProject.files();
 	auto& pch = inProject.precompiledHeader();
 	bool usesPch = inProject.usesPrecompiledHeader();
-	StringList fileList;
+
+	outFiles.pch = pch;
+	outFiles.list.reserve(files.size() + 2);
+
+	std::unordered_set<std::string> folders;
+	std::unordered_set<std::string> outputFolders;
+
+	if (usesPch && Files::pathExists(pch))
+	{
+		auto outPath = getNormalizedDirectoryPath(pch);
+
+#if defined(CHALET_MACOS)
+		if (!m_state.inputs.universalArches().empty())
+		{
+			for (auto& arch : m_state.inputs.universalArches())
+			{
+				outDirectories.list.emplace_back(fmt::format("{}_{}", outPath, arch));
+			}
+		}
+#endif
+		folders.emplace(String::getPathFolder(pch));
+		outputFolders.emplace(outPath);
+		outDirectories.list.emplace_back(std::move(outPath));
+	}
 
 	for (auto& file : files)
 	{
@@ -696,90 +767,35 @@ StringList BuildPaths::getFileList(const SourceTarget& inProject) const
 			continue;
 		}
 
-		if (!Files::pathExists(file) || !Files::pathIsFile(file))
+		if (!Files::pathIsFile(file))
 		{
 			Diagnostic::warn("File not found: {}", file);
 			continue;
 		}
 
-		fileList.emplace_back(file);
+		outFiles.list.emplace_back(file);
+
+		auto folder = String::getPathFolder(file);
+		if (folders.find(folder) == folders.end())
+		{
+			auto outPath = getNormalizedOutputPath(folder);
+			if (outputFolders.emplace(outPath).second)
+				outDirectories.list.emplace_back(std::move(outPath));
+
+			folders.emplace(std::move(folder));
+		}
 	}
 
 	auto manifestResource = getWindowsManifestResourceFilename(inProject);
 	if (!manifestResource.empty())
 	{
-		fileList.emplace_back(std::move(manifestResource));
+		outFiles.list.emplace_back(std::move(manifestResource));
 	}
 
 	auto iconResource = getWindowsIconResourceFilename(inProject);
 	if (!iconResource.empty())
 	{
-		fileList.emplace_back(std::move(iconResource));
-	}
-
-	return fileList;
-}
-
-/*****************************************************************************/
-StringList BuildPaths::getDirectoryList(const SourceTarget& inProject) const
-{
-	CHALET_TRY
-	{
-		StringList ret;
-
-		if (inProject.usesPrecompiledHeader())
-		{
-			if (Files::pathExists(inProject.precompiledHeader()))
-			{
-				auto outPath = getNormalizedDirectoryPath(inProject.precompiledHeader());
-
-#if defined(CHALET_MACOS)
-				if (!m_state.inputs.universalArches().empty())
-				{
-					for (auto& arch : m_state.inputs.universalArches())
-					{
-						ret.emplace_back(fmt::format("{}_{}", outPath, arch));
-					}
-				}
-#endif
-				ret.emplace_back(std::move(outPath));
-			}
-		}
-
-		const auto& files = inProject.files();
-		for (auto& file : files)
-		{
-			if (!Files::pathExists(file))
-				continue;
-
-			List::addIfDoesNotExist(ret, getNormalizedDirectoryPath(file));
-		}
-
-		return ret;
-	}
-	CHALET_CATCH(const std::exception& err)
-	{
-		CHALET_EXCEPT_ERROR(err.what());
-		return StringList();
+		outFiles.list.emplace_back(std::move(iconResource));
 	}
 }
-
-/*****************************************************************************/
-Ref<BuildPaths::SourceGroup> BuildPaths::getFiles(const SourceTarget& inProject) const
-{
-	auto ret = std::make_shared<SourceGroup>();
-	ret->list = getFileList(inProject);
-	ret->pch = inProject.precompiledHeader();
-
-	return ret;
-}
-
-/*****************************************************************************/
-BuildPaths::SourceGroup BuildPaths::getDirectories(const SourceTarget& inProject) const
-{
-	SourceGroup ret;
-	ret.list = getDirectoryList(inProject);
-
-	return ret;
-}
 }
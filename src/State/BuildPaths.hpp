@@ -26,13 +26,19 @@ struct BuildPaths
 	const std::string& outputDirectory() const noexcept;
 	const std::string& buildOutputDir() const;
 	const std::string& externalBuildDir() const;
+	const std::string& scratchDir() const;
+	bool usesScratchDir() const;
+	std::string scratchSnapshotDir() const;
+	std::string scratchSnapshotStamp() const;
 	const std::string& objDir() const;
 	const std::string& depDir() const;
 	const std::string& asmDir() const;
 	std::string intermediateDir(const SourceTarget& inProject) const;
+	std::string objectDir(const SourceTarget& inProject) const;
 	std::string intermediateIncludeDir(const SourceTarget& inProject) const;
 	std::string bundleObjDir(const std::string& inName) const;
 	std::string currentCompileCommands() const;
+	std::string trashDir() const;
 
 	std::string getExternalDir(const std::string& inName) const;
 	std::string getExternalBuildDir(const std::string& inName) const;
@@ -53,6 +59,7 @@ struct BuildPaths
 	std::string getWindowsManifestResourceFilename(const SourceTarget& inProject) const;
 	std::string getWindowsIconResourceFilename(const SourceTarget& inProject) const;
 	std::string getUnityBuildSourceFilename(const SourceTarget& inProject) const;
+	std::string getUnityBuildChunkSourceFilename(const SourceTarget& inProject, const size_t inIndex) const;
 
 	std::string getNormalizedOutputPath(const std::string& inPath) const;
 	std::string getNormalizedDirectoryPath(const std::string& inPath) const;
@@ -78,15 +85,11 @@ private:
 
 	void normalizedPath(std::string& outPath) const;
 
-	SourceFileGroupList getSourceFileGroupList(const SourceGroup& inFiles, const SourceTarget& inProject, StringList& outFileCache);
+	SourceFileGroupList getSourceFileGroupList(const SourceGroup& inFiles, const SourceTarget& inProject, StringList& outFileCache, StringList& outObjectList);
 	std::string getObjectFile(const std::string& inSource) const;
 	std::string getAssemblyFile(const std::string& inSource) const;
-	StringList getObjectFilesList(const StringList& inFiles, const SourceTarget& inProject) const;
 	StringList getOutputDirectoryList(const SourceGroup& inDirectoryList, const std::string& inFolder) const;
-	Ref<SourceGroup> getFiles(const SourceTarget& inProject) const;
-	SourceGroup getDirectories(const SourceTarget& inProject) const;
-	StringList getFileList(const SourceTarget& inProject) const;
-	StringList getDirectoryList(const SourceTarget& inProject) const;
+	void getSourceGroups(const SourceTarget& inProject, SourceGroup& outFiles, SourceGroup& outDirectories) const;
 
 	const BuildState& m_state;
 
@@ -96,6 +99,7 @@ private:
 
 	std::string m_buildOutputDir;
 	std::string m_externalBuildDir;
+	std::string m_scratchDir;
 	std::string m_objDir;
 	std::string m_depDir;
 	std::string m_asmDir;
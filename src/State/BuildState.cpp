@@ -7,6 +7,7 @@
 
 #include "BuildEnvironment/IBuildEnvironment.hpp"
 #include "Builder/BuildManager.hpp"
+#include "Cache/GlobCache.hpp"
 #include "Cache/SourceCache.hpp"
 #include "Cache/WorkspaceCache.hpp"
 #include "ChaletJson/ChaletJsonFile.hpp"
@@ -45,6 +46,7 @@
 #include "Utility/RegexPatterns.hpp"
 #include "Utility/String.hpp"
 #include "Utility/Timer.hpp"
+#include "Utility/Trace.hpp"
 #include "Json/JsonValues.hpp"
 
 namespace chalet
@@ -62,6 +64,7 @@ struct BuildState::Impl
 	BuildConfiguration configuration;
 	std::vector<Unique<IBuildTarget>> targets;
 	std::vector<Unique<IDistTarget>> distribution;
+	GlobCache globs;
 
 	Unique<IBuildEnvironment> environment;
 
@@ -87,6 +90,7 @@ BuildState::BuildState(CommandLineInputs inInputs, CentralState& inCentralState)
 	m_impl(std::make_unique<Impl>(std::move(inInputs), inCentralState, *this)),
 	tools(m_impl->centralState.tools),
 	cache(m_impl->centralState.cache),
+	globs(m_impl->globs),
 	info(m_impl->info),
 	workspace(m_impl->workspace),
 	toolchain(m_impl->toolchain),
@@ -106,6 +110,8 @@ BuildState::~BuildState() = default;
 /*****************************************************************************/
 bool BuildState::initialize()
 {
+	TraceScope traceScope("BuildState::initialize");
+
 	// For now, enforceArchitectureInPath needs to be called before & after configuring the toolchain
 	// Before: For when the toolchain & architecture are provided by inputs,
 	//   and the toolchain needs to be populated into .chaletrc
@@ -585,6 +591,8 @@ bool BuildState::parseToolchainFromSettingsJson()
 /*****************************************************************************/
 bool BuildState::initializeToolchain()
 {
+	TraceScope traceScope("BuildState::initializeToolchain");
+
 	auto onError = [this]() -> bool {
 		const auto& targetArch = m_impl->environment->type() == ToolchainType::GNU ?
 			inputs.targetArchitecture() :
@@ -678,6 +686,10 @@ bool BuildState::initializeBuild()
 	}
 
 	{
+		// Glob patterns in the targets only re-read the folders that changed since the last run
+		if (m_cacheEnabled)
+			globs.loadFromPath(inputs.outputDirectory());
+
 		for (auto& target : targets)
 		{
 			// Iniitialize first so packages can resolve these build files
@@ -742,6 +754,9 @@ bool BuildState::initializeBuild()
 		}
 
 		initializeCache();
+
+		if (m_cacheEnabled)
+			globs.save();
 	}
 
 	Output::setShowCommandOverride(true); // call this before generateUniqueIdForState()
@@ -1821,6 +1836,9 @@ void BuildState::generateUniqueIdForState()
 	bool showCmds = Output::showCommands();
 	bool onlyRequired = info.onlyRequired();
 
+	// Job pools are written into generated build files
+	auto jobPools = fmt::format("{}_{}_{}", info.maxLinkJobs(), info.maxLtoLinkJobs(), info.maxHeavyJobs());
+
 	std::string targetHash;
 	for (auto& target : targets)
 	{
@@ -1841,7 +1859,7 @@ void BuildState::generateUniqueIdForState()
 	m_cachePathId = Hash::string(hashable);
 
 	// Unique ID is used by the internal cache to determine if the build files need to be updated
-	auto hashableTargets = Hash::getHashableString(m_cachePathId, targetHash, hashableToolchain, showCmds, onlyRequired);
+	auto hashableTargets = Hash::getHashableString(m_cachePathId, targetHash, hashableToolchain, showCmds, onlyRequired, jobPools);
 	auto buildHash = Hash::string(hashableTargets);
 
 	auto& cacheFile = m_impl->centralState.cache.file();
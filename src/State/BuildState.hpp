@@ -16,6 +16,7 @@ struct AncillaryTools;
 struct CompilerTools;
 struct CommandLineInputs;
 struct CentralState;
+class GlobCache;
 struct PackageManager;
 struct SourcePackage;
 struct WorkspaceCache;
@@ -70,6 +71,7 @@ public:
 
 	AncillaryTools& tools;
 	WorkspaceCache& cache;
+	GlobCache& globs;
 
 	BuildInfo& info;
 	WorkspaceEnvironment& workspace;
@@ -29,6 +29,7 @@
 #include "Utility/RegexPatterns.hpp"
 #include "Utility/String.hpp"
 #include "Utility/Timer.hpp"
+#include "Utility/Trace.hpp"
 #include "Utility/Version.hpp"
 #include "Json/JsonFile.hpp"
 #include "Json/JsonValues.hpp"
@@ -44,6 +45,8 @@ CentralState::CentralState(CommandLineInputs& inInputs) :
 /*****************************************************************************/
 bool CentralState::initialize()
 {
+	TraceScope traceScope("CentralState::initialize");
+
 #if defined(CHALET_WIN32)
 	WindowsTerminal::initializeCreateProcess();
 #endif
@@ -71,10 +74,19 @@ bool CentralState::initialize()
 		// Set global defaults here
 		IntermediateSettingsState state;
 		state.maxJobs = std::thread::hardware_concurrency();
+		state.maxLinkJobs = 0;
+		state.maxLtoLinkJobs = 0;
+		state.maxHeavyJobs = 0;
+		state.timeTraceGranularity = 0;
 		state.benchmark = true;
 		state.launchProfiler = true;
 		state.keepGoing = false;
 		state.compilerCache = false;
+		state.fastLinker = true;
+		state.persistScratch = false;
+		state.timeTrace = false;
+		state.explain = false;
+		state.resourceUsage = false;
 		state.showCommands = false;
 		state.dumpAssembly = false;
 		state.generateCompileCommands = true;
@@ -111,6 +123,10 @@ bool CentralState::initialize()
 	// If no toolchain was found in inputs or settings, use the default
 	m_inputs.detectToolchainPreference();
 
+	// The report only needs the output directory & build preferences from the settings
+	if (route.isReport())
+		return true;
+
 	m_filename = m_inputs.inputFile();
 	m_inputs.clearWorkingDirectory(m_filename);
 
@@ -120,10 +136,16 @@ bool CentralState::initialize()
 		return false;
 	}
 
-	if (!m_buildFile.load(m_filename))
+	if (!cache.initialize(m_inputs))
 		return false;
 
-	if (!cache.initialize(m_inputs))
+	cache.fingerprint().setKey(BuildFingerprint::getKey(m_inputs));
+
+	// Nothing the last build used has changed, so the build file doesn't even need to be read
+	if (route.isBuild() && canSkipBuild())
+		return true;
+
+	if (!m_buildFile.load(m_filename))
 		return false;
 
 	Output::setShowCommandOverride(false);
@@ -234,6 +256,20 @@ bool CentralState::validate()
 	return true;
 }
 
+/*****************************************************************************/
+bool CentralState::canSkipBuild()
+{
+	// These all need the build to go through
+	if (m_inputs.explain().value_or(false) || m_inputs.timeTrace().value_or(false) || m_inputs.resourceUsage().value_or(false))
+		return false;
+
+	// The build events and the trace are written by the build itself
+	if (!m_inputs.eventsFile().empty() || !m_inputs.traceFile().empty())
+		return false;
+
+	return cache.fingerprint().check();
+}
+
 /*****************************************************************************/
 bool CentralState::createCache()
 {
@@ -257,6 +293,7 @@ void CentralState::saveCaches()
 	if (cache.settingsCreated())
 	{
 		cache.saveSettings(SettingsType::Local);
+		cache.saveFingerprint();
 
 		cache.removeStaleProjectCaches();
 		cache.saveProjectCache(m_inputs);
@@ -64,6 +64,7 @@ private:
 	friend struct GlobalSettingsJsonFile;
 
 	bool createCache();
+	bool canSkipBuild();
 
 	bool parseEnvFile();
 
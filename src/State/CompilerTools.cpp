@@ -88,6 +88,55 @@ StringList CompilerTools::getToolchainBuildPathStyles()
 	};
 }
 
+/*****************************************************************************/
+// A fixed order of preference, fastest first in general (they aren't timed) - bfd is the implicit fallback
+//
+StringList CompilerTools::getFastLinkerCandidates()
+{
+	return {
+		"mold",
+		"lld",
+		"gold",
+	};
+}
+
+/*****************************************************************************/
+std::string CompilerTools::detectFastLinker(const std::string& inCompiler, const std::string& inWorkingDirectory)
+{
+	std::string ret;
+
+#if defined(CHALET_LINUX)
+	if (inCompiler.empty() || !Files::pathExists(inCompiler))
+		return ret;
+
+	auto source = fmt::format("{}/probe.c", inWorkingDirectory);
+	auto object = fmt::format("{}/probe.o", inWorkingDirectory);
+	auto output = fmt::format("{}/probe", inWorkingDirectory);
+
+	// Compile once, then verify each linker with a tiny test link
+	//
+	if (Files::createFileWithContents(source, "int main(void) { return 0; }", true)
+		&& Process::runNoOutput({ inCompiler, "-x", "c", "-c", source, "-o", object }))
+	{
+		for (auto& linker : getFastLinkerCandidates())
+		{
+			bool linked = Process::runNoOutput({ inCompiler, fmt::format("-fuse-ld={}", linker), object, "-o", output });
+			if (linked && Files::pathExists(output))
+			{
+				ret = linker;
+				break;
+			}
+		}
+	}
+
+	Files::removeRecursively(inWorkingDirectory);
+#else
+	UNUSED(inCompiler, inWorkingDirectory);
+#endif
+
+	return ret;
+}
+
 /*****************************************************************************/
 bool CompilerTools::initialize(IBuildEnvironment& inEnvironment)
 {
@@ -551,6 +600,16 @@ void CompilerTools::setLinker(std::string&& inValue) noexcept
 	m_linker = std::move(inValue);
 }
 
+/*****************************************************************************/
+const std::string& CompilerTools::fastLinker() const noexcept
+{
+	return m_fastLinker;
+}
+void CompilerTools::setFastLinker(std::string&& inValue) noexcept
+{
+	m_fastLinker = std::move(inValue);
+}
+
 /*****************************************************************************/
 const std::string& CompilerTools::make() const noexcept
 {
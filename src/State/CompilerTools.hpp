@@ -21,6 +21,8 @@ struct CompilerTools
 	static StringList getToolchainStrategiesForSchema();
 	static StringList getToolchainStrategies();
 	static StringList getToolchainBuildPathStyles();
+	static StringList getFastLinkerCandidates();
+	static std::string detectFastLinker(const std::string& inCompiler, const std::string& inWorkingDirectory);
 
 	bool initialize(IBuildEnvironment& inEnvironment);
 	bool validate();
@@ -83,6 +85,9 @@ struct CompilerTools
 	const std::string& linker() const noexcept;
 	void setLinker(std::string&& inValue) noexcept;
 
+	const std::string& fastLinker() const noexcept;
+	void setFastLinker(std::string&& inValue) noexcept;
+
 	const std::string& make() const noexcept;
 	void setMake(std::string&& inValue) noexcept;
 	u32 makeVersionMajor() const noexcept;
@@ -120,6 +125,7 @@ private:
 	std::string m_cmake;
 	std::string m_compilerWindowsResource;
 	std::string m_disassembler;
+	std::string m_fastLinker;
 	std::string m_linker;
 	std::string m_make;
 	std::string m_meson;
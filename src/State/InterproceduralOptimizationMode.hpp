@@ -0,0 +1,16 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+enum class InterproceduralOptimizationMode : u16
+{
+	Auto,
+	Full,
+	Thin
+};
+}
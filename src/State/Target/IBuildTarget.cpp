@@ -186,7 +186,7 @@ bool IBuildTarget::replaceVariablesInPathList(StringList& outList) const
 }
 
 /*****************************************************************************/
-bool IBuildTarget::expandGlobPatternsInList(StringList& outList, GlobMatch inSettings) const
+bool IBuildTarget::expandGlobPatternsInList(StringList& outList, GlobMatch inSettings, const ExcludeMatcher* inExcludes) const
 {
 	StringList list = outList;
 	if (!replaceVariablesInPathList(list))
@@ -195,7 +195,7 @@ bool IBuildTarget::expandGlobPatternsInList(StringList& outList, GlobMatch inSet
 	outList.clear();
 	for (const auto& val : list)
 	{
-		if (!Files::addPathToListWithGlob(val, outList, inSettings))
+		if (!Files::addPathToListWithGlob(val, outList, inSettings, &m_state.globs, inExcludes))
 			return false;
 	}
 
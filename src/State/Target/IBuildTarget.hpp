@@ -11,6 +11,7 @@
 namespace chalet
 {
 class BuildState;
+class ExcludeMatcher;
 
 struct IBuildTarget;
 
@@ -50,7 +51,7 @@ struct IBuildTarget
 protected:
 	bool resolveDependentTargets(StringList& outDepends, std::string& outPath, const char* inKey) const;
 	bool replaceVariablesInPathList(StringList& outList) const;
-	bool expandGlobPatternsInList(StringList& outList, GlobMatch inSettings) const;
+	bool expandGlobPatternsInList(StringList& outList, GlobMatch inSettings, const ExcludeMatcher* inExcludes = nullptr) const;
 	bool validateWorkingDirectory(std::string& outPath) const;
 
 	const BuildState& m_state;
@@ -6,6 +6,7 @@
 #include "State/Target/SourceTarget.hpp"
 
 #include "BuildEnvironment/IBuildEnvironment.hpp"
+#include "Core/CommandLineInputs.hpp"
 #include "State/BuildConfiguration.hpp"
 #include "State/BuildPaths.hpp"
 #include "State/BuildState.hpp"
@@ -13,6 +14,7 @@
 #include "State/PackageManager.hpp"
 #include "State/TargetMetadata.hpp"
 #include "State/WorkspaceEnvironment.hpp"
+#include "System/ExcludeMatcher.hpp"
 #include "System/Files.hpp"
 #include "Utility/Hash.hpp"
 #include "Utility/List.hpp"
@@ -66,9 +68,18 @@ bool SourceTarget::initialize()
 
 	m_headers = m_files;
 
+	// Excludes aren't expanded - they're compiled once, and excluded folders are skipped while the files are found
+	if (!replaceVariablesInPathList(m_fileExcludes))
+	{
+		Diagnostic::error("There was a problem resolving the excluded files for the '{}' target. {}.", this->name(), globMessage);
+		return false;
+	}
+
+	ExcludeMatcher excludes(m_fileExcludes);
+
 	// TODO: This right here, is slow - it accounts for most of the time spent in this method
 	//
-	if (!expandGlobPatternsInList(m_files, GlobMatch::Files))
+	if (!expandGlobPatternsInList(m_files, GlobMatch::Files, &excludes))
 	{
 		Diagnostic::error("There was a problem resolving the files for the '{}' target. {}.", this->name(), globMessage);
 		return false;
@@ -80,14 +91,14 @@ bool SourceTarget::initialize()
 		return false;
 	}
 
-	// LOG("--", this->name(), timer.asString());
-
-	if (!expandGlobPatternsInList(m_fileExcludes, GlobMatch::FilesAndFolders))
+	if (!expandGlobPatternsInList(m_heavyFiles, GlobMatch::Files))
 	{
-		Diagnostic::error("There was a problem resolving the excluded files for the '{}' target. {}.", this->name(), globMessage);
+		Diagnostic::error("There was a problem resolving the heavy files for the '{}' target. {}.", this->name(), globMessage);
 		return false;
 	}
 
+	// LOG("--", this->name(), timer.asString());
+
 	if (!expandGlobPatternsInList(m_copyFilesOnRun, GlobMatch::FilesAndFolders))
 	{
 		Diagnostic::error("There was a problem resolving the files to copy on run for the '{}' target. {}.", this->name(), globMessage);
@@ -140,7 +151,7 @@ bool SourceTarget::initialize()
 	if (!m_state.replaceVariablesInString(m_emscriptenShellFile, this))
 		return false;
 
-	if (!removeExcludedFiles())
+	if (!removeExcludedFiles(excludes))
 		return false;
 
 	if (!determinePicType())
@@ -267,42 +278,16 @@ bool SourceTarget::validate()
 }
 
 /*****************************************************************************/
-bool SourceTarget::removeExcludedFiles()
+// Globbed files were already filtered while they were found - this catches the ones listed by name
+//
+bool SourceTarget::removeExcludedFiles(const ExcludeMatcher& inExcludes)
 {
-	if (!m_fileExcludes.empty())
+	if (!inExcludes.empty())
 	{
-		std::string excludes = String::join(m_fileExcludes);
-
-		auto itr = m_files.begin();
-		while (itr != m_files.end())
-		{
-			if (itr->empty())
-			{
-				itr = m_files.erase(itr);
-			}
-			else
-			{
-				auto& path = *itr;
-				bool excluded = String::contains(path, excludes);
-
-				if (!excluded)
-				{
-					for (auto& exclude : m_fileExcludes)
-					{
-						if (String::contains(exclude, path))
-						{
-							excluded = true;
-							break;
-						}
-					}
-				}
-
-				if (excluded)
-					itr = m_files.erase(itr);
-				else
-					++itr;
-			}
-		}
+		auto removed = std::remove_if(m_files.begin(), m_files.end(), [&inExcludes](const std::string& inFile) {
+			return inFile.empty() || inExcludes.isExcluded(inFile);
+		});
+		m_files.erase(removed, m_files.end());
 	}
 
 	return true;
@@ -371,85 +356,185 @@ bool SourceTarget::initializeUnityBuild()
 			return false;
 		}
 
-		m_unityBuildContents = "// Unity build file generated by Chalet\n\n";
+		m_unityBuildContents.clear();
 
-		for (std::string file : m_files)
+		if (m_unityBuildChunks <= 1)
 		{
-			for (auto& include : m_includeDirs)
-			{
-				if (String::startsWith(include, file))
-				{
-					auto size = include.size();
-					if (file[size] == '/')
-						file = file.substr(size + 1);
-					else
-						file = file.substr(size);
+			auto sourceFile = m_state.paths.getUnityBuildSourceFilename(*this);
+			m_unityBuildContents[sourceFile] = getUnityBuildContents(m_files);
 
-					break;
-				}
+			if (!generateUnityBuildFiles())
+				return false;
+
+			m_files = { std::move(sourceFile) };
+			return true;
+		}
+
+		// Files are assigned to chunks by a hash of their path, so adding or removing a file
+		//   only changes the chunk it lands in
+		//
+		std::vector<StringList> chunks(m_unityBuildChunks);
+		for (auto& file : m_files)
+		{
+			auto index = getUnityBuildChunkIndex(file);
+			chunks[index].push_back(file);
+		}
+
+		StringList hotFiles = getUnityBuildHotFiles(chunks);
+
+		StringList files;
+		for (size_t i = 0; i < chunks.size(); ++i)
+		{
+			StringList chunkFiles;
+			for (auto& file : chunks[i])
+			{
+				if (!List::contains(hotFiles, file))
+					chunkFiles.push_back(file);
 			}
-			m_unityBuildContents += fmt::format("#include \"{}\"\n", file);
+
+			if (chunkFiles.empty())
+				continue;
+
+			auto sourceFile = m_state.paths.getUnityBuildChunkSourceFilename(*this, i);
+			m_unityBuildContents[sourceFile] = getUnityBuildContents(chunkFiles);
+			files.emplace_back(std::move(sourceFile));
 		}
 
-		std::string sourceFile;
-		if (!generateUnityBuildFile(sourceFile))
+		if (!generateUnityBuildFiles())
 			return false;
 
-		m_files = { std::move(sourceFile) };
+		for (auto& file : hotFiles)
+			files.emplace_back(std::move(file));
+
+		m_files = std::move(files);
 	}
 
 	return true;
 }
 
 /*****************************************************************************/
-std::string SourceTarget::getUnityBuildFile() const
+std::string SourceTarget::getUnityBuildContents(const StringList& inFiles) const
 {
-	chalet_assert(!m_unityBuildContents.empty(), "unity build was not initialized before the build file was generated.");
-	return m_state.paths.getUnityBuildSourceFilename(*this);
+	std::string ret = "// Unity build file generated by Chalet\n\n";
+
+	for (std::string file : inFiles)
+	{
+		for (auto& include : m_includeDirs)
+		{
+			if (String::startsWith(include, file))
+			{
+				auto size = include.size();
+				if (file[size] == '/')
+					file = file.substr(size + 1);
+				else
+					file = file.substr(size);
+
+				break;
+			}
+		}
+		ret += fmt::format("#include \"{}\"\n", file);
+	}
+
+	return ret;
 }
 
 /*****************************************************************************/
-bool SourceTarget::generateUnityBuildFile(std::string& sourceFile) const
+size_t SourceTarget::getUnityBuildChunkIndex(const std::string& inFile) const
 {
-	chalet_assert(!m_unityBuildContents.empty(), "unity build was not initialized before the build file was generated.");
+	// FNV-1a - std::hash isn't guaranteed to be stable between builds of chalet
+	u64 hash = 14695981039346656037ULL;
+	for (auto& c : inFile)
+	{
+		hash ^= static_cast<u8>(c);
+		hash *= 1099511628211ULL;
+	}
 
-	sourceFile = getUnityBuildFile();
-	if (sourceFile.empty())
-		return false;
+	return static_cast<size_t>(hash % static_cast<u64>(m_unityBuildChunks));
+}
 
-	auto folder = String::getPathFolder(sourceFile);
-	if (!Files::pathExists(folder))
+/*****************************************************************************/
+// Files edited since the previous build are compiled on their own, so iterating on one file
+//   doesn't recompile its whole chunk every time. They go back into their chunk the next time
+//   that chunk has to be rebuilt anyway (another file in it changed)
+//
+StringList SourceTarget::getUnityBuildHotFiles(const std::vector<StringList>& inChunks) const
+{
+	StringList ret;
+
+	const auto& route = m_state.inputs.route();
+	if (route.isRebuild())
+		return ret;
+
+	bool updateHotFiles = route.isBuild() || route.isBuildRun();
+	auto hotFilesList = fmt::format("{}/{}_unity.hot", m_state.paths.intermediateDir(*this), this->name());
+
+	if (Files::pathExists(hotFilesList))
 	{
-		if (!Files::makeDirectory(folder))
+		auto lastBuildTime = Files::getLastWriteTime(hotFilesList);
+		auto previousHotFiles = String::split(Files::getFileContents(hotFilesList), '\n');
+
+		for (auto& chunk : inChunks)
 		{
-			Diagnostic::error("Error creating directory: '{}'", folder);
-			return false;
+			StringList changed;
+			if (updateHotFiles)
+			{
+				for (auto& file : chunk)
+				{
+					if (!List::contains(previousHotFiles, file) && Files::getLastWriteTime(file) > lastBuildTime)
+						changed.push_back(file);
+				}
+			}
+
+			if (changed.empty())
+			{
+				for (auto& file : chunk)
+				{
+					if (List::contains(previousHotFiles, file))
+						ret.push_back(file);
+				}
+			}
+			else
+			{
+				for (auto& file : changed)
+					ret.emplace_back(std::move(file));
+			}
 		}
 	}
 
-	bool generateFile = true;
-	std::string existingContents;
-	if (Files::pathExists(sourceFile))
+	if (updateHotFiles)
 	{
-		existingContents = Files::getFileContents(sourceFile);
-		if (!existingContents.empty() && existingContents.back() == '\n')
-			existingContents.pop_back(); // last '\n'
+		// Always re-written - its timestamp marks the start of the last build
+		if (!Files::createFileWithContents(hotFilesList, String::join(ret, '\n')))
+			Diagnostic::warn("Error creating file: '{}'", hotFilesList);
+	}
 
-#if defined(CHALET_WIN32)
-		if (!existingContents.empty() && existingContents.back() == '\r')
-			existingContents.pop_back(); // last '\r'
-#endif
+	return ret;
+}
 
-		generateFile = existingContents.empty() || !String::equals(m_unityBuildContents, existingContents);
-	}
+/*****************************************************************************/
+bool SourceTarget::generateUnityBuildFiles() const
+{
+	chalet_assert(!m_unityBuildContents.empty(), "unity build was not initialized before the build files were generated.");
 
-	if (generateFile)
+	for (auto& [sourceFile, contents] : m_unityBuildContents)
 	{
-		if (!Files::createFileWithContents(sourceFile, m_unityBuildContents))
-		{
-			Diagnostic::error("Error creating file: '{}'", sourceFile);
+		if (!generateUnityBuildFile(sourceFile, contents))
 			return false;
-		}
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+bool SourceTarget::generateUnityBuildFile(const std::string& inSourceFile, const std::string& inContents) const
+{
+	if (inSourceFile.empty())
+		return false;
+
+	if (!Files::createFileWithContentsIfChanged(inSourceFile, inContents))
+	{
+		Diagnostic::error("Error creating file: '{}'", inSourceFile);
+		return false;
 	}
 
 	return true;
@@ -472,11 +557,12 @@ const std::string& SourceTarget::getHash() const
 		auto appleFrameworkPaths = String::join(m_appleFrameworkPaths);
 		auto appleFrameworks = String::join(m_appleFrameworks);
 		auto configureFiles = String::join(m_configureFiles);
+		auto heavyFiles = String::join(m_heavyFiles);
 		auto emscriptenEmbedFiles = String::join(m_emscriptenEmbedFiles);
 		auto emscriptenPreloadFiles = String::join(m_emscriptenPreloadFiles);
 		auto dependsOn = String::join(m_dependsOn);
 
-		auto hashable = Hash::getHashableString(this->name(), files, defines, links, staticLinks, warnings, compileOptions, libDirs, includeDirs, appleFrameworkPaths, appleFrameworks, configureFiles, emscriptenEmbedFiles, emscriptenPreloadFiles, dependsOn, m_warningsPresetString, m_cStandard, m_cppStandard, m_precompiledHeader, m_inputCharset, m_executionCharset, m_windowsApplicationManifest, m_windowsApplicationIcon, m_buildSuffix, m_threads, m_cppFilesystem, m_cppModules, m_cppConcepts, m_runtimeTypeInformation, m_exceptions, m_fastMath, m_staticRuntimeLibrary, m_treatWarningsAsErrors, m_posixThreads, m_invalidWarningPreset, m_unityBuild, m_windowsApplicationManifestGenerationEnabled, m_mingwUnixSharedLibraryNamingConvention, m_setWindowsPrefixOutputFilename, m_windowsOutputDef, m_kind, m_language, m_warningsPreset, m_windowsSubSystem, m_windowsEntryPoint, m_picType, m_emscriptenShellFile);
+		auto hashable = Hash::getHashableString(this->name(), files, defines, links, staticLinks, warnings, compileOptions, libDirs, includeDirs, appleFrameworkPaths, appleFrameworks, configureFiles, heavyFiles, emscriptenEmbedFiles, emscriptenPreloadFiles, dependsOn, m_warningsPresetString, m_cStandard, m_cppStandard, m_precompiledHeader, m_inputCharset, m_executionCharset, m_windowsApplicationManifest, m_windowsApplicationIcon, m_buildSuffix, m_threads, m_cppFilesystem, m_cppModules, m_cppConcepts, m_runtimeTypeInformation, m_exceptions, m_fastMath, m_staticRuntimeLibrary, m_treatWarningsAsErrors, m_posixThreads, m_invalidWarningPreset, m_unityBuild, m_unityBuildChunks, m_windowsApplicationManifestGenerationEnabled, m_mingwUnixSharedLibraryNamingConvention, m_setWindowsPrefixOutputFilename, m_windowsOutputDef, m_kind, m_language, m_warningsPreset, m_windowsSubSystem, m_windowsEntryPoint, m_picType, m_emscriptenShellFile);
 
 		m_hash = Hash::string(hashable);
 	}
@@ -968,6 +1054,27 @@ void SourceTarget::addConfigureFile(std::string&& inValue)
 	List::addIfDoesNotExist(m_configureFiles, std::move(inValue));
 }
 
+/*****************************************************************************/
+const StringList& SourceTarget::heavyFiles() const noexcept
+{
+	return m_heavyFiles;
+}
+
+void SourceTarget::addHeavyFiles(StringList&& inList)
+{
+	List::forEach(inList, this, &SourceTarget::addHeavyFile);
+}
+
+void SourceTarget::addHeavyFile(std::string&& inValue)
+{
+	List::addIfDoesNotExist(m_heavyFiles, std::move(inValue));
+}
+
+bool SourceTarget::isHeavyFile(const std::string& inFile) const
+{
+	return !m_heavyFiles.empty() && List::contains(m_heavyFiles, inFile);
+}
+
 /*****************************************************************************/
 const StringList& SourceTarget::dependsOn() const noexcept
 {
@@ -1309,6 +1416,16 @@ void SourceTarget::setUnityBuild(const bool inValue) noexcept
 	m_unityBuild = inValue;
 }
 
+/*****************************************************************************/
+u32 SourceTarget::unityBuildChunks() const noexcept
+{
+	return m_unityBuildChunks;
+}
+void SourceTarget::setUnityBuildChunks(const i32 inValue) noexcept
+{
+	m_unityBuildChunks = static_cast<u32>(std::max(inValue, 1));
+}
+
 /*****************************************************************************/
 void SourceTarget::setMinGWUnixSharedLibraryNamingConvention(const bool inValue) noexcept
 {
@@ -19,6 +19,7 @@ namespace chalet
 {
 struct TargetMetadata;
 class BuildState;
+class ExcludeMatcher;
 
 struct SourceTarget final : public IBuildTarget
 {
@@ -127,6 +128,11 @@ struct SourceTarget final : public IBuildTarget
 	void addConfigureFiles(StringList&& inList);
 	void addConfigureFile(std::string&& inValue);
 
+	const StringList& heavyFiles() const noexcept;
+	void addHeavyFiles(StringList&& inList);
+	void addHeavyFile(std::string&& inValue);
+	bool isHeavyFile(const std::string& inFile) const;
+
 	const StringList& dependsOn() const noexcept;
 	void addDependsOn(StringList&& inList);
 	void addDependsOn(std::string&& inValue);
@@ -216,6 +222,9 @@ struct SourceTarget final : public IBuildTarget
 	bool unityBuild() const noexcept;
 	void setUnityBuild(const bool inValue) noexcept;
 
+	u32 unityBuildChunks() const noexcept;
+	void setUnityBuildChunks(const i32 inValue) noexcept;
+
 	void setMinGWUnixSharedLibraryNamingConvention(const bool inValue) noexcept;
 
 	bool windowsOutputDef() const noexcept;
@@ -227,14 +236,17 @@ struct SourceTarget final : public IBuildTarget
 	StringList getResolvedRunDependenciesList() const;
 	StringList getLinkerDependentFiles() const;
 
-	bool generateUnityBuildFile(std::string& outSourceFile) const;
+	bool generateUnityBuildFiles() const;
 
 private:
-	bool removeExcludedFiles();
+	bool removeExcludedFiles(const ExcludeMatcher& inExcludes);
 	bool determinePicType();
 	bool initializeUnityBuild();
+	bool generateUnityBuildFile(const std::string& inSourceFile, const std::string& inContents) const;
 
-	std::string getUnityBuildFile() const;
+	std::string getUnityBuildContents(const StringList& inFiles) const;
+	size_t getUnityBuildChunkIndex(const std::string& inFile) const;
+	StringList getUnityBuildHotFiles(const std::vector<StringList>& inChunks) const;
 	std::string getPrecompiledHeaderResolvedToRoot() const;
 
 	SourceKind parseProjectKind(const std::string& inValue);
@@ -262,11 +274,14 @@ private:
 	StringList m_headers;
 	StringList m_fileExcludes;
 	StringList m_configureFiles;
+	StringList m_heavyFiles;
 	StringList m_importPackages;
 	StringList m_ccacheOptions;
 	StringList m_emscriptenPreloadFiles;
 	StringList m_emscriptenEmbedFiles;
 
+	Dictionary<std::string> m_unityBuildContents;
+
 	std::string m_warningsPresetString;
 	std::string m_outputFile;
 	std::string m_cStandard;
@@ -277,7 +292,6 @@ private:
 	std::string m_windowsApplicationManifest;
 	std::string m_windowsApplicationIcon;
 	std::string m_buildSuffix;
-	std::string m_unityBuildContents;
 	std::string m_runWorkingDirectory;
 	std::string m_emscriptenShellFile;
 
@@ -288,6 +302,8 @@ private:
 	WindowsEntryPoint m_windowsEntryPoint = WindowsEntryPoint::Main;
 	PositionIndependentCodeType m_picType = PositionIndependentCodeType::None;
 
+	u32 m_unityBuildChunks = 1;
+
 	bool m_threads = true;
 	bool m_cppFilesystem = false;
 	bool m_cppModules = false;
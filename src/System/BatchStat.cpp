@@ -0,0 +1,288 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "System/BatchStat.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include <sys/stat.h>
+
+#if defined(CHALET_LINUX) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <linux/io_uring.h>
+		#if defined(IORING_FEAT_FAST_POLL)
+			#define CHALET_IO_URING 1
+		#endif
+	#endif
+#endif
+
+#if defined(CHALET_IO_URING)
+	#include <cerrno>
+	#include <cstring>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+namespace chalet
+{
+namespace
+{
+// Below this, a batch isn't worth setting up
+constexpr size_t kMinBatchSize = 64;
+
+// The lookups mostly wait on the file system (especially a network one), so there's more threads than cores
+constexpr size_t kMaxThreads = 16;
+constexpr size_t kFilesPerJob = 64;
+
+/*****************************************************************************/
+i64 getLastWriteTime(const std::string& inFile)
+{
+	struct stat statBuffer;
+	if (::stat(inFile.c_str(), &statBuffer) != 0)
+		return -1;
+
+	return static_cast<i64>(statBuffer.st_mtime);
+}
+
+/*****************************************************************************/
+void getLastWriteTimesWithThreads(const StringList& inFiles, std::vector<i64>& outTimes)
+{
+	std::atomic<size_t> next = 0;
+	auto worker = [&inFiles, &outTimes, &next]() {
+		while (true)
+		{
+			size_t start = next.fetch_add(kFilesPerJob);
+			if (start >= inFiles.size())
+				break;
+
+			size_t end = std::min(start + kFilesPerJob, inFiles.size());
+			for (size_t i = start; i < end; ++i)
+				outTimes[i] = getLastWriteTime(inFiles[i]);
+		}
+	};
+
+	size_t jobs = (inFiles.size() + kFilesPerJob - 1) / kFilesPerJob;
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < std::min(jobs, kMaxThreads); ++i)
+		threads.emplace_back(worker);
+
+	// The calling thread takes part too
+	worker();
+
+	for (auto& thread : threads)
+		thread.join();
+}
+
+#if defined(CHALET_IO_URING)
+constexpr u32 kRingEntries = 256;
+
+// Set once the kernel turns out to not have io_uring (or not allow it), or to not support statx with it
+std::atomic<bool> ioUringUnavailable = false;
+
+/*****************************************************************************/
+// Just enough of an io_uring to submit statx requests, without depending on liburing
+//
+struct IoUring
+{
+	io_uring_params params;
+	i32 fd = -1;
+
+	u8* sqRing = nullptr;
+	u8* cqRing = nullptr;
+	io_uring_sqe* sqes = nullptr;
+
+	size_t sqRingSize = 0;
+	size_t cqRingSize = 0;
+	size_t sqesSize = 0;
+
+	IoUring()
+	{
+		std::memset(&params, 0, sizeof(params));
+	}
+
+	~IoUring()
+	{
+		if (sqes != nullptr)
+			::munmap(sqes, sqesSize);
+
+		if (cqRing != nullptr && cqRing != sqRing)
+			::munmap(cqRing, cqRingSize);
+
+		if (sqRing != nullptr)
+			::munmap(sqRing, sqRingSize);
+
+		if (fd >= 0)
+			::close(fd);
+	}
+
+	bool initialize(const u32 inEntries)
+	{
+		fd = static_cast<i32>(::syscall(__NR_io_uring_setup, inEntries, &params));
+		if (fd < 0)
+			return false;
+
+		sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+		cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+		bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMap)
+		{
+			sqRingSize = std::max(sqRingSize, cqRingSize);
+			cqRingSize = sqRingSize;
+		}
+
+		sqRing = map(sqRingSize, IORING_OFF_SQ_RING);
+		if (sqRing == nullptr)
+			return false;
+
+		cqRing = singleMap ? sqRing : map(cqRingSize, IORING_OFF_CQ_RING);
+		if (cqRing == nullptr)
+			return false;
+
+		sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = reinterpret_cast<io_uring_sqe*>(map(sqesSize, IORING_OFF_SQES));
+		return sqes != nullptr;
+	}
+
+	u8* map(const size_t inSize, const u64 inOffset) const
+	{
+		void* ptr = ::mmap(nullptr, inSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, static_cast<off_t>(inOffset));
+		return ptr == MAP_FAILED ? nullptr : static_cast<u8*>(ptr);
+	}
+
+	u32* sqField(const u32 inOffset) const
+	{
+		return reinterpret_cast<u32*>(sqRing + inOffset);
+	}
+
+	u32* cqField(const u32 inOffset) const
+	{
+		return reinterpret_cast<u32*>(cqRing + inOffset);
+	}
+};
+
+/*****************************************************************************/
+// Submits a full ring of statx requests at a time, and waits for all of them before the next - returns
+//   false if io_uring can't be used, in which case nothing is left in flight
+//
+bool getLastWriteTimesWithIoUring(const StringList& inFiles, std::vector<i64>& outTimes)
+{
+	IoUring ring;
+	if (!ring.initialize(kRingEntries))
+		return false;
+
+	const auto& sqOffsets = ring.params.sq_off;
+	const auto& cqOffsets = ring.params.cq_off;
+
+	const u32 sqMask = *ring.sqField(sqOffsets.ring_mask);
+	const u32 cqMask = *ring.cqField(cqOffsets.ring_mask);
+	u32* sqTail = ring.sqField(sqOffsets.tail);
+	u32* sqArray = ring.sqField(sqOffsets.array);
+	u32* cqHead = ring.cqField(cqOffsets.head);
+	u32* cqTail = ring.cqField(cqOffsets.tail);
+	auto cqes = reinterpret_cast<io_uring_cqe*>(ring.cqRing + cqOffsets.cqes);
+
+	const u32 entries = ring.params.sq_entries;
+	std::vector<struct statx> buffers(entries);
+
+	for (size_t start = 0; start < inFiles.size(); start += entries)
+	{
+		u32 count = static_cast<u32>(std::min<size_t>(entries, inFiles.size() - start));
+
+		u32 tail = *sqTail;
+		for (u32 i = 0; i < count; ++i)
+		{
+			u32 index = (tail + i) & sqMask;
+
+			auto& sqe = ring.sqes[index];
+			std::memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_STATX;
+			sqe.fd = AT_FDCWD;
+			sqe.addr = reinterpret_cast<u64>(inFiles[start + i].c_str());
+			sqe.len = STATX_MTIME;
+			sqe.off = reinterpret_cast<u64>(&buffers[i]);
+			sqe.user_data = i;
+
+			sqArray[index] = index;
+		}
+		__atomic_store_n(sqTail, tail + count, __ATOMIC_RELEASE);
+
+		bool unsupported = false;
+		u32 toSubmit = count;
+		u32 completed = 0;
+		while (completed < count)
+		{
+			auto result = ::syscall(__NR_io_uring_enter, ring.fd, toSubmit, count - completed, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (result < 0)
+			{
+				if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+					continue;
+
+				// Nothing from this batch is in flight yet, so the buffers can go away
+				if (toSubmit == count)
+					return false;
+
+				toSubmit = 0;
+				continue;
+			}
+
+			toSubmit -= std::min(toSubmit, static_cast<u32>(result));
+
+			u32 head = *cqHead;
+			u32 available = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+			for (; head != available; ++head)
+			{
+				const auto& cqe = cqes[head & cqMask];
+				size_t i = static_cast<size_t>(cqe.user_data);
+
+				// Kernels without statx in io_uring reject the request itself
+				if (cqe.res == -EINVAL)
+					unsupported = true;
+
+				outTimes[start + i] = cqe.res == 0 ? static_cast<i64>(buffers[i].stx_mtime.tv_sec) : -1;
+				++completed;
+			}
+			__atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+		}
+
+		if (unsupported)
+			return false;
+	}
+
+	return true;
+}
+#endif
+}
+
+/*****************************************************************************/
+std::vector<i64> BatchStat::getLastWriteTimes(const StringList& inFiles)
+{
+	std::vector<i64> ret(inFiles.size(), -1);
+
+	if (inFiles.size() < kMinBatchSize)
+	{
+		for (size_t i = 0; i < inFiles.size(); ++i)
+			ret[i] = getLastWriteTime(inFiles[i]);
+
+		return ret;
+	}
+
+#if defined(CHALET_IO_URING)
+	if (!ioUringUnavailable)
+	{
+		if (getLastWriteTimesWithIoUring(inFiles, ret))
+			return ret;
+
+		ioUringUnavailable = true;
+	}
+#endif
+
+	getLastWriteTimesWithThreads(inFiles, ret);
+	return ret;
+}
+}
@@ -0,0 +1,18 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// Looks up the metadata of many files at once, instead of one stat at a time - on Linux, the lookups
+//   are all handed to io_uring (statx), and where that isn't available, they're spread over a few threads
+//
+namespace BatchStat
+{
+// Same as Files::getLastWriteTime for each of inFiles, but -1 if it doesn't exist
+std::vector<i64> getLastWriteTimes(const StringList& inFiles);
+}
+}
@@ -0,0 +1,156 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "System/ExcludeMatcher.hpp"
+
+#include "System/Files.hpp"
+#include "Utility/Path.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+/*****************************************************************************/
+template <typename Callback>
+void forEachPathComponent(const std::string_view inPath, const Callback& onComponent)
+{
+	size_t start = 0;
+	while (start < inPath.size())
+	{
+		auto end = inPath.find('/', start);
+		if (end == std::string_view::npos)
+			end = inPath.size();
+
+		auto name = inPath.substr(start, end - start);
+		if (!name.empty() && name != "." && !onComponent(name))
+			return;
+
+		start = end + 1;
+	}
+}
+}
+
+/*****************************************************************************/
+ExcludeMatcher::ExcludeMatcher(const StringList& inExcludes)
+{
+	m_workingDirectory = Files::getWorkingDirectory();
+	Path::toUnix(m_workingDirectory);
+	if (!m_workingDirectory.empty() && m_workingDirectory.back() != '/')
+		m_workingDirectory += '/';
+
+	m_nodes.emplace_back();
+
+	StringList globs;
+	for (auto& exclude : inExcludes)
+	{
+		auto path = getRelativePath(exclude);
+		if (path.find_first_of("*?{") != std::string::npos)
+		{
+			if (path.find('/') == std::string::npos)
+				path = "**/" + path; // same as an include glob without a folder
+
+			globs.emplace_back(std::move(path));
+			continue;
+		}
+
+		if (path.find('/') == std::string::npos)
+		{
+			if (!path.empty() && path != ".")
+				m_names.emplace(std::move(path));
+			continue;
+		}
+
+		i32 node = 0;
+		forEachPathComponent(path, [this, &node](const std::string_view inName) {
+			auto& children = m_nodes[node].children;
+			auto child = children.find(inName);
+			if (child != children.end())
+			{
+				node = child->second;
+			}
+			else
+			{
+				i32 next = static_cast<i32>(m_nodes.size());
+				children.emplace(std::string(inName), next);
+				m_nodes.emplace_back();
+				node = next;
+			}
+			return true;
+		});
+
+		if (node > 0)
+			m_nodes[node].excluded = true;
+	}
+
+	if (!globs.empty())
+		m_globs = GlobPattern(globs);
+}
+
+/*****************************************************************************/
+bool ExcludeMatcher::empty() const noexcept
+{
+	return m_nodes.size() <= 1 && m_names.empty() && m_globs.empty();
+}
+
+/*****************************************************************************/
+bool ExcludeMatcher::isExcluded(const std::string& inPath, State& outState) const
+{
+	outState.node = m_nodes.empty() ? -1 : 0;
+	outState.glob = m_globs.initialState();
+
+	bool excluded = false;
+	State next;
+	forEachPathComponent(getRelativePath(inPath), [this, &excluded, &outState, &next](const std::string_view inName) {
+		excluded = advance(outState, inName, next);
+		std::swap(outState, next);
+		return !excluded;
+	});
+
+	return excluded;
+}
+
+/*****************************************************************************/
+bool ExcludeMatcher::isExcluded(const std::string& inPath) const
+{
+	State state;
+	return isExcluded(inPath, state);
+}
+
+/*****************************************************************************/
+bool ExcludeMatcher::advance(const State& inState, const std::string_view inName, State& outState) const
+{
+	outState.node = -1;
+	outState.glob.clear();
+
+	if (inState.node >= 0)
+	{
+		auto& children = m_nodes[inState.node].children;
+		auto child = children.find(inName);
+		if (child != children.end())
+			outState.node = child->second;
+	}
+
+	if (!inState.glob.empty())
+		m_globs.advance(inState.glob, inName, outState.glob);
+
+	if (outState.node >= 0 && m_nodes[outState.node].excluded)
+		return true;
+
+	return m_names.find(inName) != m_names.end() || m_globs.isMatch(outState.glob);
+}
+
+/*****************************************************************************/
+std::string ExcludeMatcher::getRelativePath(const std::string& inPath) const
+{
+	std::string ret = inPath;
+	Path::toUnix(ret);
+
+	if (!m_workingDirectory.empty() && String::startsWith(m_workingDirectory, ret))
+		ret = ret.substr(m_workingDirectory.size());
+
+	return ret;
+}
+}
@@ -0,0 +1,53 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include "System/GlobPattern.hpp"
+
+namespace chalet
+{
+// A list of excludes compiled into one matcher - literal paths become a tree of folder names and the globs
+//   are matched together, so checking a path costs the same no matter how many excludes there are
+//   Paths are relative to the working directory, and excluding a folder excludes everything inside of it
+//   A name or glob without a folder (ie. main.cpp or *_test.cpp) excludes matching files and folders at any depth
+//
+class ExcludeMatcher
+{
+public:
+	struct State
+	{
+		i32 node = -1; // in the literal path tree, -1 once nothing in it can match
+		GlobPattern::State glob;
+	};
+
+	ExcludeMatcher() = default;
+	explicit ExcludeMatcher(const StringList& inExcludes);
+
+	bool empty() const noexcept;
+
+	// outState is for the entries inside of inPath
+	bool isExcluded(const std::string& inPath, State& outState) const;
+	bool isExcluded(const std::string& inPath) const;
+
+	// Whether the entry inName is excluded, given the state of the folder it's in
+	bool advance(const State& inState, const std::string_view inName, State& outState) const;
+
+private:
+	struct Node
+	{
+		std::map<std::string, i32, std::less<>> children;
+		bool excluded = false;
+	};
+
+	std::string getRelativePath(const std::string& inPath) const;
+
+	std::vector<Node> m_nodes;
+	std::set<std::string, std::less<>> m_names;
+	GlobPattern m_globs;
+
+	std::string m_workingDirectory;
+};
+}
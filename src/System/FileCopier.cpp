@@ -0,0 +1,417 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "System/FileCopier.hpp"
+
+#include <thread>
+
+#if !defined(CHALET_WIN32)
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#if defined(CHALET_LINUX)
+	#include <cerrno>
+	#include <linux/fs.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+#elif defined(CHALET_MACOS)
+	#include <sys/clonefile.h>
+#endif
+
+namespace chalet
+{
+namespace
+{
+constexpr size_t kMaxThreads = 8;
+
+#if defined(CHALET_LINUX)
+constexpr size_t kBufferSize = 128 * 1024;
+
+/*****************************************************************************/
+i64 getLastWrite(const struct stat& inStat)
+{
+	return static_cast<i64>(inStat.st_mtim.tv_sec) * 1'000'000'000 + static_cast<i64>(inStat.st_mtim.tv_nsec);
+}
+
+/*****************************************************************************/
+// The fastest way that works is used: a reflink shares the source's blocks until either is written to
+//   (btrfs, xfs), copy_file_range keeps the data in the kernel (or on the server, for network file systems),
+//   and reading into a buffer works everywhere else
+//
+bool copyContents(const i32 inSource, const i32 inDestination, const i64 inSize)
+{
+	#if defined(FICLONE)
+	if (::ioctl(inDestination, FICLONE, inSource) == 0)
+		return true;
+	#endif
+
+	#if defined(SYS_copy_file_range)
+	i64 remaining = inSize;
+	while (remaining > 0)
+	{
+		auto bytes = ::syscall(SYS_copy_file_range, inSource, nullptr, inDestination, nullptr, static_cast<size_t>(remaining), 0u);
+		if (bytes <= 0)
+			break;
+
+		remaining -= bytes;
+	}
+
+	if (remaining == 0)
+		return true;
+
+	// Not supported between these file systems (or the source changed) - start over
+	if (::lseek(inSource, 0, SEEK_SET) != 0 || ::ftruncate(inDestination, 0) != 0 || ::lseek(inDestination, 0, SEEK_SET) != 0)
+		return false;
+	#else
+	UNUSED(inSize);
+	#endif
+
+	std::vector<char> buffer(kBufferSize);
+	while (true)
+	{
+		auto bytes = ::read(inSource, buffer.data(), buffer.size());
+		if (bytes == 0)
+			return true;
+
+		if (bytes < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		const char* data = buffer.data();
+		while (bytes > 0)
+		{
+			auto written = ::write(inDestination, data, static_cast<size_t>(bytes));
+			if (written < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				return false;
+			}
+
+			data += written;
+			bytes -= written;
+		}
+	}
+}
+#endif
+}
+
+/*****************************************************************************/
+FileCopier::FileCopier(const fs::copy_options inOptions, const Mode inMode) :
+	m_options(inOptions),
+	m_mode(inMode)
+{
+}
+
+/*****************************************************************************/
+bool FileCopier::copy(const std::string& inFrom, const std::string& inTo)
+{
+	m_jobs.clear();
+	m_links.clear();
+	m_errors.clear();
+	m_next = 0;
+	m_copied = 0;
+	m_skipped = 0;
+	m_removed = 0;
+
+	std::error_code error;
+	if (fs::is_directory(inFrom, error))
+	{
+		if (!addFolder(inFrom, inTo))
+			return false;
+	}
+	else if (fs::exists(inFrom, error))
+	{
+		m_jobs.emplace_back(Job{ inFrom, inTo });
+	}
+	else
+	{
+		Diagnostic::error("Source path {} does not exist.", inFrom);
+		return false;
+	}
+
+	// Files are copied before links, since a link can point to one of them
+	size_t threadCount = std::min(m_jobs.size(), std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxThreads));
+
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < threadCount; ++i)
+		threads.emplace_back(&FileCopier::worker, this);
+
+	worker();
+
+	for (auto& thread : threads)
+		thread.join();
+
+	for (auto& link : m_links)
+	{
+		if (!linkFile(link))
+			m_errors.emplace_back(fmt::format("Symbolic link '{}' could not be copied to: {}", link.from, link.to));
+	}
+
+	for (auto& message : m_errors)
+		Diagnostic::error(message);
+
+	return m_errors.empty();
+}
+
+/*****************************************************************************/
+bool FileCopier::mirror(const std::string& inFrom, const std::string& inTo)
+{
+	if (!copy(inFrom, inTo))
+		return false;
+
+	const fs::path from{ inFrom };
+	const fs::path to{ inTo };
+
+	// Whatever is gone from the source is removed whole, without looking inside of it
+	std::vector<fs::path> removals;
+	std::error_code error;
+	fs::recursive_directory_iterator it(to, error);
+	for (; !error && it != fs::recursive_directory_iterator(); it.increment(error))
+	{
+		const auto& path = it->path();
+		if (!fs::exists(fs::symlink_status(from / path.lexically_relative(to), error)))
+		{
+			removals.push_back(path);
+			it.disable_recursion_pending();
+		}
+		error.clear();
+	}
+
+	if (error)
+	{
+		Diagnostic::error("Destination directory {} could not be read: {}", inTo, error.message());
+		return false;
+	}
+
+	for (auto& path : removals)
+	{
+		auto removed = fs::remove_all(path, error);
+		if (error)
+		{
+			Diagnostic::error("Unable to remove: {}", path.string());
+			return false;
+		}
+		m_removed += static_cast<size_t>(removed);
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+size_t FileCopier::filesCopied() const noexcept
+{
+	return m_copied;
+}
+
+/*****************************************************************************/
+size_t FileCopier::filesSkipped() const noexcept
+{
+	return m_skipped;
+}
+
+/*****************************************************************************/
+size_t FileCopier::filesRemoved() const noexcept
+{
+	return m_removed;
+}
+
+/*****************************************************************************/
+// Folders are created up front (one at a time), so the files can be copied in any order
+//
+bool FileCopier::addFolder(const fs::path& inFrom, const fs::path& inTo)
+{
+	std::error_code error;
+	if (!fs::exists(inTo, error))
+	{
+		fs::create_directories(inTo, error);
+		if (error)
+		{
+			Diagnostic::error("Unable to create destination directory {}", inTo.string());
+			return false;
+		}
+	}
+
+	fs::directory_iterator it(inFrom, error);
+	for (; !error && it != fs::directory_iterator(); it.increment(error))
+	{
+		const auto& path = it->path();
+		auto destination = inTo / path.filename();
+		if (it->is_symlink(error))
+		{
+			m_links.emplace_back(Job{ path.string(), destination.string() });
+		}
+		else if (it->is_directory(error))
+		{
+			if (!addFolder(path, destination))
+				return false;
+		}
+		else
+		{
+			m_jobs.emplace_back(Job{ path.string(), destination.string() });
+		}
+	}
+
+	if (error)
+	{
+		Diagnostic::error("Source directory {} could not be read: {}", inFrom.string(), error.message());
+		return false;
+	}
+
+	return true;
+}
+
+/*****************************************************************************/
+void FileCopier::worker()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_next < m_jobs.size())
+	{
+		const auto& job = m_jobs[m_next++];
+		lock.unlock();
+
+		bool skipped = false;
+		bool result = copyFile(job, skipped);
+
+		lock.lock();
+		if (!result)
+			m_errors.emplace_back(fmt::format("'{}' could not be copied to: {}", job.from, job.to));
+		else if (skipped)
+			++m_skipped;
+		else
+			++m_copied;
+	}
+}
+
+/*****************************************************************************/
+bool FileCopier::copyFile(const Job& inJob, bool& outSkipped) const
+{
+	const bool skipExisting = (m_options & fs::copy_options::skip_existing) != fs::copy_options::none;
+	const bool updateExisting = (m_options & fs::copy_options::update_existing) != fs::copy_options::none;
+
+#if defined(CHALET_LINUX)
+	struct stat source;
+	if (::stat(inJob.from.c_str(), &source) != 0)
+		return false;
+
+	struct stat destination;
+	if (::stat(inJob.to.c_str(), &destination) == 0)
+	{
+		const auto lastWrite = getLastWrite(source);
+		const auto destinationLastWrite = getLastWrite(destination);
+		if (skipExisting
+			|| (source.st_size == destination.st_size && lastWrite == destinationLastWrite)
+			|| (updateExisting && destinationLastWrite >= lastWrite))
+		{
+			outSkipped = true;
+			return true;
+		}
+
+		// If the old file is a hard link, writing to it would change the other one as well
+		::unlink(inJob.to.c_str());
+	}
+
+	if (m_mode == Mode::HardLink && ::link(inJob.from.c_str(), inJob.to.c_str()) == 0)
+		return true;
+
+	const auto mode = source.st_mode & 07777;
+	i32 input = ::open(inJob.from.c_str(), O_RDONLY | O_CLOEXEC);
+	if (input < 0)
+		return false;
+
+	i32 output = ::open(inJob.to.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, mode);
+	if (output < 0)
+	{
+		::close(input);
+		return false;
+	}
+
+	bool result = copyContents(input, output, static_cast<i64>(source.st_size));
+	if (result)
+	{
+		// The mode shouldn't depend on the umask, and the last write time is what the next copy compares
+		struct timespec times[2];
+		times[0].tv_sec = 0;
+		times[0].tv_nsec = UTIME_OMIT;
+		times[1] = source.st_mtim;
+		result = ::fchmod(output, mode) == 0 && ::futimens(output, times) == 0;
+	}
+
+	::close(output);
+	::close(input);
+	return result;
+#else
+	std::error_code error;
+	auto size = fs::file_size(inJob.from, error);
+	auto lastWrite = fs::last_write_time(inJob.from, error);
+	if (error)
+		return false;
+
+	if (fs::exists(inJob.to, error))
+	{
+		std::error_code destinationError;
+		auto destinationSize = fs::file_size(inJob.to, destinationError);
+		auto destinationLastWrite = fs::last_write_time(inJob.to, destinationError);
+		if (skipExisting
+			|| (!destinationError && size == destinationSize && lastWrite == destinationLastWrite)
+			|| (!destinationError && updateExisting && destinationLastWrite >= lastWrite))
+		{
+			outSkipped = true;
+			return true;
+		}
+
+		// If the old file is a hard link, writing to it would change the other one as well
+		fs::remove(inJob.to, error);
+	}
+
+	if (m_mode == Mode::HardLink)
+	{
+		fs::create_hard_link(inJob.from, inJob.to, error);
+		if (!error)
+			return true;
+	}
+
+	bool cloned = false;
+	#if defined(CHALET_MACOS)
+	// APFS clones share the source's blocks until either is written to
+	cloned = ::clonefile(inJob.from.c_str(), inJob.to.c_str(), 0) == 0;
+	#endif
+
+	if (!cloned)
+	{
+		error.clear();
+		fs::copy_file(inJob.from, inJob.to, fs::copy_options::overwrite_existing, error);
+		if (error)
+			return false;
+	}
+
+	fs::last_write_time(inJob.to, lastWrite, error);
+	return !error;
+#endif
+}
+
+/*****************************************************************************/
+bool FileCopier::linkFile(const Job& inJob) const
+{
+	std::error_code error;
+	if (fs::exists(fs::symlink_status(inJob.to, error)))
+	{
+		if ((m_options & fs::copy_options::skip_existing) != fs::copy_options::none)
+			return true;
+
+		fs::remove(inJob.to, error);
+	}
+
+	fs::copy_symlink(inJob.from, inJob.to, error);
+	return !error;
+}
+}
@@ -0,0 +1,63 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include <mutex>
+
+namespace chalet
+{
+// Copies a file or a folder tree, several files at a time. Each file is cloned if the file system supports
+//   it (a reflink), otherwise it's copied by the kernel, and only then through a buffer. Files whose size
+//   and last write time already match the destination are skipped. Symbolic links inside of a folder are
+//   copied as links
+//
+class FileCopier
+{
+public:
+	enum class Mode : u8
+	{
+		Copy,
+		HardLink, // For inputs that won't change - falls back to a copy across file systems
+	};
+
+	explicit FileCopier(const fs::copy_options inOptions = fs::copy_options::overwrite_existing, const Mode inMode = Mode::Copy);
+
+	// inTo is the path of the copy, not the folder it goes into
+	bool copy(const std::string& inFrom, const std::string& inTo);
+
+	// Copies the folder inFrom to inTo, and removes anything in inTo that isn't in inFrom
+	bool mirror(const std::string& inFrom, const std::string& inTo);
+
+	size_t filesCopied() const noexcept;
+	size_t filesSkipped() const noexcept;
+	size_t filesRemoved() const noexcept;
+
+private:
+	struct Job
+	{
+		std::string from;
+		std::string to;
+	};
+
+	bool addFolder(const fs::path& inFrom, const fs::path& inTo);
+	void worker();
+	bool copyFile(const Job& inJob, bool& outSkipped) const;
+	bool linkFile(const Job& inJob) const;
+
+	std::vector<Job> m_jobs;
+	std::vector<Job> m_links;
+
+	std::mutex m_mutex;
+	StringList m_errors;
+	size_t m_next = 0;
+	size_t m_copied = 0;
+	size_t m_skipped = 0;
+	size_t m_removed = 0;
+
+	fs::copy_options m_options;
+	Mode m_mode;
+};
+}
@@ -6,7 +6,6 @@
 #include "System/Files.hpp"
 
 #include <chrono>
-#include <regex>
 #include <sys/stat.h>
 #include <thread>
 
@@ -17,8 +16,13 @@
 	#include <winuser.h>
 #endif
 
+#include "Cache/ExecutableCache.hpp"
+#include "Cache/GlobCache.hpp"
 #include "Process/Environment.hpp"
 #include "Process/Process.hpp"
+#include "System/FileCopier.hpp"
+#include "System/GlobPattern.hpp"
+#include "System/GlobWalker.hpp"
 #include "Terminal/Output.hpp"
 #include "Utility/List.hpp"
 #include "Utility/Path.hpp"
@@ -59,91 +63,128 @@ std::time_t timePointToTime(T tp)
 	return system_clock::to_time_t(sctp);
 }
 
+inline std::string getMessage(const std::error_code& ec)
+{
+	if (ec)
+	{
+		auto message = ec.message();
+		if (message.back() == '.')
+			message.pop_back();
+
+		return message;
+	}
+	else
+	{
+		return "Unknown error";
+	}
+}
+
+#if defined(CHALET_MACOS)
 /*****************************************************************************/
-// NOTE: fs::copy_options::recursive follows all symlinks (bad!)
-//   This is a custom version that more or less does the same thing,
-//   but preserves symlinks (needed for copying frameworks)
+// The folder xcode-select -p would print, without running it - DEVELOPER_DIR if it's set, otherwise
+//   the link that xcode-select --switch writes
 //
-bool copyDirectory(const fs::path& source, const fs::path& dest, fs::copy_options inOptions, const bool inFailExists)
+std::string getActiveDeveloperDirectory()
 {
-	CHALET_TRY
+	auto developerDir = Environment::getString("DEVELOPER_DIR");
+	if (!developerDir.empty())
+		return developerDir;
+
+	std::error_code ec;
+	auto link = fs::read_symlink("/var/db/xcode_select_link", ec);
+	if (!ec && !link.empty())
+		return link.string();
+
+	return Files::getXcodePath();
+}
+#endif
+
+/*****************************************************************************/
+std::string searchForExecutable(const std::string& inExecutable)
+{
+	std::string result;
+#if defined(CHALET_WIN32)
+	PCHAR lpFilePart = NULL;
+	char filename[MAX_PATH];
+
+	auto exe = Files::getPlatformExecutableExtension();
+	if (String::contains('.', inExecutable))
 	{
-		if (!fs::exists(source) || !fs::is_directory(source))
-		{
-			Diagnostic::error("Source directory {} does not exist or is not a directory.", source.string());
-			return false;
-		}
-		if (inFailExists)
-		{
-			if (fs::exists(dest))
-			{
-				Diagnostic::error("Destination directory {} already exists.", dest.string());
-				return false;
-			}
-			if (!fs::create_directory(dest))
-			{
-				Diagnostic::error("Unable to create destination directory {}", dest.string());
-				return false;
-			}
-		}
-		else
-		{
-			if (!fs::exists(dest) && !fs::create_directory(dest))
-			{
-				Diagnostic::error("Unable to create destination directory {}", dest.string());
-				return false;
-			}
-		}
+		auto pos = inExecutable.find_last_of('.');
+		exe = inExecutable.substr(pos);
 	}
-	CHALET_CATCH(fs::filesystem_error & err)
+
+	if (SearchPathA(NULL, inExecutable.c_str(), exe.c_str(), MAX_PATH, filename, &lpFilePart) > 0)
 	{
-		CHALET_EXCEPT_ERROR(err.what())
-		return false;
+		result = std::string(filename);
+		Path::toUnix(result);
 	}
+#else
+	static auto pathIsValid = [](const bool hasExtension, const std::string& p) -> bool {
+		if (!Files::pathExists(p))
+			return false;
 
-	CHALET_TRY
+		return (hasExtension && Files::pathIsDirectory(p)) || (!hasExtension && !Files::pathIsDirectory(p));
+	};
+
+	const bool hasExtension = inExecutable.find_last_of('.') != std::string::npos;
+	if (!Files::pathExists(inExecutable)) // checks working dir
 	{
-		for (const auto& file : fs::directory_iterator(source))
+		auto path = Environment::getPath();
+		auto home = Environment::getUserDirectory();
+		size_t start = 0;
+		while (start != std::string::npos)
 		{
-			const auto& current = file.path();
-			if (file.is_symlink())
-			{
-				fs::copy_options options = inOptions | fs::copy_options::copy_symlinks;
-				fs::copy(current, dest / current.filename(), options);
-			}
-			else if (file.is_directory())
-			{
-				if (!copyDirectory(current, dest / current.filename(), inOptions, inFailExists))
-					return false;
-			}
-			else
+			auto end = path.find(':', start);
+			auto tmp = path.substr(start, end - start);
+			while (tmp.back() == '/')
+				tmp.pop_back();
+
+			if (String::startsWith("~/", tmp))
 			{
-				fs::copy(current, dest / current.filename(), inOptions);
+				tmp = fmt::format("{}/{}", home, tmp.substr(2));
 			}
+
+			result = fmt::format("{}/{}", tmp, inExecutable);
+
+			if (pathIsValid(hasExtension, result))
+				break;
+
+			result.clear();
+			start = end;
+			if (start != std::string::npos)
+				++start;
 		}
 	}
-	CHALET_CATCH(const std::exception& err)
-	{
-		CHALET_EXCEPT_ERROR(err.what());
-	}
 
-	return true;
-}
+	// Note: cli "which" (original method) has issues when PATH is changed inside chalet
+	//   doesn't seem to inherit the env
 
-inline std::string getMessage(const std::error_code& ec)
-{
-	if (ec)
-	{
-		auto message = ec.message();
-		if (message.back() == '.')
-			message.pop_back();
+	if (result.empty())
+		return result;
 
-		return message;
-	}
-	else
+	#if defined(CHALET_MACOS)
+	if (String::startsWith("/usr/bin/", result))
 	{
-		return "Unknown error";
+		auto& xcodePath = getXcodePath();
+		std::string withXcodePath = xcodePath + result;
+		if (pathIsValid(hasExtension, withXcodePath))
+		{
+			result = std::move(withXcodePath);
+		}
+		else
+		{
+			withXcodePath = fmt::format("{}/Toolchains/XcodeDefault.xctoolchain{}", xcodePath, result);
+			if (pathIsValid(hasExtension, withXcodePath))
+			{
+				result = std::move(withXcodePath);
+			}
+		}
 	}
+	#endif
+#endif
+
+	return result;
 }
 }
 
@@ -527,12 +568,14 @@ bool Files::copy(const std::string& inFrom, const std::string& inTo, const fs::c
 		else
 			Output::msgCopying(inFrom, fmt::format("{}/{}", inTo, String::getPathFilename(inFrom)));
 
-		if (fs::is_directory(from))
-			return copyDirectory(from, to, inOptions, true);
-		else
-			fs::copy(from, to, inOptions);
+		if (fs::is_directory(from) && fs::exists(to))
+		{
+			Diagnostic::error("Destination directory {} already exists.", to.string());
+			return false;
+		}
 
-		return true;
+		FileCopier copier(inOptions);
+		return copier.copy(inFrom, to.string());
 	}
 	CHALET_CATCH(const fs::filesystem_error& err)
 	{
@@ -552,12 +595,8 @@ bool Files::copySilent(const std::string& inFrom, const std::string& inTo, const
 		if (Output::showCommands())
 			Output::printCommand(fmt::format("copy to path: {} -> {}", inFrom, inTo));
 
-		if (fs::is_directory(from))
-			return copyDirectory(from, to, inOptions, false);
-		else
-			fs::copy(from, to, inOptions);
-
-		return true;
+		FileCopier copier(inOptions);
+		return copier.copy(inFrom, to.string());
 	}
 	CHALET_CATCH(const std::exception& err)
 	{
@@ -632,9 +671,11 @@ bool Files::moveSilent(const std::string& inFrom, const std::string& inTo, const
 		if (Output::showCommands())
 			Output::printCommand(fmt::format("move to path: {} -> {}", inFrom, inTo));
 
+		// The source is removed afterwards, so its files can be linked instead of copied
 		if (fs::is_directory(from))
 		{
-			return copyDirectory(from, to, inOptions, false);
+			FileCopier copier(inOptions, FileCopier::Mode::HardLink);
+			return copier.copy(inFrom, inTo);
 		}
 		else
 		{
@@ -744,7 +785,7 @@ bool Files::pathIsEmpty(const std::string& inPath, const std::vector<fs::path>&
 // Should match:
 //   https://www.digitalocean.com/community/tools/glob?comments=true&glob=src%2F%2A%2A%2F%2A.cpp&matches=false&tests=src&tests=src%2Fmain.cpp&tests=src%2Fpch.hpp&tests=src%2Ffoo&tests=src%2Ffoo%2Ffoo.cpp&tests=src%2Ffoo%2Ffoo.hpp&tests=src%2Fbar&tests=src%2Fbar%2Fbar&tests=src%2Fbar%2Fbar%2Fbar.cpp&tests=src%2Fbar%2Fbar%2Fbar.hpp
 //
-bool Files::forEachGlobMatch(const std::string& inPattern, const GlobMatch inSettings, const GlobCallback& onFound)
+bool Files::forEachGlobMatch(const std::string& inPattern, const GlobMatch inSettings, const GlobCallback& onFound, GlobCache* inCache, const ExcludeMatcher* inExcludes)
 {
 	if (onFound == nullptr)
 		return false;
@@ -783,145 +824,59 @@ bool Files::forEachGlobMatch(const std::string& inPattern, const GlobMatch inSet
 	if (!Files::pathIsDirectory(basePath))
 		return false;
 
-	size_t start = 0;
-	std::string pattern;
-	for (size_t i = 0; i < inPattern.size(); ++i)
-	{
-		switch (inPattern[i])
-		{
-			case '(':
-			case ')':
-				pattern += '\\';
-				break;
-			case '{': {
-				if (start == 0)
-				{
-					start = pattern.size();
-				}
-				break;
-			}
-			default: break;
-		}
-
-		pattern += inPattern[i];
-	}
-
-	while (start != std::string::npos)
-	{
-		auto prefix = pattern.substr(0, start);
-		start += 1;
-		auto end = pattern.find('}', start);
-		if (end != std::string::npos)
-		{
-			auto suffix = pattern.substr(end + 1);
-			auto arr = pattern.substr(start, end - start);
-
-			String::replaceAll(arr, ',', '|');
-			pattern = fmt::format("{}({}){}", prefix, arr, suffix);
-		}
-		start = pattern.find('{', start);
-	}
-
+	// The pattern is matched from the base folder, so only the folders it can reach are walked
+	std::string pattern = inPattern;
 	Path::toUnix(pattern);
+#if defined(CHALET_WIN32)
+	Path::toUnix(basePath);
+#endif
+	if (String::startsWith(basePath + '/', pattern))
+		pattern = pattern.substr(basePath.size() + 1);
+	else if (inSettings != GlobMatch::FilesAndFoldersExact && pattern.find('/') == std::string::npos)
+		pattern = "**/" + pattern; // without a folder, it matches at any depth of the working directory
 
-	std::string patternSwap = std::move(pattern);
-	pattern.clear();
-	bool containsWildCard = false;
-	for (size_t i = 0; i < patternSwap.size(); ++i)
-	{
-		switch (patternSwap[i])
-		{
-			case '{':
-			case '}':
-			case '[':
-			case ']':
-			case '.':
-			case '+':
-				pattern += '\\';
-				break;
-			case '?':
-				pattern += '.';
-				continue;
-			case '*':
-				containsWildCard = true;
-				break;
-			default: break;
-		}
+	GlobPattern glob(pattern);
+	if (glob.empty())
+		return false;
 
-		pattern += patternSwap[i];
-	}
-	if (containsWildCard)
+	GlobWalker walker(glob, inSettings, inExcludes);
+	StringList matches;
+	if (inCache != nullptr)
 	{
-		String::replaceAll(pattern, "**/*", "(.+)");
-		String::replaceAll(pattern, "**", "(.+)");
-		String::replaceAll(pattern, '*', R"regex((((?!\/).)*))regex");
+		// Only the folders that changed since the last run are read again
+		matches = walker.walk(basePath, inCache->get(inPattern, inSettings));
+		if (walker.foldersRead() > 0)
+			inCache->set(inPattern, inSettings, std::move(walker.listings()));
+		else
+			inCache->keep(inPattern, inSettings);
 	}
-	String::replaceAll(pattern, "(.+)", "(.*)");
-
-	if (pattern.back() != '$')
-		pattern.push_back('$');
-
-	bool exactMatch = inSettings == GlobMatch::FilesAndFoldersExact;
-	if (exactMatch)
+	else
 	{
-		if (!String::startsWith(basePath, pattern))
-			pattern = basePath + '/' + pattern;
+		matches = walker.walk(basePath);
 	}
 
-	static auto matchIsValid = [](const fs::directory_entry& path, const GlobMatch& settings) -> bool {
-		bool isDirectory = path.is_directory();
-		if (settings == GlobMatch::Files && isDirectory)
-			return false;
-
-		bool isRegularFile = path.is_regular_file();
-		if (settings == GlobMatch::Folders && isRegularFile)
-			return false;
-
-		return isRegularFile || isDirectory;
+	// Matches are sorted, so a folder comes before its contents - if onFound removed it, they're skipped
+	std::unordered_set<std::string> removedPaths;
+	auto parentWasRemoved = [&removedPaths](const std::string& inPath) {
+		for (auto slash = inPath.find('/'); slash != std::string::npos; slash = inPath.find('/', slash + 1))
+		{
+			if (removedPaths.find(inPath.substr(0, slash)) != removedPaths.end())
+				return true;
+		}
+		return false;
 	};
 
-	constexpr auto reOptions = std::regex_constants::match_default;
-	std::regex re(pattern);
-
-	fs::recursive_directory_iterator it(basePath);
-	fs::recursive_directory_iterator itEnd;
-
 	bool found = false;
-	while (it != itEnd)
+	for (auto& match : matches)
 	{
-		if (matchIsValid(*it, inSettings))
-		{
-			auto p = it->path().string();
-#if defined(CHALET_WIN32)
-			Path::toUnix(p);
-#endif
-			if (exactMatch)
-			{
-				if (std::regex_match(p.begin(), p.end(), re, reOptions))
-				{
-					onFound(p);
-					found = true;
-				}
-			}
-			else
-			{
-				if (std::regex_search(p.begin(), p.end(), re, reOptions))
-				{
-					onFound(p);
-					found = true;
-				}
-			}
+		if (!removedPaths.empty() && parentWasRemoved(match))
+			continue;
 
-			// if the path was removed during onFound
-			if (!Files::pathExists(p))
-			{
-				it = fs::recursive_directory_iterator(basePath);
-			}
-			else
-				it++;
-		}
-		else
-			it++;
+		onFound(match);
+		found = true;
+
+		if (inSettings != GlobMatch::Files && !Files::pathExists(match))
+			removedPaths.emplace(match);
 	}
 
 	return found;
@@ -958,13 +913,15 @@ bool Files::forEachGlobMatch(const std::string& inPath, const StringList& inPatt
 }
 
 /*****************************************************************************/
-bool Files::addPathToListWithGlob(const std::string& inValue, StringList& outList, const GlobMatch inSettings)
+bool Files::addPathToListWithGlob(const std::string& inValue, StringList& outList, const GlobMatch inSettings, GlobCache* inCache, const ExcludeMatcher* inExcludes)
 {
 	if (inValue.find_first_of("*{") != std::string::npos && inValue != "*")
 	{
-		if (!Files::forEachGlobMatch(inValue, inSettings, [&outList](const std::string& inPath) {
-				outList.emplace_back(inPath);
-			}))
+		if (!Files::forEachGlobMatch(
+				inValue, inSettings, [&outList](const std::string& inPath) {
+					outList.emplace_back(inPath);
+				},
+				inCache, inExcludes))
 			return false;
 
 		List::removeDuplicates(outList);
@@ -1086,6 +1043,28 @@ bool Files::createFileWithContents(const std::string& inFile, const std::string&
 	return true;
 }
 
+/*****************************************************************************/
+// Generated build inputs go through here, so their timestamps (and anything depending on them)
+//   only change when the contents actually do
+//
+bool Files::createFileWithContentsIfChanged(const std::string& inFile, const std::string& inContents, const bool inUnixEol)
+{
+	if (Files::pathExists(inFile))
+	{
+		auto existingContents = Files::getFileContents(inFile);
+		if (!existingContents.empty() && existingContents.back() == '\n')
+			existingContents.pop_back(); // last '\n'
+
+		if (!existingContents.empty() && existingContents.back() == '\r')
+			existingContents.pop_back(); // last '\r'
+
+		if (existingContents.size() == inContents.size() && String::equals(inContents, existingContents))
+			return true;
+	}
+
+	return Files::createFileWithContents(inFile, inContents, inUnixEol);
+}
+
 /*****************************************************************************/
 std::string Files::getFileContents(const std::string& inFile)
 {
@@ -1143,6 +1122,9 @@ std::string Files::isolateVersion(const std::string& outString)
 }
 
 /*****************************************************************************/
+// Executables named without a folder are looked up in the executable cache first - anything else
+//   depends on the working directory. Searches that found nothing are cached as well
+//
 std::string Files::which(const std::string& inExecutable, const bool inOutput)
 {
 	if (inExecutable.empty())
@@ -1151,87 +1133,31 @@ std::string Files::which(const std::string& inExecutable, const bool inOutput)
 	if (inOutput && Output::showCommands())
 		Output::printCommand(fmt::format("executable search: {}", inExecutable));
 
-	std::string result;
-#if defined(CHALET_WIN32)
-	PCHAR lpFilePart = NULL;
-	char filename[MAX_PATH];
-
-	auto exe = Files::getPlatformExecutableExtension();
-	if (String::contains('.', inExecutable))
+	std::string searchPath;
+	if (inExecutable.find_first_of("/\\") == std::string::npos)
 	{
-		auto pos = inExecutable.find_last_of('.');
-		exe = inExecutable.substr(pos);
-	}
-
-	if (SearchPathA(NULL, inExecutable.c_str(), exe.c_str(), MAX_PATH, filename, &lpFilePart) > 0)
-	{
-		result = std::string(filename);
-		Path::toUnix(result);
-	}
+#if defined(CHALET_WIN32)
+		// SearchPathA looks in the working directory before PATH
+		searchPath = fmt::format("{};{}", Files::getWorkingDirectory(), Environment::getPath());
+#elif defined(CHALET_MACOS)
+		// Anything found in /usr/bin is swapped for the one in the active developer directory, so the
+		//   results also depend on it (as a folder, its last write time is checked like the others)
+		if (!Files::pathExists(inExecutable))
+			searchPath = fmt::format("{}:{}", Environment::getPath(), getActiveDeveloperDirectory());
 #else
-	static auto pathIsValid = [](const bool hasExtension, const std::string& p) -> bool {
-		if (!Files::pathExists(p))
-			return false;
-
-		return (hasExtension && Files::pathIsDirectory(p)) || (!hasExtension && !Files::pathIsDirectory(p));
-	};
-
-	const bool hasExtension = inExecutable.find_last_of('.') != std::string::npos;
-	if (!Files::pathExists(inExecutable)) // checks working dir
-	{
-		auto path = Environment::getPath();
-		auto home = Environment::getUserDirectory();
-		size_t start = 0;
-		while (start != std::string::npos)
-		{
-			auto end = path.find(':', start);
-			auto tmp = path.substr(start, end - start);
-			while (tmp.back() == '/')
-				tmp.pop_back();
-
-			if (String::startsWith("~/", tmp))
-			{
-				tmp = fmt::format("{}/{}", home, tmp.substr(2));
-			}
-
-			result = fmt::format("{}/{}", tmp, inExecutable);
-
-			if (pathIsValid(hasExtension, result))
-				break;
-
-			result.clear();
-			start = end;
-			if (start != std::string::npos)
-				++start;
-		}
+		if (!Files::pathExists(inExecutable))
+			searchPath = Environment::getPath();
+#endif
 	}
 
-	// Note: cli "which" (original method) has issues when PATH is changed inside chalet
-	//   doesn't seem to inherit the env
-
-	if (result.empty())
+	std::string result;
+	if (!searchPath.empty() && ExecutableCache::find(searchPath, inExecutable, result))
 		return result;
 
-	#if defined(CHALET_MACOS)
-	if (String::startsWith("/usr/bin/", result))
-	{
-		auto& xcodePath = getXcodePath();
-		std::string withXcodePath = xcodePath + result;
-		if (pathIsValid(hasExtension, withXcodePath))
-		{
-			result = std::move(withXcodePath);
-		}
-		else
-		{
-			withXcodePath = fmt::format("{}/Toolchains/XcodeDefault.xctoolchain{}", xcodePath, result);
-			if (pathIsValid(hasExtension, withXcodePath))
-			{
-				result = std::move(withXcodePath);
-			}
-		}
-	}
-	#endif
-#endif
+	result = searchForExecutable(inExecutable);
+
+	if (!searchPath.empty())
+		ExecutableCache::add(searchPath, inExecutable, result);
 
 	return result;
 }
@@ -9,6 +9,9 @@
 
 namespace chalet
 {
+class ExcludeMatcher;
+class GlobCache;
+
 namespace Files
 {
 using GlobCallback = std::function<void(const std::string&)>;
@@ -50,12 +53,12 @@ bool copyIfDoesNotExistWithoutPrintingWorkingDirectory(const std::string& inFrom
 bool moveSilent(const std::string& inFrom, const std::string& inTo, const fs::copy_options inOptions = fs::copy_options::overwrite_existing);
 bool rename(const std::string& inFrom, const std::string& inTo, const bool inSkipNonExisting = false);
 
-bool forEachGlobMatch(const std::string& inPattern, const GlobMatch inSettings, const GlobCallback& onFound);
+bool forEachGlobMatch(const std::string& inPattern, const GlobMatch inSettings, const GlobCallback& onFound, GlobCache* inCache = nullptr, const ExcludeMatcher* inExcludes = nullptr);
 bool forEachGlobMatch(const StringList& inPatterns, const GlobMatch inSettings, const GlobCallback& onFound);
 bool forEachGlobMatch(const std::string& inPath, const std::string& inPattern, const GlobMatch inSettings, const GlobCallback& onFound);
 bool forEachGlobMatch(const std::string& inPath, const StringList& inPatterns, const GlobMatch inSettings, const GlobCallback& onFound);
 
-bool addPathToListWithGlob(const std::string& inValue, StringList& outList, const GlobMatch inSettings);
+bool addPathToListWithGlob(const std::string& inValue, StringList& outList, const GlobMatch inSettings, GlobCache* inCache = nullptr, const ExcludeMatcher* inExcludes = nullptr);
 bool addPathToMapWithGlob(const std::string& inValue, std::string&& inMapping, std::map<std::string, std::string>& outMap, const GlobMatch inSettings);
 
 bool readAndReplace(const std::string& inFile, const std::function<void(std::string&)>& onReplace);
@@ -69,6 +72,7 @@ bool pathIsEmpty(const std::string& inPath, const std::vector<fs::path>& inExcep
 std::ofstream ofstream(const std::string& inFile, std::ios_base::openmode inMode = std::ios::out);
 std::ifstream ifstream(const std::string& inFile, std::ios_base::openmode inMode = std::ios::in);
 bool createFileWithContents(const std::string& inFile, const std::string& inContents, const bool inUnixEol = false);
+bool createFileWithContentsIfChanged(const std::string& inFile, const std::string& inContents, const bool inUnixEol = false);
 std::string getFileContents(const std::string& inFile);
 
 std::string getFirstChildDirectory(const std::string& inPath);
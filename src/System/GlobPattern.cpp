@@ -0,0 +1,323 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "System/GlobPattern.hpp"
+
+#include "Utility/List.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+/*****************************************************************************/
+// {a,b} alternatives can also contain folders (ie. {src,include}/**.h), so they're expanded up front
+//
+void expandBraces(const std::string& inPattern, StringList& outList)
+{
+	auto open = inPattern.find('{');
+	if (open != std::string::npos)
+	{
+		size_t depth = 0;
+		size_t last = open + 1;
+		StringList options;
+		for (size_t i = open; i < inPattern.size(); ++i)
+		{
+			char c = inPattern[i];
+			if (c == '{')
+			{
+				++depth;
+			}
+			else if (c == ',' && depth == 1)
+			{
+				options.emplace_back(inPattern.substr(last, i - last));
+				last = i + 1;
+			}
+			else if (c == '}' && --depth == 0)
+			{
+				options.emplace_back(inPattern.substr(last, i - last));
+
+				auto prefix = inPattern.substr(0, open);
+				auto suffix = inPattern.substr(i + 1);
+				for (auto& option : options)
+					expandBraces(fmt::format("{}{}{}", prefix, option, suffix), outList);
+
+				return;
+			}
+		}
+	}
+
+	// No braces (or an unclosed one, which is just part of the name)
+	List::addIfDoesNotExist(outList, inPattern);
+}
+
+/*****************************************************************************/
+// "**" inside of a name (ie. src/**.cpp) matches across folders, so "a**b" is either "a*b",
+//   or "a*" followed by any number of folders, and then "*b"
+//
+void expandAnyFolders(const StringList& inParts, std::vector<StringList>& outList)
+{
+	for (size_t i = 0; i < inParts.size(); ++i)
+	{
+		const auto& part = inParts[i];
+		auto pos = part.find("**");
+		if (pos == std::string::npos || part == "**")
+			continue;
+
+		auto before = part.substr(0, pos);
+		auto after = part.substr(pos + 2);
+
+		StringList single = inParts;
+		single[i] = fmt::format("{}*{}", before, after);
+		expandAnyFolders(single, outList);
+
+		StringList multiple(inParts.begin(), inParts.begin() + i);
+		if (!before.empty())
+			multiple.emplace_back(fmt::format("{}*", before));
+
+		multiple.emplace_back("**");
+		if (!after.empty())
+			multiple.emplace_back(fmt::format("*{}", after));
+
+		multiple.insert(multiple.end(), inParts.begin() + i + 1, inParts.end());
+		expandAnyFolders(multiple, outList);
+		return;
+	}
+
+	// Consecutive "**" folders match the same thing as one
+	StringList parts;
+	for (auto& part : inParts)
+	{
+		if (part == "**" && !parts.empty() && parts.back() == "**")
+			continue;
+
+		parts.push_back(part);
+	}
+
+	if (!List::contains(outList, parts))
+		outList.emplace_back(std::move(parts));
+}
+}
+
+/*****************************************************************************/
+GlobPattern::GlobPattern(const std::string& inPattern) :
+	GlobPattern(StringList{ inPattern })
+{
+}
+
+/*****************************************************************************/
+GlobPattern::GlobPattern(const StringList& inPatterns)
+{
+	StringList patterns;
+	for (auto& pattern : inPatterns)
+		expandBraces(pattern, patterns);
+
+	std::vector<StringList> alternatives;
+	for (auto& pattern : patterns)
+	{
+		StringList parts;
+		for (auto& part : String::split(pattern, '/'))
+		{
+			if (!part.empty() && part != ".")
+				parts.emplace_back(std::move(part));
+		}
+
+		if (parts.empty())
+			continue;
+
+		expandAnyFolders(parts, alternatives);
+	}
+
+	for (auto& alternative : alternatives)
+		addAlternative(alternative);
+}
+
+/*****************************************************************************/
+bool GlobPattern::empty() const noexcept
+{
+	return m_starts.empty();
+}
+
+/*****************************************************************************/
+GlobPattern::State GlobPattern::initialState() const
+{
+	State ret;
+	for (auto start : m_starts)
+		addState(ret, start);
+
+	return ret;
+}
+
+/*****************************************************************************/
+void GlobPattern::advance(const State& inState, const std::string_view inName, State& outState) const
+{
+	outState.clear();
+
+	for (auto index : inState)
+	{
+		const auto& segment = m_segments[index];
+		switch (segment.type)
+		{
+			case SegmentType::Literal:
+				if (inName == segment.text)
+					addState(outState, index + 1);
+				break;
+
+			case SegmentType::Wildcard:
+				if (matchWildcard(segment.text, inName))
+					addState(outState, index + 1);
+				break;
+
+			case SegmentType::AnyFolders:
+				addState(outState, index);
+				break;
+
+			case SegmentType::Accept:
+			default:
+				break;
+		}
+	}
+}
+
+/*****************************************************************************/
+bool GlobPattern::isMatch(const State& inState) const
+{
+	for (auto index : inState)
+	{
+		if (m_segments[index].type == SegmentType::Accept)
+			return true;
+	}
+
+	return false;
+}
+
+/*****************************************************************************/
+// False once every alternative has either matched or failed - nothing below this folder can match
+//
+bool GlobPattern::canDescend(const State& inState) const
+{
+	for (auto index : inState)
+	{
+		if (m_segments[index].type != SegmentType::Accept)
+			return true;
+	}
+
+	return false;
+}
+
+/*****************************************************************************/
+bool GlobPattern::hasLiteral(const std::string_view inName) const
+{
+	for (auto& segment : m_segments)
+	{
+		if (segment.type == SegmentType::Literal && inName == segment.text)
+			return true;
+	}
+
+	return false;
+}
+
+/*****************************************************************************/
+bool GlobPattern::matches(const std::string& inRelativePath) const
+{
+	State state = initialState();
+	State next;
+
+	size_t start = 0;
+	while (start <= inRelativePath.size() && !state.empty())
+	{
+		auto end = inRelativePath.find('/', start);
+		if (end == std::string::npos)
+			end = inRelativePath.size();
+
+		if (end > start)
+		{
+			advance(state, std::string_view(inRelativePath).substr(start, end - start), next);
+			std::swap(state, next);
+		}
+
+		start = end + 1;
+	}
+
+	return isMatch(state);
+}
+
+/*****************************************************************************/
+// * matches any run of characters, ? matches exactly one - backtracks to the last * on a mismatch
+//
+bool GlobPattern::matchWildcard(const std::string_view inPattern, const std::string_view inName)
+{
+	size_t p = 0;
+	size_t n = 0;
+	size_t star = std::string_view::npos;
+	size_t starMatch = 0;
+
+	while (n < inName.size())
+	{
+		if (p < inPattern.size() && (inPattern[p] == '?' || inPattern[p] == inName[n]))
+		{
+			++p;
+			++n;
+		}
+		else if (p < inPattern.size() && inPattern[p] == '*')
+		{
+			star = p++;
+			starMatch = n;
+		}
+		else if (star != std::string_view::npos)
+		{
+			p = star + 1;
+			n = ++starMatch;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	while (p < inPattern.size() && inPattern[p] == '*')
+		++p;
+
+	return p == inPattern.size();
+}
+
+/*****************************************************************************/
+void GlobPattern::addAlternative(const StringList& inParts)
+{
+	m_starts.push_back(static_cast<u16>(m_segments.size()));
+
+	for (auto& part : inParts)
+	{
+		Segment segment;
+		segment.text = part;
+		if (part == "**")
+			segment.type = SegmentType::AnyFolders;
+		else if (part.find_first_of("*?") != std::string::npos)
+			segment.type = SegmentType::Wildcard;
+		else
+			segment.type = SegmentType::Literal;
+
+		m_segments.emplace_back(std::move(segment));
+	}
+
+	Segment accept;
+	accept.type = SegmentType::Accept;
+	m_segments.emplace_back(std::move(accept));
+}
+
+/*****************************************************************************/
+// "**" can also match no folders at all, so the segment after it is active at the same time
+//
+void GlobPattern::addState(State& outState, u16 inIndex) const
+{
+	if (List::contains(outState, inIndex))
+		return;
+
+	outState.push_back(inIndex);
+
+	if (m_segments[inIndex].type == SegmentType::AnyFolders)
+		addState(outState, inIndex + 1);
+}
+}
@@ -0,0 +1,58 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// A glob compiled into path segments, matched one directory entry at a time while walking
+//   Supports *, ?, ** (any number of folders) and {a,b} alternatives - everything else is literal
+//
+class GlobPattern
+{
+	enum class SegmentType : u8
+	{
+		Literal,
+		Wildcard,
+		AnyFolders,
+		Accept,
+	};
+
+	struct Segment
+	{
+		std::string text;
+		SegmentType type = SegmentType::Literal;
+	};
+
+public:
+	// Indices of the segments that the next path component is matched against
+	using State = std::vector<u16>;
+
+	GlobPattern() = default;
+	explicit GlobPattern(const std::string& inPattern);
+
+	// Any of the patterns, matched together in one walk
+	explicit GlobPattern(const StringList& inPatterns);
+
+	bool empty() const noexcept;
+
+	State initialState() const;
+	void advance(const State& inState, const std::string_view inName, State& outState) const;
+	bool isMatch(const State& inState) const;
+	bool canDescend(const State& inState) const;
+	bool hasLiteral(const std::string_view inName) const;
+
+	bool matches(const std::string& inRelativePath) const;
+
+	static bool matchWildcard(const std::string_view inPattern, const std::string_view inName);
+
+private:
+	void addAlternative(const StringList& inParts);
+	void addState(State& outState, u16 inIndex) const;
+
+	std::vector<Segment> m_segments;
+	std::vector<u16> m_starts;
+};
+}
@@ -0,0 +1,388 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "System/GlobWalker.hpp"
+
+#include <chrono>
+
+#if !defined(CHALET_WIN32)
+	#include <dirent.h>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#if defined(CHALET_LINUX)
+	#include <cstddef>
+	#include <sys/syscall.h>
+#endif
+
+namespace chalet
+{
+namespace
+{
+constexpr size_t kMaxThreads = 8;
+
+// Folders written to this recently aren't trusted by the next walk, since a second change within
+//   the file system's timestamp resolution wouldn't change their last write time
+constexpr i64 kRecentlyWritten = 2'000'000'000;
+
+#if defined(CHALET_LINUX)
+// The record getdents64 fills the buffer with (glibc doesn't declare it)
+struct LinuxDirent64
+{
+	u64 ino;
+	i64 off;
+	u16 reclen;
+	u8 type;
+	char name[1];
+};
+#endif
+
+/*****************************************************************************/
+// The same clock the file system stamps folders with
+//
+i64 getCurrentFolderTime()
+{
+#if defined(CHALET_WIN32)
+	auto now = fs::file_time_type::clock::now().time_since_epoch();
+#else
+	auto now = std::chrono::system_clock::now().time_since_epoch();
+#endif
+	return static_cast<i64>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+#if !defined(CHALET_WIN32)
+/*****************************************************************************/
+// Symbolic links are matched by what they point to, but never followed into (like fs::recursive_directory_iterator)
+//
+bool getEntryType(const i32 inFolder, const char* inName, u8 inType, bool& outFile, bool& outDirectory, bool& outCanDescend)
+{
+	struct stat statBuffer;
+	if (inType == DT_UNKNOWN)
+	{
+		if (::fstatat(inFolder, inName, &statBuffer, AT_SYMLINK_NOFOLLOW) != 0)
+			return false;
+
+		if (S_ISLNK(statBuffer.st_mode))
+			inType = DT_LNK;
+		else if (S_ISDIR(statBuffer.st_mode))
+			inType = DT_DIR;
+		else if (S_ISREG(statBuffer.st_mode))
+			inType = DT_REG;
+	}
+
+	if (inType == DT_LNK)
+	{
+		if (::fstatat(inFolder, inName, &statBuffer, 0) != 0)
+			return false;
+
+		outFile = S_ISREG(statBuffer.st_mode);
+		outDirectory = S_ISDIR(statBuffer.st_mode);
+		outCanDescend = false;
+	}
+	else
+	{
+		outFile = inType == DT_REG;
+		outDirectory = inType == DT_DIR;
+		outCanDescend = outDirectory;
+	}
+
+	return true;
+}
+#endif
+}
+
+/*****************************************************************************/
+GlobWalker::GlobWalker(const GlobPattern& inPattern, const GlobMatch inSettings, const ExcludeMatcher* inExcludes) :
+	m_pattern(inPattern),
+	m_settings(inSettings)
+{
+	if (inExcludes != nullptr && !inExcludes->empty())
+		m_excludes = inExcludes;
+}
+
+/*****************************************************************************/
+StringList GlobWalker::walk(const std::string& inRoot, const Listings* inPrevious)
+{
+	std::string root = inRoot;
+	while (root.size() > 1 && root.back() == '/')
+		root.pop_back();
+
+	m_previous = inPrevious;
+	m_walkStart = getCurrentFolderTime();
+	m_foldersRead = 0;
+	m_matches.clear();
+	m_listings.clear();
+	m_queue.clear();
+
+	ExcludeMatcher::State excludes;
+	if (m_excludes != nullptr && m_excludes->isExcluded(root, excludes))
+		return StringList();
+
+	m_queue.emplace_back(Folder{ std::move(root), m_pattern.initialState(), std::move(excludes) });
+	m_pending = 1;
+	m_maxThreads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxThreads);
+
+	// The calling thread always takes part - more are only started once there's enough to do
+	worker();
+
+	for (auto& thread : m_threads)
+		thread.join();
+
+	m_threads.clear();
+
+	std::sort(m_matches.begin(), m_matches.end());
+	return std::move(m_matches);
+}
+
+/*****************************************************************************/
+GlobWalker::Listings& GlobWalker::listings() noexcept
+{
+	return m_listings;
+}
+
+/*****************************************************************************/
+size_t GlobWalker::foldersRead() const noexcept
+{
+	return m_foldersRead;
+}
+
+/*****************************************************************************/
+// Version control & package manager folders are never walked into, unless the pattern names them
+//
+bool GlobWalker::isSkippedFolder(const std::string_view inName)
+{
+	return inName == ".git"
+		|| inName == ".hg"
+		|| inName == ".svn"
+		|| inName == "node_modules";
+}
+
+/*****************************************************************************/
+i64 GlobWalker::getFolderLastWrite(const std::string& inPath)
+{
+#if defined(CHALET_WIN32)
+	std::error_code error;
+	auto lastWrite = fs::last_write_time(inPath, error);
+	if (error)
+		return -1;
+
+	return static_cast<i64>(std::chrono::duration_cast<std::chrono::nanoseconds>(lastWrite.time_since_epoch()).count());
+#else
+	struct stat statBuffer;
+	if (::stat(inPath.c_str(), &statBuffer) != 0)
+		return -1;
+
+	#if defined(CHALET_MACOS)
+	const auto& lastWrite = statBuffer.st_mtimespec;
+	#else
+	const auto& lastWrite = statBuffer.st_mtim;
+	#endif
+	return static_cast<i64>(lastWrite.tv_sec) * 1'000'000'000 + static_cast<i64>(lastWrite.tv_nsec);
+#endif
+}
+
+/*****************************************************************************/
+void GlobWalker::worker()
+{
+	StringList matches;
+	std::vector<Folder> folders;
+	Listings listings;
+	size_t foldersRead = 0;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_condition.wait(lock, [this]() {
+			return !m_queue.empty() || m_pending == 0;
+		});
+
+		if (m_queue.empty())
+			break;
+
+		Folder folder = std::move(m_queue.back());
+		m_queue.pop_back();
+		lock.unlock();
+
+		folders.clear();
+		if (readFolder(folder, matches, folders, listings))
+			++foldersRead;
+
+		lock.lock();
+		m_pending += folders.size();
+		m_pending--;
+
+		for (auto& next : folders)
+			m_queue.emplace_back(std::move(next));
+
+		if (m_queue.size() > 1 && m_threads.size() + 1 < m_maxThreads)
+			m_threads.emplace_back(&GlobWalker::worker, this);
+
+		if (m_pending == 0 || !folders.empty())
+			m_condition.notify_all();
+	}
+
+	m_matches.insert(m_matches.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
+	m_listings.merge(listings);
+	m_foldersRead += foldersRead;
+}
+
+/*****************************************************************************/
+// Returns false if the folder's previous listing was used instead of reading it
+//
+bool GlobWalker::readFolder(const Folder& inFolder, StringList& outMatches, std::vector<Folder>& outFolders, Listings& outListings) const
+{
+	GlobPattern::State state;
+
+	auto& listing = outListings[inFolder.path];
+	listing.lastWrite = getFolderLastWrite(inFolder.path);
+	if (listing.lastWrite <= 0 || listing.lastWrite + kRecentlyWritten > m_walkStart)
+		listing.lastWrite = 0;
+
+	bool read = true;
+	if (m_previous != nullptr && listing.lastWrite != 0)
+	{
+		auto previous = m_previous->find(inFolder.path);
+		if (previous != m_previous->end() && previous->second.lastWrite == listing.lastWrite)
+		{
+			listing.matches = previous->second.matches;
+			listing.folders = previous->second.folders;
+			read = false;
+		}
+	}
+
+	if (read)
+	{
+		forEachEntry(inFolder.path, [&](const Entry& inEntry) {
+			m_pattern.advance(inFolder.state, inEntry.name, state);
+			if (state.empty())
+				return;
+
+			bool valid = false;
+			if (m_settings == GlobMatch::Files)
+				valid = inEntry.isFile;
+			else if (m_settings == GlobMatch::Folders)
+				valid = inEntry.isDirectory;
+			else
+				valid = inEntry.isFile || inEntry.isDirectory;
+
+			if (valid && m_pattern.isMatch(state))
+				listing.matches.emplace_back(inEntry.name);
+
+			if (inEntry.canDescend && m_pattern.canDescend(state))
+			{
+				if (isSkippedFolder(inEntry.name) && !m_pattern.hasLiteral(inEntry.name))
+					return;
+
+				listing.folders.emplace_back(inEntry.name);
+			}
+		});
+	}
+
+	// Excludes are applied after the listing, so it can be reused if they change
+	ExcludeMatcher::State excludes;
+	for (auto& name : listing.matches)
+	{
+		if (m_excludes != nullptr && m_excludes->advance(inFolder.excludes, name, excludes))
+			continue;
+
+		outMatches.emplace_back(fmt::format("{}/{}", inFolder.path, name));
+	}
+
+	for (auto& name : listing.folders)
+	{
+		if (m_excludes != nullptr && m_excludes->advance(inFolder.excludes, name, excludes))
+			continue;
+
+		m_pattern.advance(inFolder.state, name, state);
+		outFolders.emplace_back(Folder{ fmt::format("{}/{}", inFolder.path, name), state, excludes });
+	}
+
+	return read;
+}
+
+/*****************************************************************************/
+bool GlobWalker::forEachEntry(const std::string& inPath, const EntryCallback& onEntry)
+{
+#if defined(CHALET_WIN32)
+	std::error_code error;
+	fs::directory_iterator it(inPath, error);
+	if (error)
+		return false;
+
+	for (; it != fs::directory_iterator(); it.increment(error))
+	{
+		if (error)
+			return false;
+
+		auto name = it->path().filename().string();
+
+		Entry entry;
+		entry.name = name;
+		entry.isFile = it->is_regular_file(error);
+		entry.isDirectory = it->is_directory(error);
+		entry.canDescend = entry.isDirectory && !it->is_symlink(error);
+		onEntry(entry);
+	}
+
+	return true;
+#elif defined(CHALET_LINUX)
+	// getdents64 fills a buffer with many entries per call (and their type), instead of one at a time
+	i32 folder = ::open(inPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (folder < 0)
+		return false;
+
+	alignas(LinuxDirent64) char buffer[32 * 1024];
+	while (true)
+	{
+		auto bytes = ::syscall(SYS_getdents64, folder, buffer, sizeof(buffer));
+		if (bytes <= 0)
+			break;
+
+		for (i64 offset = 0; offset < bytes;)
+		{
+			auto record = reinterpret_cast<const LinuxDirent64*>(buffer + offset);
+			const char* name = buffer + offset + offsetof(LinuxDirent64, name);
+			offset += record->reclen;
+
+			Entry entry;
+			entry.name = name;
+			if (entry.name == "." || entry.name == "..")
+				continue;
+
+			if (!getEntryType(folder, name, record->type, entry.isFile, entry.isDirectory, entry.canDescend))
+				continue;
+
+			onEntry(entry);
+		}
+	}
+
+	::close(folder);
+	return true;
+#else
+	DIR* dir = ::opendir(inPath.c_str());
+	if (dir == nullptr)
+		return false;
+
+	i32 folder = ::dirfd(dir);
+	while (auto record = ::readdir(dir))
+	{
+		Entry entry;
+		entry.name = record->d_name;
+		if (entry.name == "." || entry.name == "..")
+			continue;
+
+		if (!getEntryType(folder, record->d_name, record->d_type, entry.isFile, entry.isDirectory, entry.canDescend))
+			continue;
+
+		onEntry(entry);
+	}
+
+	::closedir(dir);
+	return true;
+#endif
+}
+}
@@ -0,0 +1,86 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "System/ExcludeMatcher.hpp"
+#include "System/GlobPattern.hpp"
+#include "Utility/GlobMatch.hpp"
+
+namespace chalet
+{
+// Walks a folder for the entries matching a glob - folders the pattern can't reach (or that are excluded)
+//   are never entered, and once there's more than one folder waiting, they're read on multiple threads
+//
+class GlobWalker
+{
+public:
+	// What a folder contributed to the walk, before excludes - adding, removing or renaming an entry always
+	//   changes a folder's last write time, so until it does, the folder doesn't need to be read again
+	struct Listing
+	{
+		i64 lastWrite = 0; // nanoseconds, 0 if it was written too recently to trust
+		StringList matches;
+		StringList folders;
+	};
+	using Listings = std::unordered_map<std::string, Listing>;
+
+	GlobWalker(const GlobPattern& inPattern, const GlobMatch inSettings, const ExcludeMatcher* inExcludes = nullptr);
+
+	// Matches are inRoot/relative/path, sorted, so a folder always comes before its contents
+	//   With inPrevious, the folders that haven't changed since then are not read again
+	StringList walk(const std::string& inRoot, const Listings* inPrevious = nullptr);
+
+	Listings& listings() noexcept;
+	size_t foldersRead() const noexcept;
+
+	static bool isSkippedFolder(const std::string_view inName);
+	static i64 getFolderLastWrite(const std::string& inPath);
+
+private:
+	struct Folder
+	{
+		std::string path;
+		GlobPattern::State state;
+		ExcludeMatcher::State excludes;
+	};
+
+	struct Entry
+	{
+		std::string_view name;
+		bool isFile = false;
+		bool isDirectory = false;
+		bool canDescend = false;
+	};
+
+	using EntryCallback = std::function<void(const Entry&)>;
+
+	void worker();
+	bool readFolder(const Folder& inFolder, StringList& outMatches, std::vector<Folder>& outFolders, Listings& outListings) const;
+	static bool forEachEntry(const std::string& inPath, const EntryCallback& onEntry);
+
+	const GlobPattern& m_pattern;
+	const ExcludeMatcher* m_excludes = nullptr;
+	const Listings* m_previous = nullptr;
+
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::vector<std::thread> m_threads;
+	std::vector<Folder> m_queue;
+	StringList m_matches;
+	Listings m_listings;
+
+	i64 m_walkStart = 0;
+	size_t m_pending = 0;
+	size_t m_maxThreads = 1;
+	size_t m_foldersRead = 0;
+
+	GlobMatch m_settings;
+};
+}
@@ -0,0 +1,323 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "System/Trash.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if !defined(CHALET_WIN32)
+	#include <dirent.h>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#include "System/Files.hpp"
+#include "Terminal/Output.hpp"
+#include "Utility/List.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+namespace
+{
+constexpr size_t kMaxThreads = 4;
+
+struct TrashState
+{
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::vector<std::thread> threads;
+	StringList trashFolders;
+	StringList queue;
+	StringList folders;
+	StringList failures;
+	Dictionary<std::string> removed; // what's in the trash -> where it was
+	size_t pending = 0;
+	size_t counter = 0;
+	bool closing = false;
+	std::atomic<bool> stopped{ false };
+
+	~TrashState();
+} state;
+
+/*****************************************************************************/
+// Deletes the files in a folder, and collects the folders in it for another thread to pick up, and
+//   anything that couldn't be deleted
+//
+void removeContents(const std::string& inFolder, StringList& outFolders, StringList& outFailures)
+{
+#if defined(CHALET_WIN32)
+	std::error_code error;
+	fs::directory_iterator it(inFolder, error);
+	if (error)
+	{
+		outFailures.emplace_back(inFolder);
+		return;
+	}
+
+	for (; it != fs::directory_iterator(); it.increment(error))
+	{
+		if (error)
+		{
+			outFailures.emplace_back(inFolder);
+			return;
+		}
+
+		if (state.stopped)
+			return;
+
+		if (it->is_directory(error) && !it->is_symlink(error))
+			outFolders.emplace_back(it->path().string());
+		else if (!fs::remove(it->path(), error) && error)
+			outFailures.emplace_back(it->path().string());
+	}
+#else
+	i32 folder = ::open(inFolder.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (folder < 0)
+	{
+		outFailures.emplace_back(inFolder);
+		return;
+	}
+
+	DIR* dir = ::fdopendir(folder);
+	if (dir == nullptr)
+	{
+		::close(folder);
+		outFailures.emplace_back(inFolder);
+		return;
+	}
+
+	while (auto record = ::readdir(dir))
+	{
+		if (state.stopped)
+			break;
+
+		std::string_view name(record->d_name);
+		if (name == "." || name == "..")
+			continue;
+
+		// Symbolic links are removed, never followed
+		bool isDirectory = record->d_type == DT_DIR;
+		if (record->d_type == DT_UNKNOWN)
+		{
+			struct stat statBuffer;
+			isDirectory = ::fstatat(folder, record->d_name, &statBuffer, AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(statBuffer.st_mode);
+		}
+
+		if (isDirectory)
+			outFolders.emplace_back(fmt::format("{}/{}", inFolder, name));
+		else if (::unlinkat(folder, record->d_name, 0) != 0 && errno != ENOENT)
+			outFailures.emplace_back(fmt::format("{}/{}", inFolder, name));
+	}
+
+	::closedir(dir);
+#endif
+}
+
+/*****************************************************************************/
+// A folder is always queued after the one it's in, so once nothing is pending, removing them
+//   in reverse only ever removes empty ones
+//
+void worker()
+{
+	StringList folders;
+	StringList failures;
+
+	std::unique_lock<std::mutex> lock(state.mutex);
+	while (true)
+	{
+		state.condition.wait(lock, []() {
+			return !state.queue.empty() || (state.closing && state.pending == 0);
+		});
+
+		if (state.queue.empty())
+			break;
+
+		auto folder = std::move(state.queue.back());
+		state.queue.pop_back();
+		state.folders.push_back(folder);
+		lock.unlock();
+
+		folders.clear();
+		failures.clear();
+		if (!state.stopped)
+			removeContents(folder, folders, failures);
+
+		lock.lock();
+		state.pending += folders.size();
+		state.pending--;
+
+		for (auto& failure : failures)
+			state.failures.emplace_back(std::move(failure));
+
+		for (auto& next : folders)
+			state.queue.emplace_back(std::move(next));
+
+		if (state.pending == 0)
+		{
+			StringList emptyFolders = std::move(state.folders);
+			state.folders.clear();
+			lock.unlock();
+
+			// A folder that isn't empty because something in it couldn't be deleted is already a failure
+			std::error_code error;
+			for (auto it = emptyFolders.rbegin(); it != emptyFolders.rend(); ++it)
+				fs::remove(*it, error);
+
+			lock.lock();
+			state.condition.notify_all();
+		}
+		else if (!folders.empty())
+		{
+			state.condition.notify_all();
+		}
+	}
+}
+
+/*****************************************************************************/
+// Expects the lock to be held
+//
+void addToQueue(std::string&& inPath)
+{
+	state.queue.emplace_back(std::move(inPath));
+	state.pending++;
+
+	auto maxThreads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxThreads);
+	if (state.threads.size() < maxThreads)
+		state.threads.emplace_back(worker);
+
+	state.condition.notify_one();
+}
+
+/*****************************************************************************/
+// Expects the lock to be held
+//
+void reapTrashFolder(const std::string& inTrashFolder)
+{
+	if (List::contains(state.trashFolders, inTrashFolder))
+		return;
+
+	state.trashFolders.push_back(inTrashFolder);
+
+	std::error_code error;
+	fs::directory_iterator it(inTrashFolder, error);
+	if (error)
+		return;
+
+	for (; it != fs::directory_iterator(); it.increment(error))
+	{
+		if (error)
+			break;
+
+		addToQueue(it->path().string());
+	}
+}
+
+/*****************************************************************************/
+// Expects the lock to not be held
+//
+void joinThreads()
+{
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		state.closing = true;
+	}
+	state.condition.notify_all();
+
+	for (auto& thread : state.threads)
+		thread.join();
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.threads.clear();
+	state.closing = false;
+}
+
+/*****************************************************************************/
+// On exit, the rest is left in the trash for the next run
+//
+TrashState::~TrashState()
+{
+	stopped = true;
+	joinThreads();
+}
+}
+
+/*****************************************************************************/
+bool Trash::remove(const std::string& inPath, const std::string& inTrashFolder)
+{
+	std::string destination;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		reapTrashFolder(inTrashFolder);
+
+		auto now = std::chrono::system_clock::now().time_since_epoch();
+		auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+		destination = fmt::format("{}/{}.{}", inTrashFolder, nanoseconds, state.counter++);
+	}
+
+	std::error_code error;
+	fs::create_directories(inTrashFolder, error);
+	fs::rename(inPath, destination, error);
+	if (error)
+		return Files::removeRecursively(inPath);
+
+	if (Output::showCommands())
+		Output::printCommand(fmt::format("remove recursively: {}", inPath));
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+	state.removed.emplace(destination, inPath);
+	addToQueue(std::move(destination));
+	return true;
+}
+
+/*****************************************************************************/
+void Trash::reap(const std::string& inTrashFolder)
+{
+	std::lock_guard<std::mutex> lock(state.mutex);
+	reapTrashFolder(inTrashFolder);
+}
+
+/*****************************************************************************/
+// Whatever couldn't be deleted stays in the trash for the next run to try again. Only the paths removed
+//   since the last wait are reported - not the leftovers from an interrupted run
+//
+bool Trash::wait()
+{
+	joinThreads();
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+	for (auto& folder : state.trashFolders)
+	{
+		std::error_code error;
+		fs::remove(folder, error);
+	}
+
+	bool result = true;
+	for (auto& [destination, path] : state.removed)
+	{
+		auto prefix = fmt::format("{}/", destination);
+		auto failure = std::find_if(state.failures.begin(), state.failures.end(), [&destination, &prefix](const std::string& inFailure) {
+			return inFailure == destination || String::startsWith(prefix, inFailure);
+		});
+
+		if (failure != state.failures.end())
+		{
+			Diagnostic::error("Could not delete '{}' while removing: {}", *failure, path);
+			result = false;
+		}
+	}
+
+	state.failures.clear();
+	state.removed.clear();
+
+	return result;
+}
+}
@@ -0,0 +1,24 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// Folders are removed by renaming them into a trash folder (which is instant), and then deleting them on
+//   background threads, so a rebuild can start right away. Whatever an interrupted run left in the trash
+//   is deleted the next time the same trash folder is used
+//
+namespace Trash
+{
+// Same result as Files::removeRecursively - falls back to it if inPath can't be moved
+bool remove(const std::string& inPath, const std::string& inTrashFolder);
+
+void reap(const std::string& inTrashFolder);
+
+// false if anything removed since the last wait couldn't be deleted
+bool wait();
+}
+}
@@ -0,0 +1,239 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Utility/EventStream.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include "Libraries/Json.hpp"
+#include "Utility/Trace.hpp"
+
+namespace chalet
+{
+namespace
+{
+// A multi-producer, single-consumer queue (Dmitry Vyukov's intrusive design)
+//   Pushing is a single atomic exchange, so producers never block each other
+//
+struct EventNode
+{
+	std::atomic<EventNode*> next = nullptr;
+	EventStream::Event event;
+};
+
+struct EventState
+{
+	std::atomic<EventNode*> head = nullptr;
+	EventNode* tail = nullptr; // only touched by the writer thread
+
+	std::FILE* file = nullptr;
+	std::thread writer;
+	std::atomic<bool> stopping = false;
+	std::atomic<bool> enabled = false;
+
+	~EventState();
+} state;
+
+/*****************************************************************************/
+void push(EventNode* inNode)
+{
+	EventNode* previous = state.head.exchange(inNode, std::memory_order_acq_rel);
+	previous->next.store(inNode, std::memory_order_release);
+}
+
+/*****************************************************************************/
+// The tail is always a node whose event was already written (it starts as an empty one),
+//   so the next node's event is moved out, and it becomes the new tail
+//
+bool pop(EventStream::Event& outEvent)
+{
+	EventNode* tail = state.tail;
+	EventNode* next = tail->next.load(std::memory_order_acquire);
+	if (next == nullptr)
+		return false;
+
+	outEvent = std::move(next->event);
+	state.tail = next;
+	delete tail;
+	return true;
+}
+
+/*****************************************************************************/
+// Compiler diagnostics are usually colored - the codes are meaningless in a file
+//
+std::string stripAnsiCodes(const std::string& inText)
+{
+	if (inText.find('\x1b') == std::string::npos)
+		return inText;
+
+	std::string ret;
+	ret.reserve(inText.size());
+
+	for (size_t i = 0; i < inText.size(); ++i)
+	{
+		if (inText[i] == '\x1b' && i + 1 < inText.size() && inText[i + 1] == '[')
+		{
+			i += 2;
+			while (i < inText.size() && (inText[i] < '@' || inText[i] > '~'))
+				++i;
+
+			continue;
+		}
+
+		ret += inText[i];
+	}
+
+	return ret;
+}
+
+/*****************************************************************************/
+bool drain()
+{
+	bool wrote = false;
+
+	EventStream::Event event;
+	while (pop(event))
+	{
+		auto line = EventStream::getLine(event);
+		std::fwrite(line.data(), 1, line.size(), state.file);
+		wrote = true;
+	}
+
+	if (wrote)
+		std::fflush(state.file);
+
+	return wrote;
+}
+
+/*****************************************************************************/
+void writerThread()
+{
+	// Polls instead of waiting on a condition variable, so that emit never takes a lock
+	//   The wait grows while the queue stays empty, and resets as soon as something arrives
+	//
+	constexpr i32 kMaxWait = 8;
+	i32 wait = 1;
+	while (!state.stopping.load(std::memory_order_acquire))
+	{
+		if (drain())
+		{
+			wait = 1;
+			continue;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(wait));
+		wait = std::min(wait * 2, kMaxWait);
+	}
+
+	drain();
+}
+
+/*****************************************************************************/
+std::FILE* openDestination(const std::string& inDestination)
+{
+	bool isDescriptor = !inDestination.empty() && inDestination.find_first_not_of("0123456789") == std::string::npos;
+	if (isDescriptor)
+	{
+		i32 descriptor = ::atoi(inDestination.c_str());
+#if defined(CHALET_WIN32)
+		return _fdopen(descriptor, "wb");
+#else
+		return fdopen(descriptor, "wb");
+#endif
+	}
+
+	return std::fopen(inDestination.c_str(), "wb");
+}
+
+/*****************************************************************************/
+// Exiting early (ie. ctrl+c, or an error that exits right away) skips the close at the end of the run,
+//   so what's still queued is written here, and the writer thread is joined before it's destroyed
+//
+EventState::~EventState()
+{
+	EventStream::close();
+}
+}
+
+/*****************************************************************************/
+bool EventStream::open(const std::string& inDestination)
+{
+	if (state.enabled)
+		return false;
+
+	state.file = openDestination(inDestination);
+	if (state.file == nullptr)
+		return false;
+
+	auto stub = new EventNode();
+	state.head.store(stub, std::memory_order_relaxed);
+	state.tail = stub;
+	state.stopping = false;
+	state.writer = std::thread(writerThread);
+	state.enabled = true;
+
+	return true;
+}
+
+/*****************************************************************************/
+void EventStream::close()
+{
+	if (!state.enabled)
+		return;
+
+	state.enabled = false;
+	state.stopping.store(true, std::memory_order_release);
+	if (state.writer.joinable())
+		state.writer.join();
+
+	delete state.tail;
+	state.tail = nullptr;
+	state.head = nullptr;
+
+	std::fclose(state.file);
+	state.file = nullptr;
+}
+
+/*****************************************************************************/
+bool EventStream::enabled() noexcept
+{
+	return state.enabled;
+}
+
+/*****************************************************************************/
+void EventStream::emit(const char* inType, StringFields&& inStrings, NumberFields&& inNumbers)
+{
+	if (!state.enabled)
+		return;
+
+	auto node = new EventNode();
+	node->event.type = inType;
+	node->event.strings = std::move(inStrings);
+	node->event.numbers = std::move(inNumbers);
+	node->event.time = Trace::now();
+	push(node);
+}
+
+/*****************************************************************************/
+std::string EventStream::getLine(const Event& inEvent)
+{
+	Json json = Json::object();
+	json["event"] = inEvent.type;
+	json["time"] = inEvent.time;
+
+	for (auto& [key, value] : inEvent.numbers)
+		json[key] = value;
+
+	for (auto& [key, value] : inEvent.strings)
+		json[key] = stripAnsiCodes(value);
+
+	// Compiler output isn't guaranteed to be valid UTF-8
+	auto ret = json.dump(-1, ' ', false, Json::error_handler_t::replace);
+	ret += '\n';
+	return ret;
+}
+}
@@ -0,0 +1,36 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// Writes machine-readable build events as newline-delimited JSON (--events)
+//   Events are handed off to a writer thread through a lock-free queue, so emitting one
+//   from a command pool worker never waits on the file (or another worker)
+//
+namespace EventStream
+{
+using StringFields = std::vector<std::pair<const char*, std::string>>;
+using NumberFields = std::vector<std::pair<const char*, i64>>;
+
+struct Event
+{
+	const char* type = nullptr;
+	StringFields strings;
+	NumberFields numbers;
+	i64 time = 0; // microseconds since chalet started (see Trace::now)
+};
+
+// inDestination is a file path, or the number of a file descriptor that's already open
+bool open(const std::string& inDestination);
+void close();
+bool enabled() noexcept;
+
+void emit(const char* inType, StringFields&& inStrings = {}, NumberFields&& inNumbers = {});
+
+std::string getLine(const Event& inEvent);
+}
+}
@@ -26,13 +26,16 @@ bool List::addIfDoesNotExist(std::vector<std::string>& outList, const std::strin
 }
 
 /*****************************************************************************/
+// Keeps the first of each - glob expansions can have tens of thousands of paths, so seen values are hashed
+//
 void List::removeDuplicates(std::vector<std::string>& outList)
 {
-	auto end = outList.end();
-	for (auto it = outList.begin(); it != end; ++it)
-	{
-		end = std::remove(it + 1, end, *it);
-	}
+	std::unordered_set<std::string> seen;
+	seen.reserve(outList.size());
+
+	auto end = std::remove_if(outList.begin(), outList.end(), [&seen](const std::string& inValue) {
+		return !seen.insert(inValue).second;
+	});
 
 	outList.erase(end, outList.end());
 }
@@ -433,15 +433,19 @@ StringList String::filterIf(const StringList& inFind, const StringList& inList)
 }
 
 /*****************************************************************************/
+// inFind can be every file of the targets before this one, so it's hashed instead of searched for each item
+//
 StringList String::excludeIf(const StringList& inFind, const StringList& inList)
 {
+	std::unordered_set<std::string_view> find(inFind.begin(), inFind.end());
+
 	StringList ret;
 	for (auto& item : inList)
 	{
 		if (item.empty())
 			continue;
 
-		if (!List::contains(inFind, item))
+		if (find.find(item) == find.end())
 			ret.emplace_back(item);
 	}
 	return ret;
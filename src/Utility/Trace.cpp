@@ -0,0 +1,177 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#include "Utility/Trace.hpp"
+
+#include <atomic>
+#include <mutex>
+
+#include "Json/JsonFile.hpp"
+
+namespace chalet
+{
+namespace
+{
+struct
+{
+	std::mutex mutex;
+	std::vector<Trace::Event> events;
+	std::map<u32, std::string> threadNames;
+	Dictionary<u32> lanes;
+	std::atomic<u32> nextThreadId = 0;
+	bool enabled = false;
+} state;
+
+const auto kStartTime = std::chrono::steady_clock::now();
+}
+
+/*****************************************************************************/
+void Trace::enable()
+{
+	state.enabled = true;
+
+	// Make sure the main thread is the first one
+	setThreadName(threadId(), "chalet");
+}
+
+/*****************************************************************************/
+bool Trace::enabled() noexcept
+{
+	return state.enabled;
+}
+
+/*****************************************************************************/
+i64 Trace::now() noexcept
+{
+	auto elapsed = std::chrono::steady_clock::now() - kStartTime;
+	return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+/*****************************************************************************/
+u32 Trace::threadId()
+{
+	thread_local u32 id = state.nextThreadId++;
+	return id;
+}
+
+/*****************************************************************************/
+void Trace::setThreadName(const u32 inThread, std::string inName)
+{
+	if (!state.enabled)
+		return;
+
+	std::lock_guard lock(state.mutex);
+	state.threadNames[inThread] = std::move(inName);
+}
+
+/*****************************************************************************/
+u32 Trace::laneId(const std::string& inName)
+{
+	if (!state.enabled)
+		return 0;
+
+	std::lock_guard lock(state.mutex);
+	auto it = state.lanes.find(inName);
+	if (it != state.lanes.end())
+		return it->second;
+
+	u32 id = state.nextThreadId++;
+	state.lanes.emplace(inName, id);
+	state.threadNames[id] = inName;
+	return id;
+}
+
+/*****************************************************************************/
+void Trace::addEvent(Event&& inEvent)
+{
+	if (!state.enabled)
+		return;
+
+	std::lock_guard lock(state.mutex);
+	state.events.emplace_back(std::move(inEvent));
+}
+
+/*****************************************************************************/
+bool Trace::save(const std::string& inFilename)
+{
+	if (!state.enabled)
+		return false;
+
+	std::lock_guard lock(state.mutex);
+
+	Json root = Json::object();
+	root["displayTimeUnit"] = "ms";
+	root["traceEvents"] = Json::array();
+
+	auto& traceEvents = root.at("traceEvents");
+	for (auto& [thread, name] : state.threadNames)
+	{
+		Json metadata = Json::object();
+		metadata["name"] = "thread_name";
+		metadata["ph"] = "M";
+		metadata["pid"] = 1;
+		metadata["tid"] = thread;
+		metadata["args"] = Json::object();
+		metadata["args"]["name"] = name;
+		traceEvents.push_back(std::move(metadata));
+	}
+
+	for (auto& event : state.events)
+	{
+		Json json = Json::object();
+		json["name"] = event.name;
+		json["cat"] = event.category;
+		json["ph"] = "X";
+		json["ts"] = event.start;
+		json["dur"] = event.duration;
+		json["pid"] = 1;
+		json["tid"] = event.thread;
+
+		if (!event.args.empty())
+		{
+			json["args"] = Json::object();
+			for (auto& [key, value] : event.args)
+				json["args"][key] = value;
+		}
+
+		traceEvents.push_back(std::move(json));
+	}
+
+	return JsonFile::saveToFile(root, inFilename, -1);
+}
+
+/*****************************************************************************/
+TraceScope::TraceScope(const char* inName) :
+	m_name(inName)
+{
+	if (state.enabled)
+		m_start = Trace::now();
+}
+
+/*****************************************************************************/
+TraceScope::TraceScope(const char* inName, const std::string& inDetail) :
+	m_name(inName)
+{
+	if (state.enabled)
+	{
+		m_detail = inDetail;
+		m_start = Trace::now();
+	}
+}
+
+/*****************************************************************************/
+TraceScope::~TraceScope()
+{
+	if (m_start < 0)
+		return;
+
+	Trace::Event event;
+	event.name = m_detail.empty() ? std::string(m_name) : fmt::format("{}: {}", m_name, m_detail);
+	event.start = m_start;
+	event.duration = Trace::now() - m_start;
+	event.thread = Trace::threadId();
+	Trace::addEvent(std::move(event));
+}
+}
@@ -0,0 +1,56 @@
+/*
+	Distributed under the OSI-approved BSD 3-Clause License.
+	See accompanying file LICENSE.txt for details.
+*/
+
+#pragma once
+
+namespace chalet
+{
+// Records spans of time in the Chrome trace event format (chrome://tracing, ui.perfetto.dev)
+//   Nothing is recorded (or allocated) unless tracing was enabled with --trace
+//
+namespace Trace
+{
+struct Event
+{
+	std::string name;
+	std::vector<std::pair<const char*, std::string>> args;
+	const char* category = "chalet";
+	i64 start = 0;
+	i64 duration = 0;
+	u32 thread = 0;
+};
+
+void enable();
+bool enabled() noexcept;
+
+// Microseconds since the program started (valid whether or not tracing is enabled)
+i64 now() noexcept;
+
+// A small id that's unique to the calling thread (0 for the first thread that asks)
+u32 threadId();
+void setThreadName(const u32 inThread, std::string inName);
+
+// An id for work that doesn't have a thread of its own (ie. a process slot), named inName
+u32 laneId(const std::string& inName);
+
+void addEvent(Event&& inEvent);
+
+bool save(const std::string& inFilename);
+}
+
+class TraceScope
+{
+public:
+	explicit TraceScope(const char* inName);
+	explicit TraceScope(const char* inName, const std::string& inDetail);
+	CHALET_DISALLOW_COPY_MOVE(TraceScope);
+	~TraceScope();
+
+private:
+	std::string m_detail;
+	const char* m_name = nullptr;
+	i64 m_start = -1;
+};
+}
@@ -0,0 +1,46 @@
+#include "TestCase.hpp"
+
+#include "System/BatchStat.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::BatchStatTest", "[stat]")
+{
+	auto root = fmt::format("{}/chalet_batch_stat_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(root);
+
+	// Enough files to be looked up as a batch, with every third one missing
+	StringList files;
+	for (i32 i = 0; i < 600; ++i)
+	{
+		auto file = fmt::format("{}/folder_{}/file_{}.h", root, i / 100, i);
+		if (i % 3 != 0)
+			REQUIRE(Files::createFileWithContents(file, "", true));
+
+		files.emplace_back(std::move(file));
+	}
+
+	auto lastWriteTimes = BatchStat::getLastWriteTimes(files);
+	REQUIRE(lastWriteTimes.size() == files.size());
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		auto expected = i % 3 == 0 ? -1 : Files::getLastWriteTime(files[i]);
+		if (lastWriteTimes[i] != expected)
+			++mismatches;
+	}
+	REQUIRE(mismatches == 0);
+
+	// Small lists are looked up directly
+	auto single = BatchStat::getLastWriteTimes(StringList{ files[1], files[0] });
+	REQUIRE(single.size() == 2);
+	REQUIRE(single[0] == Files::getLastWriteTime(files[1]));
+	REQUIRE(single[1] == -1);
+
+	REQUIRE(BatchStat::getLastWriteTimes(StringList()).empty());
+
+	Files::removeRecursively(root);
+}
+}
@@ -0,0 +1,139 @@
+#include "TestCase.hpp"
+
+#include "Cache/BuildFingerprint.hpp"
+#include "Core/CommandLineInputs.hpp"
+#include "Process/Environment.hpp"
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::BuildFingerprintTest", "[fingerprint]")
+{
+	auto root = fmt::format("{}/chalet_build_fingerprint_test", fs::temp_directory_path().generic_string());
+	auto filename = fmt::format("{}/fingerprint", root);
+	Files::removeRecursively(root);
+
+	// Anything written after the build started isn't recorded, so the files are made to look older
+	auto setLastWrite = [](const std::string& inFile, const i32 inMinutesAgo) {
+		std::error_code error;
+		fs::last_write_time(inFile, fs::file_time_type::clock::now() - std::chrono::minutes(inMinutesAgo), error);
+		REQUIRE(!error);
+	};
+	auto path = [&root](const char* inFile) {
+		return fmt::format("{}/{}", root, inFile);
+	};
+
+	REQUIRE(Files::createFileWithContents(path("chalet.json"), "{}", true));
+	REQUIRE(Files::createFileWithContents(path("a.cpp"), "", true));
+	REQUIRE(Files::createFileWithContents(path("a.h"), "", true));
+	REQUIRE(Files::createFileWithContents(path("b.cpp"), "", true));
+	REQUIRE(Files::createFileWithContents(path("a.o"), "", true));
+	REQUIRE(Files::createFileWithContents(path("b.o"), "", true));
+	REQUIRE(Files::createFileWithContents(path("a.d"), fmt::format("{0}/a.o: {0}/a.cpp {0}/a.h\n{0}/a.h:\n", root), true));
+
+	for (auto file : { "chalet.json", "a.cpp", "a.h", "b.cpp", "a.o", "b.o", "a.d" })
+		setLastWrite(path(file), 60);
+
+	{
+		BuildFingerprint fingerprint;
+		REQUIRE(fingerprint.loadFromPath(filename));
+		fingerprint.setKey("key");
+		REQUIRE(!fingerprint.check());
+
+		// Nothing was recorded
+		REQUIRE(!fingerprint.save());
+
+		fingerprint.begin();
+		fingerprint.addGroup("build", StringList{ path("chalet.json") }, StringList());
+		fingerprint.addTarget("a", StringList{ path("a.cpp") }, StringList{ path("a.o") }, StringList{ path("a.d") });
+		fingerprint.addTarget("b", StringList{ path("b.cpp") }, StringList{ path("b.o") }, StringList());
+		fingerprint.commit();
+		REQUIRE(fingerprint.save());
+		REQUIRE(Files::pathExists(filename));
+	}
+
+	{
+		BuildFingerprint fingerprint;
+		REQUIRE(fingerprint.loadFromPath(filename));
+		REQUIRE(fingerprint.targets() == StringList{ "a", "b" });
+
+		fingerprint.setKey("other");
+		REQUIRE(!fingerprint.check());
+		REQUIRE(!fingerprint.isUnchanged("a"));
+
+		fingerprint.setKey("key");
+		REQUIRE(fingerprint.check());
+		REQUIRE(fingerprint.upToDate());
+		REQUIRE(fingerprint.isUnchanged("a"));
+		REQUIRE(fingerprint.isUnchanged("b"));
+
+		// Only the target whose files changed is checked again
+		setLastWrite(path("b.cpp"), 30);
+		REQUIRE(!fingerprint.check());
+		REQUIRE(!fingerprint.upToDate());
+		REQUIRE(fingerprint.isUnchanged("a"));
+		REQUIRE(!fingerprint.isUnchanged("b"));
+
+		fingerprint.begin();
+		REQUIRE(fingerprint.keepTarget("a"));
+		REQUIRE(!fingerprint.keepTarget("b"));
+
+		// The headers from the dependency file count too, and a target is only unchanged if the ones before it are
+		setLastWrite(path("a.h"), 30);
+		REQUIRE(!fingerprint.check());
+		REQUIRE(!fingerprint.isUnchanged("a"));
+		REQUIRE(!fingerprint.isUnchanged("b"));
+	}
+
+	{
+		BuildFingerprint fingerprint;
+		REQUIRE(fingerprint.loadFromPath(filename));
+		fingerprint.setKey("key");
+
+		// A build that didn't record everything it used removes the last one
+		fingerprint.begin();
+		fingerprint.addGroup("build", StringList{ path("chalet.json") }, StringList());
+		REQUIRE(fingerprint.save());
+		REQUIRE(!Files::pathExists(filename));
+
+		// So does one that used a file written after it started
+		REQUIRE(Files::createFileWithContents(path("c.cpp"), "", true));
+		fingerprint.begin();
+		fingerprint.addTarget("c", StringList{ path("c.cpp") }, StringList(), StringList());
+		fingerprint.commit();
+		REQUIRE(fingerprint.save());
+		REQUIRE(!Files::pathExists(filename));
+
+		fingerprint.begin();
+		fingerprint.addGroup("build", StringList{ path("chalet.json") }, StringList());
+		fingerprint.commit();
+		REQUIRE(fingerprint.save());
+		REQUIRE(Files::pathExists(filename));
+
+		// The files it compares against are gone
+		fingerprint.invalidate();
+		REQUIRE(fingerprint.save());
+		REQUIRE(!Files::pathExists(filename));
+	}
+
+	{
+		// The build file isn't read when the build is skipped, so the variables it uses are part of the key
+		CommandLineInputs inputs;
+		inputs.setInputFile(path("chalet.json"));
+		inputs.setSettingsFile(path(".chaletrc"));
+		auto key = BuildFingerprint::getKey(inputs);
+
+		Environment::set("CHALET_FINGERPRINT_TEST", "1");
+		REQUIRE(String::equals(key, BuildFingerprint::getKey(inputs)));
+
+		REQUIRE(Files::createFileWithContents(path("chalet.json"), R"json({ "defines": [ "TEST=${env:CHALET_FINGERPRINT_TEST}" ] })json", true));
+		key = BuildFingerprint::getKey(inputs);
+
+		Environment::set("CHALET_FINGERPRINT_TEST", "2");
+		REQUIRE(!String::equals(key, BuildFingerprint::getKey(inputs)));
+	}
+
+	Files::removeRecursively(root);
+}
+}
@@ -0,0 +1,90 @@
+#include "TestCase.hpp"
+
+#include "Builder/BuildHistoryReport.hpp"
+#include "Cache/BuildHistory.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::BuildHistoryTest", "[history]")
+{
+	auto dir = fmt::format("{}/chalet_build_history_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(dir);
+
+	auto makeRecord = [](const i64 inBuild, const i64 inTarget, const u32 inCompiled) {
+		BuildHistory::Record record;
+		record.route = "build";
+		record.configuration = "Release";
+		record.toolchain = "gcc";
+		record.architecture = "x86_64";
+		record.success = true;
+		record.initialize = 100;
+		record.prepare = 20;
+		record.build = inBuild;
+		record.postBuild = 5;
+		record.total = 125 + inBuild;
+		record.compiled = inCompiled;
+
+		auto& target = record.targets.emplace_back();
+		target.name = "app";
+		target.duration = inTarget;
+		target.compiled = inCompiled;
+		return record;
+	};
+
+	{
+		BuildHistory history(dir);
+		REQUIRE(history.add(makeRecord(1000, 900, 10)));
+		REQUIRE(history.add(makeRecord(1100, 1000, 10)));
+		REQUIRE(history.add(makeRecord(900, 800, 10)));
+		REQUIRE(history.add(makeRecord(50, 40, 1)));
+	}
+
+	// A partially written line is skipped
+	Files::ofstream(fmt::format("{}/.chalethistory", dir), std::ios_base::binary | std::ios_base::out | std::ios_base::app) << "{\"route\":\"bu";
+
+	BuildHistory history(dir);
+	REQUIRE(history.load());
+	REQUIRE(history.records().size() == 4);
+	REQUIRE(history.records().front().targets.size() == 1);
+	REQUIRE(history.records().front().targets.front().duration == 900);
+
+	{
+		// The latest build only compiled one file, so there's nothing to compare it with
+		BuildHistoryReport report(10, 10);
+		REQUIRE(report.compare(history.records(), "Release", "gcc"));
+		REQUIRE(report.latest() != nullptr);
+		REQUIRE(report.baselineBuilds() == 0);
+		REQUIRE(report.regressions() == 0);
+	}
+
+	REQUIRE(history.add(makeRecord(1500, 1400, 10)));
+	REQUIRE(history.load());
+
+	{
+		BuildHistoryReport report(10, 10);
+		REQUIRE(report.compare(history.records(), "Release", "gcc"));
+		REQUIRE(report.baselineBuilds() == 3);
+		REQUIRE(report.targets().size() == 1);
+		REQUIRE(report.targets().front().baseline == 900);
+		REQUIRE(report.targets().front().regressed);
+
+		// build & total
+		REQUIRE(report.regressions() == 3);
+		REQUIRE(!report.getText().empty());
+	}
+
+	{
+		BuildHistoryReport report(100, 10);
+		REQUIRE(report.compare(history.records(), "Release", "gcc"));
+		REQUIRE(report.regressions() == 0);
+	}
+
+	{
+		BuildHistoryReport report(10, 10);
+		REQUIRE(!report.compare(history.records(), "Debug", "gcc"));
+	}
+
+	Files::removeRecursively(dir);
+}
+}
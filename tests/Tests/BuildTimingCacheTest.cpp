@@ -0,0 +1,102 @@
+#include "TestCase.hpp"
+
+#include "Cache/BuildTimingCache.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::BuildTimingCacheTest", "[timings]")
+{
+	auto dir = fmt::format("{}/chalet_build_timing_cache_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(dir);
+	REQUIRE(Files::makeDirectory(dir));
+
+	auto ninjaLog = fmt::format("{}/.ninja_log", dir);
+	auto appendToLog = [&ninjaLog](const std::string& inContents) {
+		Files::ofstream(ninjaLog, std::ios_base::binary | std::ios_base::out | std::ios_base::app) << inContents;
+	};
+
+	appendToLog("# ninja log v5\n");
+	appendToLog("0\t1200\t1700000000000000000\tbuild/obj/a.cpp.o\t5d8e7c1b2a3f4e6d\n");
+	appendToLog("5\t350\t1700000000000000000\tbuild/obj/b c.cpp.o\t1b2a3f4e6d5d8e7c\n");
+
+	{
+		BuildTimingCache cache;
+		REQUIRE(cache.loadFromPath(dir));
+		REQUIRE(cache.readNinjaLog(ninjaLog));
+
+		REQUIRE(cache.entries().size() == 2);
+		REQUIRE(cache.get("build/obj/a.cpp.o").duration() == 1200);
+		REQUIRE(cache.get("build/obj/b c.cpp.o").duration() == 345);
+
+		// A command pool timing for the same output replaces the old one
+		ProcessResourceUsage usage;
+		usage.userTime = 400000;
+		usage.systemTime = 50000;
+		usage.maxResidentSize = 81920;
+		cache.set("build/obj/a.cpp.o", 100, 600, usage);
+		REQUIRE(cache.save());
+
+		// Neither output was known before this build
+		REQUIRE(cache.updated().size() == 2);
+		REQUIRE(!cache.updated().at("build/obj/a.cpp.o").has_value());
+	}
+
+	// Only the new entries are read on the next build, and an incomplete line is left for later
+	appendToLog("0\t2000\t1700000000000000000\tbuild/app\t6d5d8e7c1b2a3f4e\n");
+	appendToLog("0\t99");
+
+	{
+		BuildTimingCache cache;
+		REQUIRE(cache.loadFromPath(dir));
+		REQUIRE(cache.updated().empty());
+		REQUIRE(cache.get("build/obj/a.cpp.o").duration() == 500);
+		REQUIRE(cache.get("build/obj/a.cpp.o").usage.userTime == 400000);
+		REQUIRE(cache.get("build/obj/a.cpp.o").usage.maxResidentSize == 81920);
+
+		REQUIRE(cache.readNinjaLog(ninjaLog));
+		REQUIRE(cache.entries().size() == 3);
+		REQUIRE(cache.get("build/obj/a.cpp.o").duration() == 500);
+		REQUIRE(cache.get("build/app").duration() == 2000);
+		REQUIRE(cache.save());
+	}
+
+	// A recompacted log is read from the start
+	Files::removeIfExists(ninjaLog);
+	appendToLog("# ninja log v5\n");
+	appendToLog("0\t800\t1700000000000000000\tbuild/obj/a.cpp.o\t5d8e7c1b2a3f4e6d\n");
+
+	{
+		BuildTimingCache cache;
+		REQUIRE(cache.loadFromPath(dir));
+		REQUIRE(cache.readNinjaLog(ninjaLog));
+		REQUIRE(cache.get("build/obj/a.cpp.o").duration() == 800);
+
+		// What it was before this build is kept
+		auto& previous = cache.updated().at("build/obj/a.cpp.o");
+		REQUIRE(previous.has_value());
+		REQUIRE(previous->duration() == 500);
+		REQUIRE(previous->usage.userTime == 400000);
+		REQUIRE(cache.save());
+	}
+
+	// So is one that was recompacted & then grew past where it was last read
+	Files::removeIfExists(ninjaLog);
+	appendToLog("# ninja log v5\n");
+	appendToLog("0\t700\t1700000000000000000\tbuild/obj/a.cpp.o\t5d8e7c1b2a3f4e6d\n");
+	appendToLog("0\t900\t1700000000000000000\tbuild/obj/b c.cpp.o\t1b2a3f4e6d5d8e7c\n");
+	appendToLog("0\t2500\t1700000000000000000\tbuild/app\t6d5d8e7c1b2a3f4e\n");
+
+	{
+		BuildTimingCache cache;
+		REQUIRE(cache.loadFromPath(dir));
+		REQUIRE(cache.readNinjaLog(ninjaLog));
+		REQUIRE(cache.entries().size() == 3);
+		REQUIRE(cache.get("build/obj/a.cpp.o").duration() == 700);
+		REQUIRE(cache.get("build/obj/b c.cpp.o").duration() == 900);
+		REQUIRE(cache.get("build/app").duration() == 2500);
+	}
+
+	Files::removeRecursively(dir);
+}
+}
@@ -0,0 +1,78 @@
+#include "TestCase.hpp"
+
+#include "Compile/CommandPool.hpp"
+#include "System/Files.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+#if !defined(CHALET_WIN32)
+namespace
+{
+// A fake compiler that records how many of its siblings are running at once
+constexpr const char kFakeCompiler[] = R"sh(#!/bin/sh
+touch "$1/running/$$"
+ls "$1/running" | wc -l >> "$1/concurrency"
+sleep 0.5
+rm -f "$1/running/$$"
+)sh";
+
+// inCount commands in inPool, followed by inDefaultCount unrestricted ones
+u32 runFakeCompiles(const std::string& inDir, const CommandPool::Pool inPool, const u32 inCount, const CommandPool::Settings& inSettings, const u32 inDefaultCount = 0)
+{
+	Files::removeRecursively(inDir);
+	Files::makeDirectory(fmt::format("{}/running", inDir));
+
+	auto script = fmt::format("{}/fake-compiler.sh", inDir);
+	Files::createFileWithContents(script, kFakeCompiler, true);
+
+	CommandPool::Job job;
+	for (u32 i = 0; i < inCount + inDefaultCount; ++i)
+	{
+		CommandPool::Cmd cmd;
+		cmd.output = fmt::format("fake_{}.cpp", i);
+		cmd.reference = cmd.output;
+		cmd.command = { "/bin/sh", script, inDir };
+		cmd.pool = i < inCount ? inPool : CommandPool::Pool::Default;
+		job.list.emplace_back(std::move(cmd));
+	}
+
+	CommandPool commandPool(8);
+	if (!commandPool.run(job, inSettings))
+		return 0;
+
+	u32 ret = 0;
+	auto lines = String::split(Files::getFileContents(fmt::format("{}/concurrency", inDir)), '\n');
+	for (auto& line : lines)
+	{
+		auto value = static_cast<u32>(atoi(line.c_str()));
+		ret = std::max(ret, value);
+	}
+	return ret;
+}
+}
+
+TEST_CASE("chalet::CommandPoolTest", "[pools]")
+{
+	auto dir = fmt::format("{}/chalet_command_pool_test", fs::temp_directory_path().generic_string());
+
+	CommandPool::Settings settings;
+	settings.quiet = true;
+	settings.maxHeavyJobs = 2;
+	settings.maxLinkJobs = 1;
+	settings.maxLtoLinkJobs = 1;
+
+	// Sanity check that the fake compiler sees unrestricted jobs in parallel
+	REQUIRE(runFakeCompiles(dir, CommandPool::Pool::Default, 8, settings) > 2);
+
+	REQUIRE(runFakeCompiles(dir, CommandPool::Pool::Heavy, 8, settings) == 2);
+	REQUIRE(runFakeCompiles(dir, CommandPool::Pool::Link, 4, settings) == 1);
+	REQUIRE(runFakeCompiles(dir, CommandPool::Pool::LtoLink, 4, settings) == 1);
+
+	// Links waiting on their pool don't keep the other commands from running alongside the one that isn't
+	REQUIRE(runFakeCompiles(dir, CommandPool::Pool::Link, 7, settings, 7) > 2);
+
+	Files::removeRecursively(dir);
+}
+#endif
+}
@@ -0,0 +1,64 @@
+#include "TestCase.hpp"
+
+#include <thread>
+
+#include "Libraries/Json.hpp"
+#include "System/Files.hpp"
+#include "Utility/EventStream.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::EventStreamTest", "[events]")
+{
+	auto eventsFile = fmt::format("{}/chalet_events_test.ndjson", fs::temp_directory_path().generic_string());
+	Files::removeIfExists(eventsFile);
+
+	REQUIRE(!EventStream::enabled());
+	REQUIRE(EventStream::open(eventsFile));
+	REQUIRE(EventStream::enabled());
+
+	EventStream::emit("build_start", { { "route", "build" } });
+
+	// Emitted from several threads at once, like the command pool workers
+	std::vector<std::thread> threads;
+	for (i64 i = 0; i < 4; ++i)
+	{
+		threads.emplace_back([i]() {
+			for (i64 job = 0; job < 25; ++job)
+				EventStream::emit("job_finished", { { "target", "app" } }, { { "job", i * 25 + job }, { "exitCode", 0 } });
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	EventStream::emit("diagnostic", { { "level", "warning" }, { "message", "\x1b[1mmain.cpp:1:\x1b[0m warning" } });
+	EventStream::close();
+	REQUIRE(!EventStream::enabled());
+
+	auto lines = String::split(Files::getFileContents(eventsFile), '\n');
+	while (!lines.empty() && lines.back().empty())
+		lines.pop_back();
+
+	REQUIRE(lines.size() == 102);
+
+	auto first = Json::parse(lines.front());
+	REQUIRE(first.at("event").get<std::string>() == "build_start");
+	REQUIRE(first.at("route").get<std::string>() == "build");
+	REQUIRE(first.contains("time"));
+
+	std::unordered_set<i64> jobs;
+	for (size_t i = 1; i < lines.size() - 1; ++i)
+	{
+		auto event = Json::parse(lines[i]);
+		REQUIRE(event.at("event").get<std::string>() == "job_finished");
+		jobs.insert(event.at("job").get<i64>());
+	}
+	REQUIRE(jobs.size() == 100);
+
+	auto last = Json::parse(lines.back());
+	REQUIRE(last.at("message").get<std::string>() == "main.cpp:1: warning");
+
+	Files::removeIfExists(eventsFile);
+}
+}
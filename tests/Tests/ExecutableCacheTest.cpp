@@ -0,0 +1,49 @@
+#include "TestCase.hpp"
+
+#include "Cache/ExecutableCache.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::ExecutableCacheTest", "[which]")
+{
+	auto dir = fmt::format("{}/chalet_executable_cache_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(dir);
+	REQUIRE(Files::makeDirectory(fmt::format("{}/bin", dir)));
+	REQUIRE(Files::makeDirectory(fmt::format("{}/tools", dir)));
+
+#if defined(CHALET_WIN32)
+	auto path = fmt::format("{}/bin;{}/tools", dir, dir);
+#else
+	auto path = fmt::format("{}/bin:{}/tools", dir, dir);
+#endif
+	auto tool = fmt::format("{}/tools/tool", dir);
+
+	std::string result;
+	REQUIRE(ExecutableCache::load(dir));
+	REQUIRE(!ExecutableCache::find(path, "tool", result));
+
+	ExecutableCache::add(path, "tool", tool);
+	ExecutableCache::add(path, "missing", std::string());
+	REQUIRE(ExecutableCache::save());
+	REQUIRE(!ExecutableCache::save());
+
+	// Results (including the ones that weren't found) survive the next run, if nothing in PATH changed
+	REQUIRE(ExecutableCache::load(dir));
+	REQUIRE(ExecutableCache::find(path, "tool", result));
+	REQUIRE(result == tool);
+	REQUIRE(ExecutableCache::find(path, "missing", result));
+	REQUIRE(result.empty());
+
+	// A different PATH has its own results
+	REQUIRE(!ExecutableCache::find(fmt::format("{}/tools", dir), "tool", result));
+
+	// Adding an executable to one of the folders throws the results away
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/bin/missing", dir), std::string()));
+	REQUIRE(ExecutableCache::load(dir));
+	REQUIRE(!ExecutableCache::find(path, "tool", result));
+	REQUIRE(!ExecutableCache::find(path, "missing", result));
+
+	Files::removeRecursively(dir);
+}
+}
@@ -0,0 +1,60 @@
+#include "TestCase.hpp"
+
+#include "System/FileCopier.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::FileCopierTest", "[copy]")
+{
+	auto dir = fmt::format("{}/chalet_file_copier_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(dir);
+
+	auto from = fmt::format("{}/from", dir);
+	auto to = fmt::format("{}/to", dir);
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/a.txt", from), "a"));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/assets/b.txt", from), "bb", true));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/assets/nested/c.txt", from), "ccc", true));
+#if !defined(CHALET_WIN32)
+	fs::create_symlink("a.txt", fmt::format("{}/link.txt", from));
+#endif
+
+	FileCopier copier;
+	REQUIRE(copier.copy(from, to));
+	REQUIRE(copier.filesCopied() == 3);
+	REQUIRE(copier.filesSkipped() == 0);
+	REQUIRE(Files::getFileContents(fmt::format("{}/assets/nested/c.txt", to)) == Files::getFileContents(fmt::format("{}/assets/nested/c.txt", from)));
+	REQUIRE(fs::last_write_time(fmt::format("{}/a.txt", to)) == fs::last_write_time(fmt::format("{}/a.txt", from)));
+#if !defined(CHALET_WIN32)
+	REQUIRE(fs::is_symlink(fmt::format("{}/link.txt", to)));
+	REQUIRE(fs::read_symlink(fmt::format("{}/link.txt", to)) == "a.txt");
+#endif
+
+	// Files that match the destination's size & last write time are skipped
+	REQUIRE(copier.copy(from, to));
+	REQUIRE(copier.filesCopied() == 0);
+	REQUIRE(copier.filesSkipped() == 3);
+
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/assets/b.txt", from), "changed"));
+	REQUIRE(copier.copy(from, to));
+	REQUIRE(copier.filesCopied() == 1);
+	REQUIRE(Files::getFileContents(fmt::format("{}/assets/b.txt", to)) == Files::getFileContents(fmt::format("{}/assets/b.txt", from)));
+
+	auto linked = fmt::format("{}/linked", dir);
+	FileCopier linker(fs::copy_options::overwrite_existing, FileCopier::Mode::HardLink);
+	REQUIRE(linker.copy(from, linked));
+	REQUIRE(fs::equivalent(fmt::format("{}/assets/nested/c.txt", from), fmt::format("{}/assets/nested/c.txt", linked)));
+
+	// A mirror also removes what's no longer in the source
+	REQUIRE(Files::removeRecursively(fmt::format("{}/assets/nested", from)));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/d.txt", from), "dddd"));
+	REQUIRE(copier.mirror(from, to));
+	REQUIRE(copier.filesCopied() == 1);
+	REQUIRE(copier.filesRemoved() == 2);
+	REQUIRE(!Files::pathExists(fmt::format("{}/assets/nested", to)));
+	REQUIRE(Files::pathExists(fmt::format("{}/assets/b.txt", to)));
+	REQUIRE(Files::pathExists(fmt::format("{}/d.txt", to)));
+
+	Files::removeRecursively(dir);
+}
+}
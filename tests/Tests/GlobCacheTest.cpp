@@ -0,0 +1,75 @@
+#include "TestCase.hpp"
+
+#include <chrono>
+
+#include "Cache/GlobCache.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::GlobCacheTest", "[glob]")
+{
+	auto root = fmt::format("{}/chalet_glob_cache_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(root);
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/main.cpp", root), "", true));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/foo/foo.cpp", root), "", true));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/bar/bar.cpp", root), "", true));
+
+	// Folders written in the last couple of seconds are always read again, so age them
+	auto age = [&root]() {
+		auto lastWrite = fs::file_time_type::clock::now() - std::chrono::hours(1);
+		for (auto folder : { "src", "src/foo", "src/bar" })
+			fs::last_write_time(fmt::format("{}/{}", root, folder), lastWrite);
+	};
+	age();
+
+	auto pattern = fmt::format("{}/src/**/*.cpp", root);
+	auto glob = [&pattern](GlobCache& inCache) {
+		StringList files;
+		REQUIRE(Files::addPathToListWithGlob(pattern, files, GlobMatch::Files, &inCache));
+		return files;
+	};
+
+	{
+		GlobCache cache;
+		REQUIRE(cache.loadFromPath(root));
+		REQUIRE(cache.get(pattern, GlobMatch::Files) == nullptr);
+		REQUIRE(glob(cache).size() == 3);
+		REQUIRE(cache.save());
+	}
+
+	GlobCache cache;
+	REQUIRE(cache.loadFromPath(root));
+
+	auto listings = cache.get(pattern, GlobMatch::Files);
+	REQUIRE(listings != nullptr);
+	REQUIRE(listings->size() == 3);
+	REQUIRE(listings->at(fmt::format("{}/src", root)).matches.size() == 1);
+	REQUIRE(listings->at(fmt::format("{}/src", root)).folders.size() == 2);
+	REQUIRE(cache.get(pattern, GlobMatch::Folders) == nullptr);
+
+	// Nothing changed, so nothing is read
+	GlobPattern globPattern("**/*.cpp");
+	GlobWalker walker(globPattern, GlobMatch::Files);
+	auto matches = walker.walk(fmt::format("{}/src", root), listings);
+	REQUIRE(walker.foldersRead() == 0);
+	REQUIRE(matches.size() == 3);
+	REQUIRE(matches[0] == fmt::format("{}/src/bar/bar.cpp", root));
+
+	// Only the folder that changed is read again
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/foo/foo2.cpp", root), "", true));
+	matches = walker.walk(fmt::format("{}/src", root), listings);
+	REQUIRE(walker.foldersRead() == 1);
+	REQUIRE(matches.size() == 4);
+
+	REQUIRE(glob(cache).size() == 4);
+	REQUIRE(cache.save());
+
+	// An unused pattern is dropped the next time the cache is saved
+	REQUIRE(cache.loadFromPath(root));
+	REQUIRE(cache.save());
+	REQUIRE(!Files::pathExists(fmt::format("{}/.chaletglobs", root)));
+
+	Files::removeRecursively(root);
+}
+}
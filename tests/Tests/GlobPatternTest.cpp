@@ -0,0 +1,121 @@
+#include "TestCase.hpp"
+
+#include "System/ExcludeMatcher.hpp"
+#include "System/Files.hpp"
+#include "System/GlobPattern.hpp"
+#include "Utility/String.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::GlobPatternTest", "[glob]")
+{
+	REQUIRE(GlobPattern::matchWildcard("*.cpp", "main.cpp"));
+	REQUIRE(GlobPattern::matchWildcard("unit_?.c*", "unit_1.cc"));
+	REQUIRE(!GlobPattern::matchWildcard("*.cpp", "main.hpp"));
+	REQUIRE(!GlobPattern::matchWildcard("unit_?.cpp", "unit_10.cpp"));
+
+	GlobPattern sources("**/*.cpp");
+	REQUIRE(sources.matches("main.cpp"));
+	REQUIRE(sources.matches("foo/bar/bar.cpp"));
+	REQUIRE(!sources.matches("foo/bar/bar.hpp"));
+
+	GlobPattern anyFolders("**.cpp");
+	REQUIRE(anyFolders.matches("main.cpp"));
+	REQUIRE(anyFolders.matches("foo/bar/bar.cpp"));
+
+	GlobPattern topLevel("*.cpp");
+	REQUIRE(topLevel.matches("main.cpp"));
+	REQUIRE(!topLevel.matches("foo/main.cpp"));
+
+	GlobPattern braces("{src,include}/**/*.{h,hpp}");
+	REQUIRE(braces.matches("src/detail/types.h"));
+	REQUIRE(braces.matches("include/api.hpp"));
+	REQUIRE(!braces.matches("test/api.hpp"));
+	REQUIRE(braces.hasLiteral("include"));
+
+	// Only the folders that could still contain a match are walked into
+	auto state = braces.initialState();
+	GlobPattern::State next;
+	braces.advance(state, "test", next);
+	REQUIRE(next.empty());
+	braces.advance(state, "src", next);
+	REQUIRE(braces.canDescend(next));
+	REQUIRE(!braces.isMatch(next));
+
+	GlobPattern file("foo.cpp");
+	file.advance(file.initialState(), "foo.cpp", next);
+	REQUIRE(file.isMatch(next));
+	REQUIRE(!file.canDescend(next));
+
+	// Excluding a folder excludes what's inside of it, but not folders that only start with the same name
+	ExcludeMatcher excludes(StringList{ "src/gen", "src/**/*_test.cpp", "./src/main.cpp" });
+	REQUIRE(excludes.isExcluded("src/gen"));
+	REQUIRE(excludes.isExcluded("src/gen/types.cpp"));
+	REQUIRE(!excludes.isExcluded("src/generated/types.cpp"));
+	REQUIRE(excludes.isExcluded("src/foo/foo_test.cpp"));
+	REQUIRE(excludes.isExcluded("src/main.cpp"));
+	REQUIRE(!excludes.isExcluded("src/foo/foo.cpp"));
+	REQUIRE(excludes.isExcluded(fmt::format("{}/src/gen/types.cpp", Files::getWorkingDirectory())));
+	REQUIRE(!ExcludeMatcher().isExcluded("src/main.cpp"));
+
+	// A name without a folder matches a file or folder at any depth, but only as a whole name
+	ExcludeMatcher names(StringList{ "main.cpp", "test", "*_gen.cpp" });
+	REQUIRE(names.isExcluded("main.cpp"));
+	REQUIRE(names.isExcluded("src/main.cpp"));
+	REQUIRE(names.isExcluded("src/test/foo.cpp"));
+	REQUIRE(names.isExcluded("test/foo.cpp"));
+	REQUIRE(!names.isExcluded("src/testing.cpp"));
+	REQUIRE(!names.isExcluded("src/main.cpp.in"));
+	REQUIRE(names.isExcluded("src/foo/types_gen.cpp"));
+
+	auto root = fmt::format("{}/chalet_glob_test", fs::temp_directory_path().generic_string());
+	Files::removeRecursively(root);
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/main.cpp", root), "", true));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/foo/foo.cpp", root), "", true));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/foo/foo.hpp", root), "", true));
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/node_modules/skipped.cpp", root), "", true));
+
+	StringList files;
+	REQUIRE(Files::addPathToListWithGlob(fmt::format("{}/src/**/*.cpp", root), files, GlobMatch::Files));
+	REQUIRE(files.size() == 2);
+	REQUIRE(files[0] == fmt::format("{}/src/foo/foo.cpp", root));
+	REQUIRE(files[1] == fmt::format("{}/src/main.cpp", root));
+
+	StringList folders;
+	REQUIRE(Files::addPathToListWithGlob(fmt::format("{}/src/*", root), folders, GlobMatch::Folders));
+	REQUIRE(folders.size() == 2);
+
+	ExcludeMatcher excludeFoo(StringList{ fmt::format("{}/src/foo", root) });
+	files.clear();
+	REQUIRE(Files::addPathToListWithGlob(fmt::format("{}/src/**/*.cpp", root), files, GlobMatch::Files, nullptr, &excludeFoo));
+	REQUIRE(files.size() == 1);
+	REQUIRE(files[0] == fmt::format("{}/src/main.cpp", root));
+
+	// Without a folder, a pattern matches at any depth of the working directory, except in the folders that are skipped
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/src/.git/hook.cpp", root), "", true));
+	auto cwd = Files::getWorkingDirectory();
+	REQUIRE(Files::changeWorkingDirectory(root));
+	files.clear();
+	REQUIRE(Files::addPathToListWithGlob("*.cpp", files, GlobMatch::Files));
+	REQUIRE(Files::changeWorkingDirectory(cwd));
+	REQUIRE(files.size() == 2);
+	REQUIRE(String::endsWith("/src/foo/foo.cpp", files[0]));
+	REQUIRE(String::endsWith("/src/main.cpp", files[1]));
+
+	// Unless the pattern names them
+	files.clear();
+	REQUIRE(Files::addPathToListWithGlob(fmt::format("{}/src/.git/*.cpp", root), files, GlobMatch::Files));
+	REQUIRE(files.size() == 1);
+	Files::removeRecursively(fmt::format("{}/src/.git", root));
+
+	// Removing a folder from the callback skips whatever was inside of it
+	StringList removed;
+	REQUIRE(Files::forEachGlobMatch(fmt::format("{}/src/**", root), GlobMatch::FilesAndFolders, [&removed](const std::string& inPath) {
+		removed.push_back(inPath);
+		Files::removeRecursively(inPath);
+	}));
+	REQUIRE(removed.size() == 3);
+
+	Files::removeRecursively(root);
+}
+}
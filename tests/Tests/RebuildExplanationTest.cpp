@@ -0,0 +1,43 @@
+#include "TestCase.hpp"
+
+#include "Compile/RebuildExplanation.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::RebuildExplanationTest", "[explain]")
+{
+	using Reason = RebuildExplanation::Reason;
+
+	RebuildExplanation explanation;
+	REQUIRE(explanation.empty());
+
+	auto stamp = RebuildExplanation::getStampChange(1000, 1030);
+	REQUIRE(stamp == "stamp 1030 > last build 1000 (+30s)");
+	REQUIRE(RebuildExplanation::getStampChange(1000, 0) == "does not exist");
+
+	explanation.add(Reason::DependencyChanged, "app", "src/a.cpp", "include/config.h", stamp);
+	explanation.add(Reason::DependencyChanged, "app", "src/b.cpp", "include/config.h", stamp);
+	explanation.add(Reason::DependencyChanged, "app", "src/c.cpp", "include/other.h", stamp);
+	explanation.add(Reason::SourceChanged, "app", "src/d.cpp", std::string(), stamp);
+	explanation.add(Reason::ObjectsChanged, "app", "build/app", std::string());
+
+	// Only the first reason for a file is kept
+	explanation.add(Reason::SourceChanged, "app", "src/a.cpp", std::string(), stamp);
+
+	REQUIRE(!explanation.empty());
+	REQUIRE(explanation.entries().size() == 5);
+	REQUIRE(explanation.entries().front().cause == "include/config.h");
+
+	auto text = explanation.getText(1);
+	REQUIRE(text.find("(5 decision(s))") != std::string::npos);
+	REQUIRE(text.find("Dependency changed (3):") != std::string::npos);
+
+	// The most common cause comes first, and the rest are cut off by the count
+	REQUIRE(text.find("include/config.h - stamp 1030 > last build 1000 (+30s) (2):") != std::string::npos);
+	REQUIRE(text.find("include/other.h") == std::string::npos);
+	REQUIRE(text.find("... and 1 other cause(s)") != std::string::npos);
+	REQUIRE(text.find("app: src/a.cpp") != std::string::npos);
+	REQUIRE(text.find("app: src/b.cpp") == std::string::npos);
+	REQUIRE(text.find("app: src/d.cpp - stamp 1030") != std::string::npos);
+}
+}
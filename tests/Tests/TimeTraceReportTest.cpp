@@ -0,0 +1,52 @@
+#include "TestCase.hpp"
+
+#include "Builder/TimeTraceReport.hpp"
+#include "System/Files.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::TimeTraceReport", "[timeTrace]")
+{
+	auto traceFile = fmt::format("{}/chalet_time_trace_test.cpp.json", fs::temp_directory_path().generic_string());
+	REQUIRE(Files::createFileWithContents(traceFile, R"json({
+	"traceEvents": [
+		{ "ph": "X", "name": "Source", "dur": 3000, "args": { "detail": "include/vector" } },
+		{ "ph": "X", "name": "Source", "dur": 1000, "args": { "detail": "include/vector" } },
+		{ "ph": "X", "name": "InstantiateClass", "dur": 2000, "args": { "detail": "std::vector<int>" } },
+		{ "ph": "X", "name": "InstantiateFunction", "dur": 4000, "args": { "detail": "std::vector<float>::push_back" } },
+		{ "ph": "X", "name": "OptFunction", "dur": 500, "args": { "detail": "main" } },
+		{ "ph": "X", "name": "ExecuteCompiler", "dur": 12000 },
+		{ "ph": "M", "name": "process_name", "args": { "name": "clang" } }
+	]
+})json"));
+
+	TimeTraceReport::Totals totals;
+	REQUIRE(TimeTraceReport::readTraceFile(traceFile, totals));
+	REQUIRE(TimeTraceReport::readTraceFile(traceFile, totals));
+
+	auto sourceFile = traceFile.substr(0, traceFile.size() - 5);
+	REQUIRE(totals.files.at(sourceFile).duration == 24000);
+	REQUIRE(totals.files.at(sourceFile).count == 2);
+
+	REQUIRE(totals.headers.at("include/vector").duration == 8000);
+	REQUIRE(totals.headers.at("include/vector").count == 4);
+
+	REQUIRE(totals.instantiations.size() == 2);
+	REQUIRE(totals.templateSets.at("std::vector").duration == 12000);
+	REQUIRE(totals.functions.at("main").count == 2);
+
+	TimeTraceReport::Totals merged;
+	TimeTraceReport::merge(totals, merged);
+	TimeTraceReport::merge(totals, merged);
+	REQUIRE(merged.templateSets.at("std::vector").count == 8);
+
+	auto json = TimeTraceReport::getJson(merged, 1);
+	REQUIRE(json.at("instantiations").size() == 1);
+	REQUIRE(json.at("instantiations").at(0).at("name").get<std::string>() == "std::vector<float>::push_back");
+
+	auto text = TimeTraceReport::getText(merged, 10);
+	REQUIRE(text.find("include/vector (8 times, avg 2 ms)") != std::string::npos);
+
+	Files::removeIfExists(traceFile);
+}
+}
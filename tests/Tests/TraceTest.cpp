@@ -0,0 +1,72 @@
+#include "TestCase.hpp"
+
+#include "Json/JsonFile.hpp"
+#include "System/Files.hpp"
+#include "Utility/Trace.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::TraceTest", "[trace]")
+{
+	auto traceFile = fmt::format("{}/chalet_trace_test.json", fs::temp_directory_path().generic_string());
+	Files::removeIfExists(traceFile);
+
+	Trace::enable();
+	REQUIRE(Trace::enabled());
+
+	{
+		TraceScope traceScope("phase", "detail");
+	}
+
+	auto lane = Trace::laneId("worker 1");
+	REQUIRE(lane != Trace::threadId());
+	REQUIRE(lane == Trace::laneId("worker 1"));
+
+	Trace::Event event;
+	event.name = "src/main.cpp";
+	event.category = "command";
+	event.start = 10;
+	event.duration = 20;
+	event.thread = lane;
+	event.args.emplace_back("target", "app");
+	Trace::addEvent(std::move(event));
+
+	REQUIRE(Trace::save(traceFile));
+
+	JsonFile jsonFile(traceFile);
+	REQUIRE(jsonFile.load());
+
+	const auto& root = jsonFile.root;
+	REQUIRE(root.contains("traceEvents"));
+
+	bool foundPhase = false;
+	bool foundCommand = false;
+	bool foundLaneName = false;
+	for (auto& traceEvent : root.at("traceEvents"))
+	{
+		auto name = traceEvent.at("name").get<std::string>();
+		auto phase = traceEvent.at("ph").get<std::string>();
+		if (phase == "X" && name == "phase: detail")
+		{
+			foundPhase = true;
+		}
+		else if (phase == "X" && name == "src/main.cpp")
+		{
+			foundCommand = true;
+			REQUIRE(traceEvent.at("dur").get<i64>() == 20);
+			REQUIRE(traceEvent.at("tid").get<u32>() == lane);
+			REQUIRE(traceEvent.at("args").at("target").get<std::string>() == "app");
+		}
+		else if (phase == "M" && traceEvent.at("tid").get<u32>() == lane)
+		{
+			foundLaneName = traceEvent.at("args").at("name").get<std::string>() == "worker 1";
+		}
+	}
+
+	REQUIRE(foundPhase);
+	REQUIRE(foundCommand);
+	REQUIRE(foundLaneName);
+
+	Files::removeIfExists(traceFile);
+}
+}
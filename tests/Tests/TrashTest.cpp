@@ -0,0 +1,67 @@
+#include "TestCase.hpp"
+
+#if !defined(CHALET_WIN32)
+	#include <unistd.h>
+#endif
+
+#include "System/Files.hpp"
+#include "System/Trash.hpp"
+
+namespace chalet
+{
+TEST_CASE("chalet::TrashTest", "[trash]")
+{
+	auto root = fmt::format("{}/chalet_trash_test", fs::temp_directory_path().generic_string());
+	auto trash = fmt::format("{}/.chalettrash", root);
+	Files::removeRecursively(root);
+
+	for (i32 i = 0; i < 10; ++i)
+	{
+		REQUIRE(Files::createFileWithContents(fmt::format("{}/build/obj_{}/unit.o", root, i), "", true));
+		REQUIRE(Files::createFileWithContents(fmt::format("{}/build/obj_{}/deps/unit.d", root, i), "", true));
+	}
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/kept/file.txt", root), "", true));
+
+	// Links are removed, not what they point to
+#if !defined(CHALET_WIN32)
+	std::error_code error;
+	fs::create_directory_symlink(fmt::format("{}/kept", root), fmt::format("{}/build/link", root), error);
+	REQUIRE(!error);
+#endif
+
+	// Gone right away, but only deleted in the background
+	REQUIRE(Trash::remove(fmt::format("{}/build", root), trash));
+	REQUIRE(!Files::pathExists(fmt::format("{}/build", root)));
+
+	REQUIRE(Trash::wait());
+	REQUIRE(!Files::pathExists(trash));
+	REQUIRE(Files::pathExists(fmt::format("{}/kept/file.txt", root)));
+
+	// Whatever an interrupted run left behind is deleted the next time
+	auto leftovers = fmt::format("{}/other/.chalettrash", root);
+	REQUIRE(Files::createFileWithContents(fmt::format("{}/1.0/a/b/file.txt", leftovers), "", true));
+	Trash::reap(leftovers);
+	REQUIRE(Trash::wait());
+	REQUIRE(!Files::pathExists(leftovers));
+
+	// What couldn't be deleted is reported, and left in the trash (permissions don't stop root)
+#if !defined(CHALET_WIN32)
+	if (::geteuid() != 0)
+	{
+		auto locked = fmt::format("{}/locked/folder", root);
+		REQUIRE(Files::createFileWithContents(fmt::format("{}/file.txt", locked), "", true));
+		fs::permissions(locked, fs::perms::owner_write, fs::perm_options::remove, error);
+		REQUIRE(!error);
+
+		REQUIRE(Trash::remove(fmt::format("{}/locked", root), trash));
+		REQUIRE(!Trash::wait());
+		REQUIRE(Files::pathExists(trash));
+
+		for (auto& entry : fs::recursive_directory_iterator(trash, error))
+			fs::permissions(entry.path(), fs::perms::owner_all, fs::perm_options::add, error);
+	}
+#endif
+
+	Files::removeRecursively(root);
+}
+}